@@ -62,8 +62,10 @@ inline void for_all(const IndexType& begin,
 
 #else
 
-  constexpr bool is_serial = std::is_same<ExecSpace, SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
+  // without RAJA, host execution spaces, i.e., SEQ_EXEC and the spaces
+  // that build on it, run serially
+  constexpr bool is_host = !execution_space<ExecSpace>::onDevice();
+  AXOM_STATIC_ASSERT(is_host);
   for(IndexType i = begin; i < end; ++i)
   {
     kernel(i);
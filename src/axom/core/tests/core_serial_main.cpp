@@ -36,6 +36,7 @@
 #include "utils_endianness.hpp"
 #include "utils_fileUtilities.hpp"
 #include "utils_nvtx_settings.hpp"
+#include "utils_profiler.hpp"
 #include "utils_stringUtilities.hpp"
 #include "utils_system.hpp"
 #include "utils_Timer.hpp"
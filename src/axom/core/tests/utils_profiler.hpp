@@ -0,0 +1,193 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core/utilities/profiler/interface.hpp"
+#include "axom/core/utilities/FileUtilities.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>  // for std::remove
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
+//------------------------------------------------------------------------------
+// HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/// Returns the line of the text report for the region with the given label
+std::string report_line(const std::string& report, const std::string& label)
+{
+  std::istringstream is(report);
+  std::string line;
+  while(std::getline(is, line))
+  {
+    if(line.compare(0, label.size(), label) == 0 && line.size() > label.size() &&
+       line[label.size()] == ' ')
+    {
+      return line;
+    }
+  }
+  return std::string();
+}
+
+/// Returns the count in a line of the text report
+long report_count(const std::string& line)
+{
+  std::istringstream is(line);
+  std::string name;
+  long count = -1;
+  is >> name >> count;
+  return count;
+}
+
+void run_nested_regions(int n)
+{
+  for(int i = 0; i < n; ++i)
+  {
+    axom::profiler::Region outer("utils_profiler_outer");
+    {
+      axom::profiler::Region inner("utils_profiler_inner");
+    }
+    {
+      axom::profiler::Region inner("utils_profiler_inner");
+    }
+  }
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// UNIT TESTS
+//------------------------------------------------------------------------------
+TEST(utils_profiler, nested_regions)
+{
+  axom::profiler::reset();
+
+  constexpr int N = 5;
+  run_nested_regions(N);
+
+  const std::string report =
+    axom::profiler::get_report(axom::profiler::ReportFormat::TEXT);
+
+  const std::string outer = report_line(report, "utils_profiler_outer");
+  const std::string inner = report_line(report, "  utils_profiler_inner");
+  EXPECT_EQ(N, report_count(outer)) << report;
+  EXPECT_EQ(2 * N, report_count(inner)) << report;
+
+  // Regions are only nested in the region that entered them
+  EXPECT_TRUE(report_line(report, "utils_profiler_inner").empty());
+
+  axom::profiler::reset();
+  EXPECT_TRUE(report_line(axom::profiler::get_report(
+                            axom::profiler::ReportFormat::TEXT),
+                          "utils_profiler_outer")
+                .empty());
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_profiler, enable_disable)
+{
+  axom::profiler::reset();
+  EXPECT_TRUE(axom::profiler::is_enabled());
+
+  axom::profiler::set_enabled(false);
+  EXPECT_FALSE(axom::profiler::is_enabled());
+  run_nested_regions(3);
+
+  // Regions entered while enabled are recorded, even if disabled on exit
+  axom::profiler::set_enabled(true);
+  {
+    axom::profiler::Region outer("utils_profiler_outer");
+    axom::profiler::set_enabled(false);
+  }
+  axom::profiler::set_enabled(true);
+
+  const std::string report =
+    axom::profiler::get_report(axom::profiler::ReportFormat::TEXT);
+  EXPECT_EQ(1, report_count(report_line(report, "utils_profiler_outer")))
+    << report;
+  EXPECT_TRUE(report_line(report, "  utils_profiler_inner").empty());
+
+  axom::profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_profiler, json_report)
+{
+  axom::profiler::reset();
+  run_nested_regions(2);
+
+  const std::string report =
+    axom::profiler::get_report(axom::profiler::ReportFormat::JSON);
+
+  EXPECT_NE(std::string::npos, report.find("\"name\": \"utils_profiler_outer\""));
+  EXPECT_NE(std::string::npos, report.find("\"name\": \"utils_profiler_inner\""));
+  EXPECT_NE(std::string::npos, report.find("\"count\": 4"));
+  EXPECT_NE(std::string::npos, report.find("\"dropped_regions\": 0"));
+
+  // The inner region is nested in the children of the outer region
+  EXPECT_LT(report.find("utils_profiler_outer"),
+            report.find("utils_profiler_inner"));
+
+  axom::profiler::reset();
+}
+
+//------------------------------------------------------------------------------
+TEST(utils_profiler, finalize_writes_reports)
+{
+  namespace fs = axom::utilities::filesystem;
+
+  axom::profiler::reset();
+  run_nested_regions(1);
+
+  const std::string basename = "utils_profiler_report";
+  axom::profiler::finalize(basename);
+
+  EXPECT_TRUE(fs::pathExists(basename + ".txt"));
+  EXPECT_TRUE(fs::pathExists(basename + ".json"));
+
+  std::ifstream txt(basename + ".txt");
+  std::stringstream contents;
+  contents << txt.rdbuf();
+  EXPECT_EQ(1, report_count(report_line(contents.str(), "utils_profiler_outer")));
+
+  // finalize() discards the recorded regions
+  EXPECT_TRUE(
+    report_line(axom::profiler::get_report(axom::profiler::ReportFormat::TEXT),
+                "utils_profiler_outer")
+      .empty());
+
+  std::remove((basename + ".txt").c_str());
+  std::remove((basename + ".json").c_str());
+}
+
+//------------------------------------------------------------------------------
+#ifdef AXOM_USE_OPENMP
+TEST(utils_profiler, merge_threads)
+{
+  axom::profiler::reset();
+
+  constexpr int N = 64;
+  #pragma omp parallel for
+  for(int i = 0; i < N; ++i)
+  {
+    axom::profiler::Region region("utils_profiler_thread");
+  }
+
+  const std::string report =
+    axom::profiler::get_report(axom::profiler::ReportFormat::TEXT);
+  EXPECT_EQ(N, report_count(report_line(report, "utils_profiler_thread")))
+    << report;
+
+  axom::profiler::reset();
+}
+#endif
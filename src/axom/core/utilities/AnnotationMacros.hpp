@@ -10,6 +10,7 @@
 
 #ifndef AXOM_USE_CALIPER
   #include "axom/core/utilities/nvtx/interface.hpp"
+  #include "axom/core/utilities/profiler/Region.hpp"
 #endif
 
 /*!
@@ -23,6 +24,10 @@
  *  the function to annotate.
  * 
  * 
+ * \note When annotations are enabled, the function is recorded as a region
+ *  in Axom's built-in profiler and, on CUDA builds, as an NVTX range.
+ *  The name must be a string literal.
+ *
  * \warning The AXOM_PERF_MARK_FUNCTION can only be called once within a given
  *  (function) scope.
  * 
@@ -39,7 +44,8 @@
 #if defined(AXOM_USE_ANNOTATIONS) && defined(AXOM_USE_CALIPER)
   #error "Support for Caliper has not yet been implemented in Axom!"
 #elif defined(AXOM_USE_ANNOTATIONS)
-  #define AXOM_PERF_MARK_FUNCTION(__func_name__) \
+  #define AXOM_PERF_MARK_FUNCTION(__func_name__)                   \
+    axom::profiler::Region __axom_perf_func_region(__func_name__); \
     AXOM_NVTX_FUNCTION(__func_name__)
 #else
   #define AXOM_PERF_MARK_FUNCTION(__func_name__)
@@ -88,8 +94,12 @@
 #if defined(AXOM_USE_ANNOTATIONS) && defined(AXOM_USE_CALIPER)
   #error "Support for Caliper has not yet been implemented in Axom!"
 #elif defined(AXOM_USE_ANNOTATIONS)
-  #define AXOM_PERF_MARK_SECTION(__name__, ...) \
-    AXOM_NVTX_SECTION(__name__, __VA_ARGS__)
+  #define AXOM_PERF_MARK_SECTION(__name__, ...)                    \
+    do                                                             \
+    {                                                              \
+      axom::profiler::Region __axom_perf_section_region(__name__); \
+      AXOM_NVTX_SECTION(__name__, __VA_ARGS__);                    \
+    } while(false)
 #else
   #define AXOM_PERF_MARK_SECTION(__name__, ...) \
     do                                          \
@@ -0,0 +1,74 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PROFILER_REGION_HPP_
+#define AXOM_PROFILER_REGION_HPP_
+
+#include "axom/core/Macros.hpp"  // for axom macros
+
+namespace axom
+{
+namespace profiler
+{
+/*!
+ * \brief Enters the region with the given name on the calling thread.
+ *
+ * The region becomes a child of the innermost region that is active on the
+ * calling thread.
+ *
+ * \param [in] name the name of the region
+ *
+ * \note Regions are identified by their name and their parent region.
+ *  The first call on a thread allocates that thread's region tree; subsequent
+ *  calls do not allocate memory.
+ *
+ * \pre name points to a string with static storage duration, e.g.,
+ *  a string literal
+ * \pre Each call to begin_region() is matched by a call to end_region()
+ */
+void begin_region(const char* name);
+
+/*!
+ * \brief Exits the innermost active region on the calling thread, adding
+ *  the time since the matching call to begin_region() to its total.
+ */
+void end_region();
+
+/*!
+ * \class Region
+ *
+ * \brief Scoped annotation of a region of code for the built-in profiler.
+ *
+ * The region is entered when a Region is constructed and exited when it goes
+ * out of scope. Regions are usually created through the AXOM_PERF_MARK_FUNCTION
+ * and AXOM_PERF_MARK_SECTION macros.
+ *
+ * \see axom/core/utilities/profiler/interface.hpp
+ */
+class Region
+{
+public:
+  Region() = delete;
+
+  /*!
+   * \brief Enters the region with the given name.
+   * \pre name points to a string with static storage duration
+   */
+  explicit Region(const char* name) { begin_region(name); }
+
+  /*!
+   * \brief Exits the region.
+   */
+  ~Region() { end_region(); }
+
+private:
+  DISABLE_COPY_AND_ASSIGNMENT(Region);
+  DISABLE_MOVE_AND_ASSIGNMENT(Region);
+};
+
+} /* namespace profiler */
+} /* namespace axom */
+
+#endif /* AXOM_PROFILER_REGION_HPP_ */
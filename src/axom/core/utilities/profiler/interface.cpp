@@ -0,0 +1,558 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"  // for axom compile-time definitions
+
+#include "axom/core/utilities/profiler/interface.hpp"
+
+// C/C++ includes
+#include <algorithm>  // for std::min, std::max
+#include <atomic>     // for std::atomic
+#include <chrono>     // for std::chrono::steady_clock
+#include <cstdint>    // for std::uint64_t
+#include <cstring>    // for std::strcmp
+#include <fstream>    // for std::ofstream
+#include <iomanip>    // for std::setw
+#include <memory>     // for std::unique_ptr
+#include <mutex>      // for std::mutex
+#include <sstream>    // for std::ostringstream
+#include <vector>     // for std::vector
+
+#ifdef AXOM_USE_MPI
+  #include <mpi.h>
+#endif
+
+namespace axom
+{
+namespace profiler
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+/// Maximum number of distinct regions recorded by each thread
+constexpr int MAX_REGIONS = 4096;
+
+/// Maximum nesting depth of the regions recorded by each thread
+constexpr int MAX_DEPTH = 128;
+
+constexpr int ROOT = 0;
+constexpr int UNTRACKED = -1;
+
+std::atomic<bool> s_enabled {true};
+
+/*!
+ * \brief A node in a thread's region tree.
+ *
+ * The children of a node are stored as a linked list in the order in which
+ * they were first entered.
+ */
+struct RegionNode
+{
+  const char* name;
+  int firstChild;
+  int lastChild;
+  int nextSibling;
+  std::uint64_t count;
+  std::int64_t nanoseconds;
+};
+
+/*!
+ * \brief The tree of regions recorded by a single thread.
+ *
+ * All storage is allocated up front, so entering and exiting regions does not
+ * allocate memory. Regions beyond the capacity of the tree are not recorded.
+ */
+class ThreadTree
+{
+public:
+  ThreadTree() { clear(); }
+
+  void clear()
+  {
+    m_nodes[ROOT] = RegionNode {"", UNTRACKED, UNTRACKED, UNTRACKED, 0, 0};
+    m_numNodes = 1;
+    m_depth = 0;
+    m_numDropped = 0;
+  }
+
+  void begin(const char* name, bool tracked)
+  {
+    if(m_depth < MAX_DEPTH)
+    {
+      const int parent = (m_depth == 0) ? ROOT : m_stack[m_depth - 1];
+      m_stack[m_depth] = (tracked && parent != UNTRACKED)
+        ? findOrAddChild(parent, name)
+        : UNTRACKED;
+      m_start[m_depth] = Clock::now();
+    }
+    else
+    {
+      ++m_numDropped;
+    }
+    ++m_depth;
+  }
+
+  void end()
+  {
+    if(m_depth == 0)
+    {
+      return;  // unmatched end_region(), e.g., after a reset()
+    }
+
+    --m_depth;
+    if(m_depth < MAX_DEPTH && m_stack[m_depth] != UNTRACKED)
+    {
+      const auto elapsed = Clock::now() - m_start[m_depth];
+      RegionNode& node = m_nodes[m_stack[m_depth]];
+      node.nanoseconds +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+      ++node.count;
+    }
+  }
+
+  const RegionNode& node(int idx) const { return m_nodes[idx]; }
+
+  std::uint64_t numDropped() const { return m_numDropped; }
+
+private:
+  int findOrAddChild(int parent, const char* name)
+  {
+    for(int c = m_nodes[parent].firstChild; c != UNTRACKED;
+        c = m_nodes[c].nextSibling)
+    {
+      const char* childName = m_nodes[c].name;
+      if(childName == name || std::strcmp(childName, name) == 0)
+      {
+        return c;
+      }
+    }
+
+    if(m_numNodes == MAX_REGIONS)
+    {
+      ++m_numDropped;
+      return UNTRACKED;
+    }
+
+    const int idx = m_numNodes++;
+    m_nodes[idx] = RegionNode {name, UNTRACKED, UNTRACKED, UNTRACKED, 0, 0};
+
+    RegionNode& p = m_nodes[parent];
+    if(p.lastChild == UNTRACKED)
+    {
+      p.firstChild = idx;
+    }
+    else
+    {
+      m_nodes[p.lastChild].nextSibling = idx;
+    }
+    p.lastChild = idx;
+
+    return idx;
+  }
+
+  RegionNode m_nodes[MAX_REGIONS];
+  int m_numNodes;
+
+  int m_stack[MAX_DEPTH];
+  Clock::time_point m_start[MAX_DEPTH];
+  int m_depth;
+
+  std::uint64_t m_numDropped;
+};
+
+/// Holds the region trees of all threads that have entered a region
+struct Registry
+{
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadTree>> trees;
+};
+
+Registry& registry()
+{
+  static Registry s_registry;
+  return s_registry;
+}
+
+ThreadTree& threadTree()
+{
+  thread_local ThreadTree* tree = nullptr;
+  if(tree == nullptr)
+  {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.trees.emplace_back(new ThreadTree);
+    tree = reg.trees.back().get();
+  }
+  return *tree;
+}
+
+/*!
+ * \brief A region in the tree that is merged across threads and ranks.
+ *
+ * The time of a region on a rank is the sum of its times over the threads
+ * of that rank.
+ */
+struct MergedRegion
+{
+  std::string name;
+  std::uint64_t count {0};
+  double seconds {0.};  // time on a single rank
+
+  double minSeconds {0.};
+  double maxSeconds {0.};
+  double sumSeconds {0.};
+  int numRanks {0};
+
+  std::vector<MergedRegion> children;
+
+  MergedRegion& child(const std::string& childName)
+  {
+    for(auto& c : children)
+    {
+      if(c.name == childName)
+      {
+        return c;
+      }
+    }
+    children.emplace_back();
+    children.back().name = childName;
+    return children.back();
+  }
+};
+
+/// Adds the children of \a node in \a tree to \a merged
+void mergeThreadTree(const ThreadTree& tree, int node, MergedRegion& merged)
+{
+  for(int c = tree.node(node).firstChild; c != UNTRACKED;
+      c = tree.node(c).nextSibling)
+  {
+    const RegionNode& region = tree.node(c);
+    MergedRegion& m = merged.child(region.name);
+    m.count += region.count;
+    m.seconds += region.nanoseconds * 1e-9;
+    mergeThreadTree(tree, c, m);
+  }
+}
+
+/// Adds the children of \a rankTree, the merged tree of one rank, to \a merged
+void mergeRankTree(const MergedRegion& rankTree, MergedRegion& merged)
+{
+  for(const auto& c : rankTree.children)
+  {
+    MergedRegion& m = merged.child(c.name);
+    m.count += c.count;
+    m.minSeconds = (m.numRanks == 0) ? c.seconds
+                                     : std::min(m.minSeconds, c.seconds);
+    m.maxSeconds = (m.numRanks == 0) ? c.seconds
+                                     : std::max(m.maxSeconds, c.seconds);
+    m.sumSeconds += c.seconds;
+    ++m.numRanks;
+    mergeRankTree(c, m);
+  }
+}
+
+#ifdef AXOM_USE_MPI
+/// Writes the tree as one line per region: depth, count, seconds and name
+void serialize(const MergedRegion& region, int depth, std::ostream& os)
+{
+  for(const auto& c : region.children)
+  {
+    os << depth << ' ' << c.count << ' ' << c.seconds << ' ' << c.name << '\n';
+    serialize(c, depth + 1, os);
+  }
+}
+
+/// Reconstructs a tree written by serialize()
+MergedRegion deserialize(const std::string& str)
+{
+  MergedRegion root;
+  std::vector<MergedRegion*> stack {&root};
+
+  std::istringstream is(str);
+  int depth;
+  while(is >> depth)
+  {
+    MergedRegion region;
+    is >> region.count >> region.seconds;
+    is.get();  // skip the separator before the name
+    std::getline(is, region.name);
+
+    stack.resize(depth + 1);
+    stack[depth]->children.push_back(region);
+    stack.push_back(&stack[depth]->children.back());
+  }
+
+  return root;
+}
+
+bool isMPIActive()
+{
+  int initialized = 0;
+  int finalized = 0;
+  MPI_Initialized(&initialized);
+  MPI_Finalized(&finalized);
+  return initialized && !finalized;
+}
+#endif
+
+/*!
+ * \brief Merges the regions over all threads and ranks.
+ *
+ * \param [out] merged the root of the merged tree (on rank 0)
+ * \param [out] numRanks the number of ranks
+ * \param [out] numDropped the number of regions that were not recorded
+ * \return true on the rank that holds the merged tree
+ */
+bool mergeAll(MergedRegion& merged, int& numRanks, std::uint64_t& numDropped)
+{
+  MergedRegion local;
+  numDropped = 0;
+  {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for(const auto& tree : reg.trees)
+    {
+      mergeThreadTree(*tree, ROOT, local);
+      numDropped += tree->numDropped();
+    }
+  }
+
+  numRanks = 1;
+#ifdef AXOM_USE_MPI
+  if(isMPIActive())
+  {
+    int rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &numRanks);
+
+    std::ostringstream oss;
+    oss.precision(17);
+    serialize(local, 0, oss);
+    const std::string str = oss.str();
+
+    int length = static_cast<int>(str.size());
+    std::vector<int> lengths(numRanks, 0);
+    MPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    std::vector<int> offsets(numRanks, 0);
+    for(int r = 1; r < numRanks; ++r)
+    {
+      offsets[r] = offsets[r - 1] + lengths[r - 1];
+    }
+    std::vector<char> buffer(
+      (rank == 0) ? offsets[numRanks - 1] + lengths[numRanks - 1] : 0);
+    MPI_Gatherv(str.data(),
+                length,
+                MPI_CHAR,
+                buffer.data(),
+                lengths.data(),
+                offsets.data(),
+                MPI_CHAR,
+                0,
+                MPI_COMM_WORLD);
+
+    unsigned long long localDropped = numDropped;
+    unsigned long long totalDropped = 0;
+    MPI_Reduce(&localDropped,
+               &totalDropped,
+               1,
+               MPI_UNSIGNED_LONG_LONG,
+               MPI_SUM,
+               0,
+               MPI_COMM_WORLD);
+    numDropped = totalDropped;
+
+    if(rank != 0)
+    {
+      return false;
+    }
+
+    for(int r = 0; r < numRanks; ++r)
+    {
+      const std::string rankStr(buffer.data() + offsets[r], lengths[r]);
+      mergeRankTree(deserialize(rankStr), merged);
+    }
+    return true;
+  }
+#endif
+
+  mergeRankTree(local, merged);
+  return true;
+}
+
+void writeText(const MergedRegion& region,
+               int depth,
+               int nameWidth,
+               std::ostream& os)
+{
+  for(const auto& c : region.children)
+  {
+    const std::string label = std::string(2 * depth, ' ') + c.name;
+    os << std::left << std::setw(nameWidth) << label << std::right
+       << std::setw(12) << c.count << std::setw(14) << c.minSeconds
+       << std::setw(14) << c.sumSeconds / c.numRanks << std::setw(14)
+       << c.maxSeconds << std::setw(8) << c.numRanks << '\n';
+    writeText(c, depth + 1, nameWidth, os);
+  }
+}
+
+int labelWidth(const MergedRegion& region, int depth)
+{
+  int width = 0;
+  for(const auto& c : region.children)
+  {
+    width = std::max(width, 2 * depth + static_cast<int>(c.name.size()));
+    width = std::max(width, labelWidth(c, depth + 1));
+  }
+  return width;
+}
+
+std::string jsonEscape(const std::string& str)
+{
+  std::string escaped;
+  for(char ch : str)
+  {
+    if(ch == '"' || ch == '\\')
+    {
+      escaped += '\\';
+    }
+    escaped += ch;
+  }
+  return escaped;
+}
+
+void writeJSON(const MergedRegion& region, int depth, std::ostream& os)
+{
+  const std::string indent(2 * depth, ' ');
+  for(std::size_t i = 0; i < region.children.size(); ++i)
+  {
+    const MergedRegion& c = region.children[i];
+    os << indent << "{\n"
+       << indent << "  \"name\": \"" << jsonEscape(c.name) << "\",\n"
+       << indent << "  \"count\": " << c.count << ",\n"
+       << indent << "  \"min\": " << c.minSeconds << ",\n"
+       << indent << "  \"avg\": " << c.sumSeconds / c.numRanks << ",\n"
+       << indent << "  \"max\": " << c.maxSeconds << ",\n"
+       << indent << "  \"ranks\": " << c.numRanks << ",\n"
+       << indent << "  \"children\": [";
+    if(!c.children.empty())
+    {
+      os << '\n';
+      writeJSON(c, depth + 2, os);
+      os << indent << "  ";
+    }
+    os << "]\n" << indent << '}' << (i + 1 < region.children.size() ? "," : "")
+       << '\n';
+  }
+}
+
+std::string formatReport(const MergedRegion& merged,
+                         int numRanks,
+                         std::uint64_t numDropped,
+                         ReportFormat format)
+{
+  std::ostringstream os;
+  os.precision(6);
+
+  if(format == ReportFormat::JSON)
+  {
+    os << "{\n"
+       << "  \"ranks\": " << numRanks << ",\n"
+       << "  \"dropped_regions\": " << numDropped << ",\n"
+       << "  \"regions\": [";
+    if(!merged.children.empty())
+    {
+      os << '\n';
+      writeJSON(merged, 2, os);
+      os << "  ";
+    }
+    os << "]\n}\n";
+  }
+  else
+  {
+    const int nameWidth = std::max(labelWidth(merged, 0), 6) + 2;
+    os << std::left << std::setw(nameWidth) << "Region" << std::right
+       << std::setw(12) << "Count" << std::setw(14) << "Min (s)"
+       << std::setw(14) << "Avg (s)" << std::setw(14) << "Max (s)"
+       << std::setw(8) << "Ranks" << '\n';
+    writeText(merged, 0, nameWidth, os);
+    if(numDropped > 0)
+    {
+      os << "Note: " << numDropped
+         << " region(s) were not recorded since they exceeded the maximum"
+            " number or depth of regions\n";
+    }
+  }
+
+  return os.str();
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+// Region implementation
+//------------------------------------------------------------------------------
+void begin_region(const char* name)
+{
+  threadTree().begin(name, s_enabled.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+void end_region() { threadTree().end(); }
+
+//------------------------------------------------------------------------------
+// Profiler interface implementation
+//------------------------------------------------------------------------------
+void set_enabled(bool enabled) { s_enabled = enabled; }
+
+//------------------------------------------------------------------------------
+bool is_enabled() { return s_enabled; }
+
+//------------------------------------------------------------------------------
+void reset()
+{
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for(auto& tree : reg.trees)
+  {
+    tree->clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+std::string get_report(ReportFormat format)
+{
+  MergedRegion merged;
+  int numRanks = 0;
+  std::uint64_t numDropped = 0;
+  if(!mergeAll(merged, numRanks, numDropped))
+  {
+    return std::string();
+  }
+
+  return formatReport(merged, numRanks, numDropped, format);
+}
+
+//------------------------------------------------------------------------------
+void finalize(const std::string& basename)
+{
+  MergedRegion merged;
+  int numRanks = 0;
+  std::uint64_t numDropped = 0;
+  if(mergeAll(merged, numRanks, numDropped) && !merged.children.empty())
+  {
+    std::ofstream txt(basename + ".txt");
+    txt << formatReport(merged, numRanks, numDropped, ReportFormat::TEXT);
+
+    std::ofstream json(basename + ".json");
+    json << formatReport(merged, numRanks, numDropped, ReportFormat::JSON);
+  }
+
+  reset();
+}
+
+} /* namespace profiler */
+} /* namespace axom */
@@ -0,0 +1,101 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_PROFILER_INTERFACE_HPP_
+#define AXOM_PROFILER_INTERFACE_HPP_
+
+#include "axom/core/utilities/profiler/Region.hpp"
+
+// C/C++ includes
+#include <string>  // for std::string
+
+/*!
+ * \file interface.hpp
+ *
+ * \brief Defines the interface of Axom's built-in CPU profiler.
+ *
+ * When Axom is configured with AXOM_ENABLE_ANNOTATIONS, each
+ * AXOM_PERF_MARK_FUNCTION and AXOM_PERF_MARK_SECTION annotation is recorded
+ * as a region in a per-thread tree of call counts and timings. The trees are
+ * merged across threads and, when MPI is initialized, across the ranks of
+ * MPI_COMM_WORLD, with the minimum, average and maximum time of each region
+ * over the ranks that entered it.
+ *
+ * Usage Example:
+ * \code
+ *   MPI_Init(&argc, &argv);
+ *   ...
+ *   // annotated calls, e.g., to spin::BVH or quest::SignedDistance
+ *   ...
+ *   // writes axom_profile.txt and axom_profile.json on rank 0
+ *   axom::profiler::finalize();
+ *   MPI_Finalize();
+ * \endcode
+ *
+ * \note The functions in this file must be called from the main thread
+ *  while no regions are active on other threads.
+ */
+
+namespace axom
+{
+namespace profiler
+{
+/// Formats for the profiler's report
+enum class ReportFormat
+{
+  TEXT,  //!< An indented table with one region per line
+  JSON   //!< A tree of JSON objects with a "children" array
+};
+
+/// \name Profiler API Functions
+/// @{
+
+/*!
+ * \brief Enables or disables recording of regions on all threads.
+ * \note Recording is enabled by default.
+ */
+void set_enabled(bool enabled);
+
+/*!
+ * \brief Returns true if regions are currently being recorded.
+ */
+bool is_enabled();
+
+/*!
+ * \brief Discards all recorded regions.
+ */
+void reset();
+
+/*!
+ * \brief Returns a report of the recorded regions, merged over all threads.
+ *
+ * \param [in] format the format of the report
+ *
+ * \note When MPI is initialized, this function is collective over
+ *  MPI_COMM_WORLD and the regions are merged across ranks. The report is only
+ *  returned on rank 0; other ranks return an empty string.
+ */
+std::string get_report(ReportFormat format);
+
+/*!
+ * \brief Writes the text and JSON reports of the recorded regions and then
+ *  discards them.
+ *
+ * \param [in] basename the reports are written to basename.txt and
+ *  basename.json (optional).
+ *
+ * \note When MPI is initialized, this function is collective over
+ *  MPI_COMM_WORLD and the files are written by rank 0. It should be called
+ *  before MPI_Finalize().
+ * \note Nothing is written when no regions were recorded.
+ */
+void finalize(const std::string& basename = "axom_profile");
+
+/// @}
+
+} /* namespace profiler */
+} /* namespace axom */
+
+#endif /* AXOM_PROFILER_INTERFACE_HPP_ */
@@ -0,0 +1,128 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/mint.hpp"
+
+namespace mint = axom::mint;
+namespace xargs = axom::mint::xargs;
+using axom::IndexType;
+
+//------------------------------------------------------------------------------
+namespace
+{
+using seq_exec = axom::SEQ_EXEC;
+using tiled_seq_exec = mint::TILED_EXEC<axom::SEQ_EXEC, 64, 8, 8>;
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+using omp_exec = axom::OMP_EXEC;
+using tiled_omp_exec = mint::TILED_EXEC<axom::OMP_EXEC, 64, 8, 8>;
+#endif
+
+constexpr int SEVEN_POINT = 7;
+constexpr int TWENTY_SEVEN_POINT = 27;
+
+void CustomArgs(benchmark::internal::Benchmark* b)
+{
+  b->Arg(64);
+  b->Arg(128);
+  b->Arg(256);
+}
+
+// Creates a uniform N x N x N cell mesh with a cell-centered input field "u"
+// and an output field "v"
+mint::UniformMesh* create_mesh(IndexType N)
+{
+  const double lo[] = {0., 0., 0.};
+  const double hi[] = {1., 1., 1.};
+  mint::UniformMesh* mesh = new mint::UniformMesh(lo, hi, N + 1, N + 1, N + 1);
+
+  double* u = mesh->createField<double>("u", mint::CELL_CENTERED);
+  double* v = mesh->createField<double>("v", mint::CELL_CENTERED);
+  for(IndexType icell = 0; icell < mesh->getNumberOfCells(); ++icell)
+  {
+    u[icell] = static_cast<double>(icell % 17);
+    v[icell] = 0.;
+  }
+
+  return mesh;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, int STENCIL>
+void stencil_sweep(benchmark::State& state)
+{
+  const IndexType N = state.range(0);
+  mint::UniformMesh* mesh = create_mesh(N);
+
+  const double* u = mesh->getFieldPtr<double>("u", mint::CELL_CENTERED);
+  double* v = mesh->getFieldPtr<double>("v", mint::CELL_CENTERED);
+
+  // the 7-point stencil only reads the face neighbors of each cell
+  const int faces[] = {xargs::stencil::position(-1, 0, 0),
+                       xargs::stencil::position(1, 0, 0),
+                       xargs::stencil::position(0, -1, 0),
+                       xargs::stencil::position(0, 1, 0),
+                       xargs::stencil::position(0, 0, -1),
+                       xargs::stencil::position(0, 0, 1)};
+
+  while(state.KeepRunning())
+  {
+    mint::for_all_cells<ExecPolicy, xargs::stencil>(
+      mesh,
+      AXOM_LAMBDA(IndexType cellID, const IndexType* neighbors, IndexType numNbrs) {
+        double sum = 0.;
+        if(STENCIL == SEVEN_POINT)
+        {
+          for(int n = 0; n < 6; ++n)
+          {
+            const IndexType nbr = neighbors[faces[n]];
+            sum += (nbr < 0) ? u[cellID] : u[nbr];
+          }
+          v[cellID] = sum / 6.;
+        }
+        else
+        {
+          for(int n = 0; n < numNbrs; ++n)
+          {
+            sum += (neighbors[n] < 0) ? u[cellID] : u[neighbors[n]];
+          }
+          v[cellID] = sum / numNbrs;
+        }
+      });
+    benchmark::DoNotOptimize(v);
+  }
+
+  state.SetItemsProcessed(state.iterations() * mesh->getNumberOfCells());
+  delete mesh;
+}
+BENCHMARK_TEMPLATE(stencil_sweep, seq_exec, SEVEN_POINT)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(stencil_sweep, tiled_seq_exec, SEVEN_POINT)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(stencil_sweep, seq_exec, TWENTY_SEVEN_POINT)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(stencil_sweep, tiled_seq_exec, TWENTY_SEVEN_POINT)
+  ->Apply(CustomArgs);
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+BENCHMARK_TEMPLATE(stencil_sweep, omp_exec, SEVEN_POINT)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(stencil_sweep, tiled_omp_exec, SEVEN_POINT)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(stencil_sweep, omp_exec, TWENTY_SEVEN_POINT)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(stencil_sweep, tiled_omp_exec, TWENTY_SEVEN_POINT)
+  ->Apply(CustomArgs);
+#endif
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::benchmark::Initialize(&argc, argv);
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
@@ -11,6 +11,7 @@
 #include "axom/core/execution/execution_space.hpp"  // for execution_space traits
 
 #include "axom/mint/execution/xargs.hpp"                   // for xargs
+#include "axom/mint/execution/tiled_exec.hpp"              // for TILED_EXEC
 #include "axom/mint/execution/internal/for_all_cells.hpp"  // for_all_cells()
 #include "axom/mint/execution/internal/for_all_nodes.hpp"  // for_all_nodes()
 #include "axom/mint/execution/internal/for_all_faces.hpp"  // for_all_faces()
@@ -127,8 +128,17 @@ namespace mint
  *    { ... }
  *  );
  *
+ *  for_all_nodes< exec, xargs::cellids >( m,
+ *    AXOM_LAMBDA( IndexType nodeID, const IndexType* cellIDs, IndexType N )
+ *    { ... }
+ *  );
+ *
  * \endcode
  *
+ * \note The xargs::cellids option gathers the cells incident on each node,
+ *  which for an UnstructuredMesh requires a prior call to
+ *  UnstructuredMesh::initializeNodeCellConnectivity().
+ *
  * \see execution_space.hpp
  * \see xargs.hpp
  */
@@ -220,8 +230,17 @@ inline void for_all_nodes(const Mesh* m, KernelType&& kernel)
  *    { ... }
  *  );
  *
+ *  for_all_cells< exec, xargs::stencil >( m,
+ *    AXOM_LAMBDA( IndexType cellID, const IndexType* neighborIDs, IndexType N )
+ *    { ... }
+ *  );
+ *
  * \endcode
  *
+ * \note The IJ and IJK traversals of structured meshes, i.e., with xargs::ij,
+ *  xargs::ijk and xargs::stencil, may be tiled for cache reuse by using a
+ *  mint::TILED_EXEC execution policy.
+ *
  * \see execution_space.hpp
  * \see xargs.hpp
  */
@@ -264,6 +283,87 @@ inline void for_all_cells(const Mesh* m, KernelType&& kernel)
 
 /// @}
 
+/*!
+ * \brief Loops over all the cells of a given unstructured mesh, one color
+ *  of cells at a time.
+ *
+ * \param [in] m pointer to the mesh object.
+ * \param [in] kernel user-supplied kernel to execute on each cell.
+ *
+ * \pre m != nullptr
+ * \pre m is an UnstructuredMesh whose cell coloring was computed by
+ *  UnstructuredMesh::initializeCellColoring()
+ *
+ * \tparam ExecPolicy the execution policy, e.g., serial or parallel
+ * \tparam ArgType object indicating the arguments to the kernel, either
+ *  xargs::index or xargs::nodeids
+ *
+ * Cells of the same color share no node, and are traversed in parallel
+ * with the given execution policy, while the colors are traversed one after
+ * another. A kernel may thus scatter contributions to the nodes of its cell,
+ * e.g., for finite element assembly, without atomics or races.
+ *
+ * Usage Example:
+ * \code
+ *
+ *  mesh->initializeCellColoring();
+ *
+ *  double* nodal_sum = mesh->getFieldPtr< double >( "sum", NODE_CENTERED );
+ *  for_all_colored_cells< exec, xargs::nodeids >( mesh,
+ *    AXOM_LAMBDA( IndexType cellID, const IndexType* nodeIDs, IndexType N )
+ *    {
+ *      for ( IndexType i = 0; i < N; ++i )
+ *      {
+ *        nodal_sum[ nodeIDs[ i ] ] += cell_values[ cellID ];
+ *      }
+ *    }
+ *  );
+ *
+ * \endcode
+ *
+ * \see execution_space.hpp
+ * \see xargs.hpp
+ */
+/// @{
+
+template <typename ExecPolicy, typename ArgType = xargs::index, typename MeshType, typename KernelType>
+inline void for_all_colored_cells(const MeshType* m, KernelType&& kernel)
+{
+  // compile-time sanity checks
+  AXOM_STATIC_ASSERT(execution_space<ExecPolicy>::valid());
+  AXOM_STATIC_ASSERT(xargs_traits<ArgType>::valid());
+
+  constexpr bool valid_mesh_type = std::is_base_of<Mesh, MeshType>::value;
+  AXOM_STATIC_ASSERT(valid_mesh_type);
+
+  // run-time sanity checks
+  SLIC_ASSERT(m != nullptr);
+
+  // dispatch
+  internal::for_all_colored_cells_impl<ExecPolicy>(
+    ArgType(),
+    *m,
+    std::forward<KernelType>(kernel));
+}
+
+template <typename ExecPolicy, typename ArgType = xargs::index, typename KernelType>
+inline void for_all_colored_cells(const Mesh* m, KernelType&& kernel)
+{
+  // compile-time sanity checks
+  AXOM_STATIC_ASSERT(execution_space<ExecPolicy>::valid());
+  AXOM_STATIC_ASSERT(xargs_traits<ArgType>::valid());
+
+  // run-time sanity checks
+  SLIC_ASSERT(m != nullptr);
+
+  //dispatch
+  internal::for_all_colored_cells<ExecPolicy>(ArgType(),
+                                              *m,
+                                              std::forward<KernelType>(kernel));
+}
+
+/// @}
+
 /// @}
 
 /// \name Mesh Face Traversal Functions
@@ -67,35 +67,13 @@ inline void for_all_cells_impl(xargs::ij,
   const IndexType Ni = m.getCellResolution(I_DIRECTION);
   const IndexType Nj = m.getCellResolution(J_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range),
+  structured_loop2d<ExecPolicy>(
+    Ni,
+    Nj,
     AXOM_LAMBDA(IndexType i, IndexType j) {
       const IndexType cellID = i + j * jp;
       kernel(cellID, i, j);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType j_offset = j * jp;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType cellID = i + j_offset;
-      kernel(cellID, i, j);
-    }  // END for all i
-  }    // END for all j
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -125,40 +103,14 @@ inline void for_all_cells_impl(xargs::ijk,
   const IndexType jp = m.cellJp();
   const IndexType kp = m.cellKp();
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  RAJA::RangeSegment k_range(0, Nk);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range, k_range),
+  structured_loop3d<ExecPolicy>(
+    Ni,
+    Nj,
+    Nk,
     AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
       const IndexType cellID = i + j * jp + k * kp;
       kernel(cellID, i, j, k);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * kp;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType j_offset = j * jp;
-      for(IndexType i = 0; i < Ni; ++i)
-      {
-        const IndexType cellID = i + j_offset + k_offset;
-        kernel(cellID, i, j, k);
-      }  // END for all i
-    }    // END for all j
-  }      // END for all k
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -299,6 +251,109 @@ inline void for_all_cells(xargs::nodeids, const Mesh& m, KernelType&& kernel)
   }
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_cells_impl(xargs::stencil,
+                               const StructuredMesh& m,
+                               KernelType&& kernel)
+{
+  const int dimension = m.getDimension();
+  SLIC_ERROR_IF(dimension == 1,
+                "xargs::stencil is only valid for 2D and 3D structured meshes!");
+
+  const IndexType Ni = m.getCellResolution(I_DIRECTION);
+  const IndexType Nj = m.getCellResolution(J_DIRECTION);
+  const IndexType jp = m.cellJp();
+
+  if(dimension == 2)
+  {
+    // the neighbor offsets are the same for all the cells
+    StackArray<IndexType, 9> offsets;
+    for(int dj = -1; dj <= 1; ++dj)
+    {
+      for(int di = -1; di <= 1; ++di)
+      {
+        offsets[xargs::stencil::position(di, dj)] = di + dj * jp;
+      }
+    }
+
+    structured_loop2d<ExecPolicy>(
+      Ni,
+      Nj,
+      AXOM_LAMBDA(IndexType i, IndexType j) {
+        const IndexType cellID = i + j * jp;
+        IndexType neighbors[9];
+
+        const bool interior = (i > 0) && (i < Ni - 1) && (j > 0) && (j < Nj - 1);
+        for(int n = 0; n < 9; ++n)
+        {
+          const IndexType ii = i + (n % 3) - 1;
+          const IndexType jj = j + (n / 3) - 1;
+          const bool inside =
+            interior || ((ii >= 0) && (ii < Ni) && (jj >= 0) && (jj < Nj));
+          neighbors[n] = inside ? cellID + offsets[n] : -1;
+        }
+
+        kernel(cellID, neighbors, 9);
+      });
+  }
+  else
+  {
+    const IndexType Nk = m.getCellResolution(K_DIRECTION);
+    const IndexType kp = m.cellKp();
+
+    // the neighbor offsets are the same for all the cells
+    StackArray<IndexType, 27> offsets;
+    for(int dk = -1; dk <= 1; ++dk)
+    {
+      for(int dj = -1; dj <= 1; ++dj)
+      {
+        for(int di = -1; di <= 1; ++di)
+        {
+          offsets[xargs::stencil::position(di, dj, dk)] = di + dj * jp + dk * kp;
+        }
+      }
+    }
+
+    structured_loop3d<ExecPolicy>(
+      Ni,
+      Nj,
+      Nk,
+      AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
+        const IndexType cellID = i + j * jp + k * kp;
+        IndexType neighbors[27];
+
+        const bool interior = (i > 0) && (i < Ni - 1) && (j > 0) &&
+          (j < Nj - 1) && (k > 0) && (k < Nk - 1);
+        for(int n = 0; n < 27; ++n)
+        {
+          const IndexType ii = i + (n % 3) - 1;
+          const IndexType jj = j + ((n / 3) % 3) - 1;
+          const IndexType kk = k + (n / 9) - 1;
+          const bool inside = interior ||
+            ((ii >= 0) && (ii < Ni) && (jj >= 0) && (jj < Nj) && (kk >= 0) &&
+             (kk < Nk));
+          neighbors[n] = inside ? cellID + offsets[n] : -1;
+        }
+
+        kernel(cellID, neighbors, 27);
+      });
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_cells(xargs::stencil, const Mesh& m, KernelType&& kernel)
+{
+  SLIC_ERROR_IF(!m.isStructured(),
+                "xargs::stencil is only valid on structured meshes!");
+
+  const StructuredMesh& sm = static_cast<const StructuredMesh&>(m);
+  for_all_cells_impl<ExecPolicy>(xargs::stencil(),
+                                 sm,
+                                 std::forward<KernelType>(kernel));
+}
+
 //------------------------------------------------------------------------------
 template <typename ExecPolicy, typename KernelType>
 inline void for_all_cells_impl(xargs::faceids,
@@ -759,6 +814,93 @@ inline void for_all_cells(xargs::coords, const Mesh& m, KernelType&& kernel)
   }
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType, Topology TOPO>
+inline void for_all_colored_cells_impl(xargs::index,
+                                       const UnstructuredMesh<TOPO>& m,
+                                       KernelType&& kernel)
+{
+  SLIC_ERROR_IF(!m.hasCellColoring(),
+                "No cell coloring.\n\tPerhaps you meant to call "
+                "UnstructuredMesh::initializeCellColoring first?");
+
+  const IndexType numColors = m.getNumberOfCellColors();
+  const IndexType* colored_cells = m.getColoredCellsArray();
+  const IndexType* color_offsets = m.getCellColorOffsetsArray();
+
+  // cells of the same color share no node, so each color is traversed in
+  // parallel, while the colors themselves are traversed one after another
+  for(IndexType color = 0; color < numColors; ++color)
+  {
+    const IndexType* cells = colored_cells + color_offsets[color];
+    const IndexType numCells = color_offsets[color + 1] - color_offsets[color];
+
+    axom::for_all<ExecPolicy>(
+      numCells,
+      AXOM_LAMBDA(IndexType idx) { kernel(cells[idx]); });
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_colored_cells_impl(xargs::nodeids,
+                                       const UnstructuredMesh<MIXED_SHAPE>& m,
+                                       KernelType&& kernel)
+{
+  const IndexType* cell_connectivity = m.getCellNodesArray();
+  const IndexType* cell_offsets = m.getCellNodesOffsetsArray();
+
+  for_all_colored_cells_impl<ExecPolicy>(
+    xargs::index(),
+    m,
+    AXOM_LAMBDA(IndexType cellID) {
+      const IndexType N = cell_offsets[cellID + 1] - cell_offsets[cellID];
+      kernel(cellID, &cell_connectivity[cell_offsets[cellID]], N);
+    });
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_colored_cells_impl(xargs::nodeids,
+                                       const UnstructuredMesh<SINGLE_SHAPE>& m,
+                                       KernelType&& kernel)
+{
+  const IndexType* cell_connectivity = m.getCellNodesArray();
+  const IndexType stride = m.getNumberOfCellNodes();
+
+  for_all_colored_cells_impl<ExecPolicy>(
+    xargs::index(),
+    m,
+    AXOM_LAMBDA(IndexType cellID) {
+      kernel(cellID, &cell_connectivity[cellID * stride], stride);
+    });
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename ArgType, typename KernelType>
+inline void for_all_colored_cells(ArgType, const Mesh& m, KernelType&& kernel)
+{
+  SLIC_ERROR_IF(m.getMeshType() != UNSTRUCTURED_MESH,
+                "Colored cell traversals require an UnstructuredMesh");
+
+  if(m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE>&>(m);
+    for_all_colored_cells_impl<ExecPolicy>(ArgType(),
+                                           um,
+                                           std::forward<KernelType>(kernel));
+  }
+  else
+  {
+    const UnstructuredMesh<SINGLE_SHAPE>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE>&>(m);
+    for_all_colored_cells_impl<ExecPolicy>(ArgType(),
+                                           um,
+                                           std::forward<KernelType>(kernel));
+  }
+}
+
 } /* namespace internal */
 } /* namespace mint     */
 } /* namespace axom     */
@@ -12,12 +12,13 @@
 #include "axom/core/execution/for_all.hpp"          // for axom::for_all
 
 // mint includes
-#include "axom/mint/execution/xargs.hpp"       // for xargs
-#include "axom/mint/config.hpp"                // for compile-time definitions
-#include "axom/mint/mesh/Mesh.hpp"             // for mint::Mesh
-#include "axom/mint/mesh/RectilinearMesh.hpp"  // for mint::RectilinearMesh
-#include "axom/mint/mesh/StructuredMesh.hpp"   // for mint::StructuredMesh
-#include "axom/mint/mesh/UniformMesh.hpp"      // for mint::UniformMesh
+#include "axom/mint/execution/xargs.hpp"        // for xargs
+#include "axom/mint/config.hpp"                 // for compile-time definitions
+#include "axom/mint/mesh/Mesh.hpp"              // for mint::Mesh
+#include "axom/mint/mesh/RectilinearMesh.hpp"   // for mint::RectilinearMesh
+#include "axom/mint/mesh/StructuredMesh.hpp"    // for mint::StructuredMesh
+#include "axom/mint/mesh/UniformMesh.hpp"       // for mint::UniformMesh
+#include "axom/mint/mesh/UnstructuredMesh.hpp"  // for mint::UnstructuredMesh
 #include "axom/mint/execution/internal/structured_exec.hpp"
 
 #include "axom/core/StackArray.hpp"  // for axom::StackArray
@@ -61,34 +62,13 @@ inline void for_all_nodes_impl(xargs::ij,
   const IndexType Ni = m.getNodeResolution(I_DIRECTION);
   const IndexType Nj = m.getNodeResolution(J_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range),
+  structured_loop2d<ExecPolicy>(
+    Ni,
+    Nj,
     AXOM_LAMBDA(IndexType i, IndexType j) {
       const IndexType nodeIdx = i + j * jp;
       kernel(nodeIdx, i, j);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType j = 0; j < Nj; ++j)
-  {
-    const IndexType j_offset = j * jp;
-    for(IndexType i = 0; i < Ni; ++i)
-    {
-      const IndexType nodeIdx = i + j_offset;
-      kernel(nodeIdx, i, j);
-    }  // END for all i
-  }    // END for all j
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -121,40 +101,14 @@ inline void for_all_nodes_impl(xargs::ijk,
   const IndexType Nj = m.getNodeResolution(J_DIRECTION);
   const IndexType Nk = m.getNodeResolution(K_DIRECTION);
 
-#ifdef AXOM_USE_RAJA
-
-  RAJA::RangeSegment i_range(0, Ni);
-  RAJA::RangeSegment j_range(0, Nj);
-  RAJA::RangeSegment k_range(0, Nk);
-  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
-
-  RAJA::kernel<exec_pol>(
-    RAJA::make_tuple(i_range, j_range, k_range),
+  structured_loop3d<ExecPolicy>(
+    Ni,
+    Nj,
+    Nk,
     AXOM_LAMBDA(IndexType i, IndexType j, IndexType k) {
       const IndexType nodeIdx = i + j * jp + k * kp;
       kernel(nodeIdx, i, j, k);
     });
-
-#else
-
-  constexpr bool is_serial = std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
-  AXOM_STATIC_ASSERT(is_serial);
-
-  for(IndexType k = 0; k < Nk; ++k)
-  {
-    const IndexType k_offset = k * kp;
-    for(IndexType j = 0; j < Nj; ++j)
-    {
-      const IndexType j_offset = j * jp;
-      for(IndexType i = 0; i < Ni; ++i)
-      {
-        const IndexType nodeIdx = i + j_offset + k_offset;
-        kernel(nodeIdx, i, j, k);
-      }  // END for all i
-    }    // END for all j
-  }      // END for all k
-
-#endif
 }
 
 //------------------------------------------------------------------------------
@@ -412,6 +366,100 @@ inline void for_all_nodes(xargs::xyz, const mint::Mesh& m, KernelType&& kernel)
   }
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_nodes_impl(xargs::cellids,
+                               const StructuredMesh& m,
+                               KernelType&& kernel)
+{
+  const int dimension = m.getDimension();
+  const IndexType nodeJp = m.nodeJp();
+  const IndexType nodeKp = m.nodeKp();
+  const IndexType cellJp = m.cellJp();
+  const IndexType cellKp = m.cellKp();
+
+  // the cells of a node are found from its IJK indices, with a single layer
+  // of cells along the directions that the mesh does not have
+  const IndexType Ni = m.getCellResolution(I_DIRECTION);
+  const IndexType Nj = (dimension > 1) ? m.getCellResolution(J_DIRECTION) : 1;
+  const IndexType Nk = (dimension > 2) ? m.getCellResolution(K_DIRECTION) : 1;
+
+  for_all_nodes_impl<ExecPolicy>(
+    xargs::index(),
+    m,
+    AXOM_LAMBDA(IndexType nodeID) {
+      const IndexType i = nodeID % nodeJp;
+      const IndexType j = (nodeID % nodeKp) / nodeJp;
+      const IndexType k = nodeID / nodeKp;
+
+      IndexType cells[8];
+      IndexType numCells = 0;
+      for(IndexType kk = (k > 0) ? k - 1 : k; kk <= k && kk < Nk; ++kk)
+      {
+        for(IndexType jj = (j > 0) ? j - 1 : j; jj <= j && jj < Nj; ++jj)
+        {
+          for(IndexType ii = (i > 0) ? i - 1 : i; ii <= i && ii < Ni; ++ii)
+          {
+            cells[numCells++] = ii + jj * cellJp + kk * cellKp;
+          }
+        }
+      }
+
+      kernel(nodeID, cells, numCells);
+    });
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType, Topology TOPO>
+inline void for_all_nodes_impl(xargs::cellids,
+                               const UnstructuredMesh<TOPO>& m,
+                               KernelType&& kernel)
+{
+  SLIC_ERROR_IF(!m.hasNodeCellConnectivity(),
+                "No node-to-cell connectivity.\n\tPerhaps you meant to call "
+                "UnstructuredMesh::initializeNodeCellConnectivity first?");
+
+  const IndexType* node_cells = m.getNodeCellsArray();
+  const IndexType* offsets = m.getNodeCellsOffsetsArray();
+
+  for_all_nodes_impl<ExecPolicy>(
+    xargs::index(),
+    m,
+    AXOM_LAMBDA(IndexType nodeID) {
+      const IndexType numCells = offsets[nodeID + 1] - offsets[nodeID];
+      kernel(nodeID, &node_cells[offsets[nodeID]], numCells);
+    });
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename KernelType>
+inline void for_all_nodes(xargs::cellids, const Mesh& m, KernelType&& kernel)
+{
+  if(m.isStructured())
+  {
+    const StructuredMesh& sm = static_cast<const StructuredMesh&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   sm,
+                                   std::forward<KernelType>(kernel));
+  }
+  else if(m.hasMixedCellTypes())
+  {
+    const UnstructuredMesh<MIXED_SHAPE>& um =
+      static_cast<const UnstructuredMesh<MIXED_SHAPE>&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+  else
+  {
+    const UnstructuredMesh<SINGLE_SHAPE>& um =
+      static_cast<const UnstructuredMesh<SINGLE_SHAPE>&>(m);
+    for_all_nodes_impl<ExecPolicy>(xargs::cellids(),
+                                   um,
+                                   std::forward<KernelType>(kernel));
+  }
+}
+
 } /* namespace internal */
 } /* namespace mint     */
 } /* namespace axom     */
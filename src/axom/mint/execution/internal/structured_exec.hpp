@@ -6,7 +6,14 @@
 #ifndef AXOM_MINT_STRUCTURED_EXEC_HPP_
 #define AXOM_MINT_STRUCTURED_EXEC_HPP_
 
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
 #include "axom/core/execution/execution_space.hpp"
+#include "axom/mint/execution/tiled_exec.hpp"
+
+#include <algorithm>    // for std::min
+#include <type_traits>  // for std::is_same
+#include <utility>      // for std::forward
 
 // RAJA includes
 #ifdef AXOM_USE_RAJA
@@ -283,6 +290,240 @@ struct structured_exec<HIP_EXEC<BLOCK_SIZE, ASYNC>>
 
 #endif
 
+//-------------------------------------------------------| TILED_EXEC |---------
+
+/*!
+ * \brief By default, TILED_EXEC uses the structured policies of the
+ *  underlying execution space, e.g., on the device, which has its own tiling.
+ */
+template <typename ExecSpace, int TILE_I, int TILE_J, int TILE_K>
+struct structured_exec<TILED_EXEC<ExecSpace, TILE_I, TILE_J, TILE_K>>
+  : structured_exec<ExecSpace>
+{ };
+
+template <int TILE_I, int TILE_J, int TILE_K>
+struct structured_exec<TILED_EXEC<SEQ_EXEC, TILE_I, TILE_J, TILE_K>>
+{
+#ifdef AXOM_USE_RAJA
+  /* clang-format off */
+  using loop2d_policy = RAJA::KernelPolicy<
+    RAJA::statement::Tile< 1, RAJA::tile_fixed< TILE_J >, RAJA::loop_exec,     // tile j
+      RAJA::statement::Tile< 0, RAJA::tile_fixed< TILE_I >, RAJA::loop_exec,   // tile i
+        RAJA::statement::For< 1, RAJA::loop_exec,                              // j
+          RAJA::statement::For< 0, RAJA::loop_exec,                            // i
+            RAJA::statement::Lambda< 0 >
+          > // END i
+        > // END j
+      > // END tile i
+    > // END tile j
+  >; // END kernel
+
+  using loop3d_policy = RAJA::KernelPolicy<
+    RAJA::statement::Tile< 2, RAJA::tile_fixed< TILE_K >, RAJA::loop_exec,       // tile k
+      RAJA::statement::Tile< 1, RAJA::tile_fixed< TILE_J >, RAJA::loop_exec,     // tile j
+        RAJA::statement::Tile< 0, RAJA::tile_fixed< TILE_I >, RAJA::loop_exec,   // tile i
+          RAJA::statement::For< 2, RAJA::loop_exec,                              // k
+            RAJA::statement::For< 1, RAJA::loop_exec,                            // j
+              RAJA::statement::For< 0, RAJA::loop_exec,                          // i
+                RAJA::statement::Lambda< 0 >
+              > // END i
+            > // END j
+          > // END k
+        > // END tile i
+      > // END tile j
+    > // END tile k
+  >; // END kernel
+  /* clang-format on */
+
+#else
+  using loop2d_policy = void;
+  using loop3d_policy = void;
+#endif
+};
+
+#if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
+template <int TILE_I, int TILE_J, int TILE_K>
+struct structured_exec<TILED_EXEC<OMP_EXEC, TILE_I, TILE_J, TILE_K>>
+{
+  /* clang-format off */
+
+  // the threads split the tiles, and sweep each tile serially
+  using loop2d_policy = RAJA::KernelPolicy<
+    RAJA::statement::Tile< 1, RAJA::tile_fixed< TILE_J >, RAJA::omp_parallel_for_exec, // tile j
+      RAJA::statement::Tile< 0, RAJA::tile_fixed< TILE_I >, RAJA::loop_exec,           // tile i
+        RAJA::statement::For< 1, RAJA::loop_exec,                                      // j
+          RAJA::statement::For< 0, RAJA::loop_exec,                                    // i
+            RAJA::statement::Lambda< 0 >
+          > // END i
+        > // END j
+      > // END tile i
+    > // END tile j
+  >; // END kernel
+
+  using loop3d_policy = RAJA::KernelPolicy<
+    RAJA::statement::Tile< 2, RAJA::tile_fixed< TILE_K >, RAJA::omp_parallel_for_exec, // tile k
+      RAJA::statement::Tile< 1, RAJA::tile_fixed< TILE_J >, RAJA::loop_exec,           // tile j
+        RAJA::statement::Tile< 0, RAJA::tile_fixed< TILE_I >, RAJA::loop_exec,         // tile i
+          RAJA::statement::For< 2, RAJA::loop_exec,                                    // k
+            RAJA::statement::For< 1, RAJA::loop_exec,                                  // j
+              RAJA::statement::For< 0, RAJA::loop_exec,                                // i
+                RAJA::statement::Lambda< 0 >
+              > // END i
+            > // END j
+          > // END k
+        > // END tile i
+      > // END tile j
+    > // END tile k
+  >; // END kernel
+
+  /* clang-format on */
+};
+#endif
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Traits class for the tiles of the serial structured loops that are
+ *  used when Axom is built without RAJA.
+ *
+ *  A tile size of zero indicates that the corresponding direction is not
+ *  tiled.
+ */
+template <typename ExecPolicy>
+struct structured_tiles
+{
+  static constexpr bool is_serial =
+    std::is_same<ExecPolicy, axom::SEQ_EXEC>::value;
+
+  static constexpr IndexType I = 0;
+  static constexpr IndexType J = 0;
+  static constexpr IndexType K = 0;
+};
+
+template <typename ExecSpace, int TILE_I, int TILE_J, int TILE_K>
+struct structured_tiles<TILED_EXEC<ExecSpace, TILE_I, TILE_J, TILE_K>>
+{
+  static constexpr bool is_serial = structured_tiles<ExecSpace>::is_serial;
+
+  static constexpr IndexType I = TILE_I;
+  static constexpr IndexType J = TILE_J;
+  static constexpr IndexType K = TILE_K;
+};
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Loops over the IJ index space [0,Ni) x [0,Nj) with the 2D
+ *  structured policy of the given execution policy.
+ *
+ * \param [in] Ni the number of indices along the I direction
+ * \param [in] Nj the number of indices along the J direction
+ * \param [in] kernel the kernel, which takes the IJ indices
+ */
+template <typename ExecPolicy, typename KernelType>
+inline void structured_loop2d(IndexType Ni, IndexType Nj, KernelType&& kernel)
+{
+#ifdef AXOM_USE_RAJA
+
+  RAJA::RangeSegment i_range(0, Ni);
+  RAJA::RangeSegment j_range(0, Nj);
+  using exec_pol = typename structured_exec<ExecPolicy>::loop2d_policy;
+
+  RAJA::kernel<exec_pol>(RAJA::make_tuple(i_range, j_range),
+                         std::forward<KernelType>(kernel));
+
+#else
+
+  using tiles = structured_tiles<ExecPolicy>;
+  AXOM_STATIC_ASSERT(tiles::is_serial);
+
+  constexpr IndexType TILE_I = tiles::I;
+  constexpr IndexType TILE_J = tiles::J;
+
+  const IndexType tile_i = (TILE_I > 0) ? TILE_I : Ni;
+  const IndexType tile_j = (TILE_J > 0) ? TILE_J : Nj;
+
+  for(IndexType jt = 0; jt < Nj; jt += tile_j)
+  {
+    const IndexType j_end = std::min(jt + tile_j, Nj);
+    for(IndexType it = 0; it < Ni; it += tile_i)
+    {
+      const IndexType i_end = std::min(it + tile_i, Ni);
+      for(IndexType j = jt; j < j_end; ++j)
+      {
+        for(IndexType i = it; i < i_end; ++i)
+        {
+          kernel(i, j);
+        }  // END for all i
+      }    // END for all j
+    }      // END for all i tiles
+  }        // END for all j tiles
+
+#endif
+}
+
+/*!
+ * \brief Loops over the IJK index space [0,Ni) x [0,Nj) x [0,Nk) with the 3D
+ *  structured policy of the given execution policy.
+ *
+ * \param [in] Ni the number of indices along the I direction
+ * \param [in] Nj the number of indices along the J direction
+ * \param [in] Nk the number of indices along the K direction
+ * \param [in] kernel the kernel, which takes the IJK indices
+ */
+template <typename ExecPolicy, typename KernelType>
+inline void structured_loop3d(IndexType Ni,
+                              IndexType Nj,
+                              IndexType Nk,
+                              KernelType&& kernel)
+{
+#ifdef AXOM_USE_RAJA
+
+  RAJA::RangeSegment i_range(0, Ni);
+  RAJA::RangeSegment j_range(0, Nj);
+  RAJA::RangeSegment k_range(0, Nk);
+  using exec_pol = typename structured_exec<ExecPolicy>::loop3d_policy;
+
+  RAJA::kernel<exec_pol>(RAJA::make_tuple(i_range, j_range, k_range),
+                         std::forward<KernelType>(kernel));
+
+#else
+
+  using tiles = structured_tiles<ExecPolicy>;
+  AXOM_STATIC_ASSERT(tiles::is_serial);
+
+  constexpr IndexType TILE_I = tiles::I;
+  constexpr IndexType TILE_J = tiles::J;
+  constexpr IndexType TILE_K = tiles::K;
+
+  const IndexType tile_i = (TILE_I > 0) ? TILE_I : Ni;
+  const IndexType tile_j = (TILE_J > 0) ? TILE_J : Nj;
+  const IndexType tile_k = (TILE_K > 0) ? TILE_K : Nk;
+
+  for(IndexType kt = 0; kt < Nk; kt += tile_k)
+  {
+    const IndexType k_end = std::min(kt + tile_k, Nk);
+    for(IndexType jt = 0; jt < Nj; jt += tile_j)
+    {
+      const IndexType j_end = std::min(jt + tile_j, Nj);
+      for(IndexType it = 0; it < Ni; it += tile_i)
+      {
+        const IndexType i_end = std::min(it + tile_i, Ni);
+        for(IndexType k = kt; k < k_end; ++k)
+        {
+          for(IndexType j = jt; j < j_end; ++j)
+          {
+            for(IndexType i = it; i < i_end; ++i)
+            {
+              kernel(i, j, k);
+            }  // END for all i
+          }    // END for all j
+        }      // END for all k
+      }        // END for all i tiles
+    }          // END for all j tiles
+  }            // END for all k tiles
+
+#endif
+}
+
 } /* namespace internal */
 
 } /* namespace mint */
@@ -0,0 +1,83 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef MINT_TILED_EXEC_HPP_
+#define MINT_TILED_EXEC_HPP_
+
+#include "axom/core/Macros.hpp"                     // for AXOM_STATIC_ASSERT
+#include "axom/core/execution/execution_space.hpp"  // for execution_space
+
+/*!
+ * \file
+ *
+ * \brief Defines the TILED_EXEC execution policy, which traverses the IJK
+ *  index space of a structured mesh in cache-sized tiles.
+ *
+ *  \see interface.hpp
+ */
+
+namespace axom
+{
+namespace mint
+{
+/*!
+ * \brief Indicates that structured mesh traversals with the given execution
+ *  space visit the IJK index space one tile of TILE_I x TILE_J x TILE_K
+ *  entities at a time.
+ *
+ *  Stencil sweeps over large 3D meshes touch neighbors that are a whole
+ *  I-J plane apart in memory. Traversing the mesh by tiles keeps the planes
+ *  of a tile in cache while it is being swept, at the cost of shorter
+ *  innermost loops. The best tile sizes depend on the machine and on the
+ *  kernel, hence are template arguments.
+ *
+ * \tparam ExecSpace the underlying execution space, e.g., axom::SEQ_EXEC
+ * \tparam TILE_I the tile size along the I direction
+ * \tparam TILE_J the tile size along the J direction
+ * \tparam TILE_K the tile size along the K direction, ignored in 2D
+ *
+ * \note The tile sizes apply to the IJ and IJK traversals of structured
+ *  meshes, i.e., with xargs::ij, xargs::ijk and xargs::stencil, on the host.
+ *  Device execution spaces already traverse structured meshes by thread
+ *  blocks and use their own tiling. Other traversals run with ExecSpace.
+ *
+ * Usage Example:
+ * \code
+ *
+ *  using tiled_exec = mint::TILED_EXEC< axom::OMP_EXEC, 64, 8, 8 >;
+ *  mint::for_all_cells< tiled_exec, xargs::ijk >( m,
+ *    AXOM_LAMBDA( IndexType cellID, IndexType i, IndexType j, IndexType k )
+ *    { ... }
+ *  );
+ *
+ * \endcode
+ */
+template <typename ExecSpace, int TILE_I = 64, int TILE_J = 8, int TILE_K = 8>
+struct TILED_EXEC
+{
+  AXOM_STATIC_ASSERT_MSG(TILE_I > 0 && TILE_J > 0 && TILE_K > 0,
+                         "tile sizes must be positive");
+
+  using exec_space = ExecSpace;
+
+  static constexpr int tile_i = TILE_I;
+  static constexpr int tile_j = TILE_J;
+  static constexpr int tile_k = TILE_K;
+};
+
+}  // namespace mint
+
+/*!
+ * \brief execution_space traits specialization for TILED_EXEC, which
+ *  inherits the policies and memory space of the underlying execution space.
+ */
+template <typename ExecSpace, int TILE_I, int TILE_J, int TILE_K>
+struct execution_space<mint::TILED_EXEC<ExecSpace, TILE_I, TILE_J, TILE_K>>
+  : execution_space<ExecSpace>
+{ };
+
+}  // namespace axom
+
+#endif /* MINT_TILED_EXEC_HPP_ */
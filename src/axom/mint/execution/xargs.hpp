@@ -17,6 +17,8 @@
  *  \see interface.hpp
  */
 
+#include "axom/core/Macros.hpp"  // for AXOM_HOST_DEVICE
+
 namespace axom
 {
 namespace mint
@@ -114,11 +116,44 @@ struct faceids
  *  connectivity information, i.e., the two cell IDs of the face in addition to
  *  the associated face index. 
  *
- * \note This option can be used for face mesh traversals with any mesh.
+ *  For node traversals, the lambda expression instead takes a pointer to the
+ *  IDs of the cells incident on the node and their number.
+ *
+ * \note This option can be used for face mesh traversals with any mesh, and
+ *  for node mesh traversals with any mesh. Unstructured meshes must first
+ *  initialize their node-to-cell connectivity.
  */
 struct cellids
 { };
 
+/*!
+ * \brief Indicates that the lambda expression also takes the IDs of the cells
+ *  in the 3x3 (2D) or 3x3x3 (3D) block of cells around the cell, and their
+ *  number, in addition to the associated cell index.
+ *
+ *  The neighbor at offset (di, dj, dk), where each offset is -1, 0 or 1, is
+ *  at position() in the block, and the cell itself is at its center. The IDs
+ *  of neighbors outside of the mesh are set to -1, so kernels need not check
+ *  the IJK indices at the mesh boundary.
+ *
+ * \note This option can be used for cell mesh traversals with 2D and 3D
+ *  structured meshes.
+ */
+struct stencil
+{
+  /// Returns the position of the neighbor at offset (di, dj) in 2D
+  AXOM_HOST_DEVICE static constexpr int position(int di, int dj)
+  {
+    return (di + 1) + 3 * (dj + 1);
+  }
+
+  /// Returns the position of the neighbor at offset (di, dj, dk) in 3D
+  AXOM_HOST_DEVICE static constexpr int position(int di, int dj, int dk)
+  {
+    return (di + 1) + 3 * (dj + 1) + 9 * (dk + 1);
+  }
+};
+
 } /* namespace xargs */
 
 /*!
@@ -201,6 +236,13 @@ struct xargs_traits<xargs::cellids>
   static constexpr char* name() { return (char*)("xargs::cellids"); };
 };
 
+template <>
+struct xargs_traits<xargs::stencil>
+{
+  static constexpr bool valid() { return true; };
+  static constexpr char* name() { return (char*)("xargs::stencil"); };
+};
+
 } /* namespace mint */
 } /* namespace axom */
 
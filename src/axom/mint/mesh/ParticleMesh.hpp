@@ -7,12 +7,26 @@
 #define MINT_PARTICLEMESH_HPP_
 
 #include "axom/core/Macros.hpp"  // for axom macros
+#include "axom/core/Array.hpp"   // for axom::Array
+#include "axom/core/utilities/Utilities.hpp"        // for utilities::clampVal
+#include "axom/core/execution/execution_space.hpp"  // for execution spaces
+#include "axom/core/execution/for_all.hpp"          // for axom::for_all
 
 #include "axom/mint/config.hpp"     // for mint compile-time definitions
 #include "axom/mint/mesh/Mesh.hpp"  // for mint::Mesh base class
+#include "axom/mint/mesh/internal/MeshHelpers.hpp"  // for internal helpers
 
 #include "axom/slic/interface/slic.hpp"  // for slic Macros
 
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <algorithm>  // for std::stable_sort
+#include <limits>     // for std::numeric_limits
+#include <numeric>    // for std::iota
+
 namespace axom
 {
 // Sidre Forward Declarations
@@ -26,6 +40,18 @@ namespace mint
 // Mint Forward Declarations
 class MeshCoordinates;
 
+/*!
+ * \brief Enumerates the particle orderings of ParticleMesh::sort().
+ *
+ *  Both orderings bin the particles into the cells of a uniform background
+ *  grid and sort the particles by bin. They differ in the order of the bins.
+ */
+enum class ParticleOrdering
+{
+  GRID_CELL,  ///< bins in lexicographic order, with the i-index varying fastest
+  MORTON      ///< bins along a Morton (Z-order) space-filling curve
+};
+
 /*!
  * \class ParticleMesh
  *
@@ -501,6 +527,61 @@ public:
 
   /// @}
 
+  /// \name Sorting
+  /// @{
+
+  /*!
+   * \brief Reorders the particles by the cells of a background grid that
+   *  contain them, so that nearby particles are stored close in memory.
+   *
+   * \param [in] ordering the order of the grid cells.
+   * \param [in] lo the lower corner of the background grid.
+   * \param [in] hi the upper corner of the background grid.
+   * \param [in] resolution the number of grid cells along each dimension.
+   * \param [out] binOffsets the offsets of the particles of each grid cell
+   *  (optional). If supplied, the particles of the grid cell with sort key
+   *  b are the particles binOffsets[ b ] to binOffsets[ b + 1 ] - 1.
+   *
+   * The sort key of the grid cell (i,j,k) is i + j * N + k * N * N, where
+   * N is the resolution, with the GRID_CELL ordering, and its Morton index
+   * with the MORTON ordering. In the latter case, the resolution is rounded
+   * up to the next power of two. binOffsets thus has N^dim + 1 entries.
+   *
+   * The sort keys are computed and sorted in parallel, and the resulting
+   * permutation is applied to the particle positions and to all the
+   * node-centered fields. Particles within the same grid cell keep their
+   * relative order. Particles outside of the grid are binned to the nearest
+   * grid cell.
+   *
+   * When the bounds of the grid are not supplied, the background grid is
+   * the bounding box of the particles.
+   *
+   * \tparam ExecPolicy the execution policy, e.g., axom::SEQ_EXEC.
+   *
+   * \note The particle data must be accessible in the execution space.
+   *
+   * \pre resolution >= 1
+   * \pre lo != nullptr, hi != nullptr
+   * \post binOffsets->size() == N^dim + 1, if binOffsets != nullptr
+   */
+  /// @{
+
+  template <typename ExecPolicy = axom::SEQ_EXEC>
+  void sort(ParticleOrdering ordering,
+            const double* lo,
+            const double* hi,
+            IndexType resolution,
+            Array<IndexType>* binOffsets = nullptr);
+
+  template <typename ExecPolicy = axom::SEQ_EXEC>
+  void sort(ParticleOrdering ordering,
+            IndexType resolution,
+            Array<IndexType>* binOffsets = nullptr);
+
+  /// @}
+
+  /// @}
+
   /// @}
 
 private:
@@ -598,6 +679,195 @@ inline void ParticleMesh::shrink()
   m_mesh_fields[NODE_CENTERED]->shrink();
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy>
+inline void ParticleMesh::sort(ParticleOrdering ordering,
+                               const double* lo,
+                               const double* hi,
+                               IndexType resolution,
+                               Array<IndexType>* binOffsets)
+{
+  SLIC_ASSERT(m_positions != nullptr);
+  SLIC_ASSERT(lo != nullptr);
+  SLIC_ASSERT(hi != nullptr);
+  SLIC_ERROR_IF(resolution < 1,
+                "ParticleMesh::sort() requires a positive resolution");
+
+  const int ndims = m_ndims;
+  const IndexType numParticles = getNumberOfNodes();
+
+  // the Morton curve visits grids of a power of two cells along each dimension
+  int bits = 0;
+  if(ordering == ParticleOrdering::MORTON)
+  {
+    while((IndexType(1) << bits) < resolution)
+    {
+      ++bits;
+    }
+    resolution = IndexType(1) << bits;
+  }
+
+  IndexType numBins = 1;
+  for(int d = 0; d < ndims; ++d)
+  {
+    SLIC_ERROR_IF(numBins > std::numeric_limits<IndexType>::max() / resolution,
+                  "ParticleMesh::sort() grid resolution is too large");
+    numBins *= resolution;
+  }
+
+  // scale factors from positions to grid indices
+  double origin[3] = {0., 0., 0.};
+  double scale[3] = {0., 0., 0.};
+  for(int d = 0; d < ndims; ++d)
+  {
+    origin[d] = lo[d];
+    scale[d] = (hi[d] > lo[d]) ? resolution / (hi[d] - lo[d]) : 0.;
+  }
+
+  const double* x = getCoordinateArray(X_COORDINATE);
+  const double* y = (ndims > 1) ? getCoordinateArray(Y_COORDINATE) : nullptr;
+  const double* z = (ndims > 2) ? getCoordinateArray(Z_COORDINATE) : nullptr;
+
+  // compute the sort key of each particle
+  Array<IndexType> keys(numParticles);
+  Array<IndexType> perm(numParticles);
+  const auto keys_v = keys.view();
+  const auto perm_v = perm.view();
+
+  const bool morton = (ordering == ParticleOrdering::MORTON);
+  const double x0 = origin[0], y0 = origin[1], z0 = origin[2];
+  const double sx = scale[0], sy = scale[1], sz = scale[2];
+  const IndexType maxIndex = resolution - 1;
+
+  axom::for_all<ExecPolicy>(
+    numParticles,
+    AXOM_LAMBDA(IndexType i) {
+      IndexType ijk[3] = {0, 0, 0};
+      ijk[0] = static_cast<IndexType>((x[i] - x0) * sx);
+      ijk[1] = (y != nullptr) ? static_cast<IndexType>((y[i] - y0) * sy) : 0;
+      ijk[2] = (z != nullptr) ? static_cast<IndexType>((z[i] - z0) * sz) : 0;
+      for(int d = 0; d < 3; ++d)
+      {
+        ijk[d] = utilities::clampVal(ijk[d], IndexType(0), maxIndex);
+      }
+
+      keys_v[i] = morton
+        ? internal::mortonIndex(ijk, ndims, bits)
+        : ijk[0] + resolution * (ijk[1] + resolution * ijk[2]);
+      perm_v[i] = i;
+    });
+
+  // sort by key, keeping the particles of each bin in their original order
+#ifdef AXOM_USE_RAJA
+  using loop_pol = typename axom::execution_space<ExecPolicy>::loop_policy;
+  RAJA::stable_sort_pairs<loop_pol>(RAJA::make_span(keys.data(), numParticles),
+                                    RAJA::make_span(perm.data(), numParticles));
+#else
+  std::stable_sort(perm.begin(), perm.end(), [=](IndexType i1, IndexType i2) {
+    return keys_v[i1] < keys_v[i2];
+  });
+  internal::permuteTuples<ExecPolicy>(numParticles, 1, perm.data(), keys.data());
+#endif
+
+  // apply the permutation to the particle positions and fields
+  for(int d = 0; d < ndims; ++d)
+  {
+    internal::permuteTuples<ExecPolicy>(numParticles,
+                                        1,
+                                        perm.data(),
+                                        getCoordinateArray(d));
+  }
+
+  FieldData* fields = m_mesh_fields[NODE_CENTERED];
+  for(int i = 0; i < fields->getNumFields(); ++i)
+  {
+    Field* field = fields->getField(i);
+    const IndexType numComponents = field->getNumComponents();
+    const IndexType* p = perm.data();
+
+    switch(field->getType())
+    {
+    case FLOAT_FIELD_TYPE:
+      internal::permuteTuples<ExecPolicy>(numParticles,
+                                          numComponents,
+                                          p,
+                                          Field::getDataPtr<float>(field));
+      break;
+    case DOUBLE_FIELD_TYPE:
+      internal::permuteTuples<ExecPolicy>(numParticles,
+                                          numComponents,
+                                          p,
+                                          Field::getDataPtr<double>(field));
+      break;
+    case INT32_FIELD_TYPE:
+      internal::permuteTuples<ExecPolicy>(numParticles,
+                                          numComponents,
+                                          p,
+                                          Field::getDataPtr<int32>(field));
+      break;
+    case INT64_FIELD_TYPE:
+      internal::permuteTuples<ExecPolicy>(numParticles,
+                                          numComponents,
+                                          p,
+                                          Field::getDataPtr<int64>(field));
+      break;
+    default:
+      SLIC_ERROR("Field [" << field->getName() << "] has an unsupported type");
+    }  // END switch
+  }
+
+  if(binOffsets != nullptr)
+  {
+    internal::initSortedOffsets<ExecPolicy>(numParticles,
+                                            keys.data(),
+                                            numBins,
+                                            *binOffsets);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy>
+inline void ParticleMesh::sort(ParticleOrdering ordering,
+                               IndexType resolution,
+                               Array<IndexType>* binOffsets)
+{
+  SLIC_ASSERT(m_positions != nullptr);
+
+  const IndexType numParticles = getNumberOfNodes();
+
+  // find the bounding box of the particles
+  double lo[3] = {0., 0., 0.};
+  double hi[3] = {0., 0., 0.};
+  for(int d = 0; d < m_ndims && numParticles > 0; ++d)
+  {
+    const double* x = getCoordinateArray(d);
+#ifdef AXOM_USE_RAJA
+    using reduce_pol = typename axom::execution_space<ExecPolicy>::reduce_policy;
+    RAJA::ReduceMin<reduce_pol, double> xmin(std::numeric_limits<double>::max());
+    RAJA::ReduceMax<reduce_pol, double> xmax(
+      std::numeric_limits<double>::lowest());
+    axom::for_all<ExecPolicy>(
+      numParticles,
+      AXOM_LAMBDA(IndexType i) {
+        xmin.min(x[i]);
+        xmax.max(x[i]);
+      });
+    lo[d] = xmin.get();
+    hi[d] = xmax.get();
+#else
+    lo[d] = std::numeric_limits<double>::max();
+    hi[d] = std::numeric_limits<double>::lowest();
+    for(IndexType i = 0; i < numParticles; ++i)
+    {
+      lo[d] = utilities::min(lo[d], x[i]);
+      hi[d] = utilities::max(hi[d], x[i]);
+    }
+#endif
+  }
+
+  sort<ExecPolicy>(ordering, lo, hi, resolution, binOffsets);
+}
+
 } /* namespace mint */
 } /* namespace axom */
 
@@ -1879,6 +1879,174 @@ public:
 
   /// @}
 
+  /// \name Node-Cell Connectivity
+  /// @{
+
+  /*!
+   * \brief Sets up the node-to-cell connectivity, i.e., the cells incident
+   *  on each node, in increasing order.
+   *
+   * \param [in] force re-initialize the node-to-cell connectivity, even if
+   *             it has already been done, e.g., after cells were appended.
+   *
+   * \tparam ExecPolicy the execution policy used to build the relation.
+   *
+   * \see internal::initNodeCells()
+   */
+  template <typename ExecPolicy = axom::SEQ_EXEC>
+  bool initializeNodeCellConnectivity(bool force = false)
+  {
+    if(!force && hasNodeCellConnectivity())
+    {
+      return true;
+    }
+
+    internal::initNodeCells<ExecPolicy>(getNumberOfCells(),
+                                        getNumberOfNodes(),
+                                        getCellNodesArray(),
+                                        getCellNodesOffsetsArray(),
+                                        getCellNodesStride(),
+                                        m_nodeCellData.n2c,
+                                        m_nodeCellData.n2coff);
+    return true;
+  }
+
+  /*!
+   * \brief Returns true iff the node-to-cell connectivity was initialized.
+   */
+  bool hasNodeCellConnectivity() const
+  {
+    return !m_nodeCellData.n2coff.empty();
+  }
+
+  /*!
+   * \brief Return the number of cells incident on the given node.
+   *
+   * \param [in] nodeID the ID of the node in question.
+   *
+   * \note Codes must call initializeNodeCellConnectivity() before calling
+   *       this method.
+   *
+   * \pre 0 <= nodeID < getNumberOfNodes()
+   */
+  IndexType getNumberOfNodeCells(IndexType nodeID) const
+  {
+    SLIC_ASSERT(hasNodeCellConnectivity());
+    SLIC_ASSERT(0 <= nodeID && nodeID < getNumberOfNodes());
+    return m_nodeCellData.n2coff[nodeID + 1] - m_nodeCellData.n2coff[nodeID];
+  }
+
+  /*!
+   * \brief Return a pointer to the cells incident on the given node. The
+   *  buffer is guaranteed to be of length at least
+   *  getNumberOfNodeCells( nodeID ).
+   *
+   * \param [in] nodeID the ID of the node in question.
+   *
+   * \note Codes must call initializeNodeCellConnectivity() before calling
+   *       this method.
+   *
+   * \pre 0 <= nodeID < getNumberOfNodes()
+   */
+  const IndexType* getNodeCellIDs(IndexType nodeID) const
+  {
+    SLIC_ASSERT(hasNodeCellConnectivity());
+    SLIC_ASSERT(0 <= nodeID && nodeID < getNumberOfNodes());
+    return m_nodeCellData.n2c.data() + m_nodeCellData.n2coff[nodeID];
+  }
+
+  /*!
+   * \brief Return a pointer to the node cells array, of length
+   *  getNodeCellsOffsetsArray()[ getNumberOfNodes() ].
+   */
+  const IndexType* getNodeCellsArray() const
+  {
+    return m_nodeCellData.n2c.data();
+  }
+
+  /*!
+   * \brief Return a pointer to the node cells offset array, of length
+   *  getNumberOfNodes() + 1.
+   */
+  const IndexType* getNodeCellsOffsetsArray() const
+  {
+    return m_nodeCellData.n2coff.data();
+  }
+
+  /// @}
+
+  /// \name Cell Coloring
+  /// @{
+
+  /*!
+   * \brief Computes a coloring of the cells, such that no two cells of the
+   *  same color share a node.
+   *
+   *  Cells of the same color can thus scatter contributions to their nodes
+   *  concurrently without atomics, see mint::for_all_colored_cells(). The
+   *  coloring is computed once and cached on the mesh, and initializes the
+   *  node-to-cell connectivity if needed.
+   *
+   * \param [in] force re-compute the coloring, even if it has already been
+   *             done, e.g., after cells were appended.
+   *
+   * \see internal::initCellColors()
+   */
+  bool initializeCellColoring(bool force = false)
+  {
+    if(!force && hasCellColoring())
+    {
+      return true;
+    }
+
+    initializeNodeCellConnectivity(force);
+    internal::initCellColors(getNumberOfCells(),
+                             getCellNodesArray(),
+                             getCellNodesOffsetsArray(),
+                             getCellNodesStride(),
+                             getNodeCellsArray(),
+                             getNodeCellsOffsetsArray(),
+                             m_nodeCellData.colorCells,
+                             m_nodeCellData.colorOff);
+    return true;
+  }
+
+  /*!
+   * \brief Returns true iff the cell coloring was computed.
+   */
+  bool hasCellColoring() const { return !m_nodeCellData.colorOff.empty(); }
+
+  /*!
+   * \brief Return the number of cell colors.
+   *
+   * \note Codes must call initializeCellColoring() before calling
+   *       this method.
+   */
+  IndexType getNumberOfCellColors() const
+  {
+    return hasCellColoring() ? m_nodeCellData.colorOff.size() - 1 : 0;
+  }
+
+  /*!
+   * \brief Return a pointer to the colored cells array, of length
+   *  getNumberOfCells(), which holds the cells of each color contiguously.
+   */
+  const IndexType* getColoredCellsArray() const
+  {
+    return m_nodeCellData.colorCells.data();
+  }
+
+  /*!
+   * \brief Return a pointer to the cell color offset array, of length
+   *  getNumberOfCellColors() + 1.
+   */
+  const IndexType* getCellColorOffsetsArray() const
+  {
+    return m_nodeCellData.colorOff.data();
+  }
+
+  /// @}
+
 private:
   /*! \brief Construct and fill the cell-to-face connectivity. */
   void buildCellFaceConnectivity(IndexType* c2fdata, IndexType* c2foffsets);
@@ -1937,6 +2105,12 @@ private:
   }
 
   void updateNodes() { m_nodes = NodeSet(m_coordinates->numNodes()); }
+
+  /*! \brief Returns the number of nodes per cell, or zero if mixed. */
+  IndexType getCellNodesStride() const
+  {
+    return (TOPO == SINGLE_SHAPE) ? getNumberOfCellNodes() : 0;
+  }
   void updateCellRelations();
   void updateFaceRelations(IndexType numFaces);
 
@@ -1969,6 +2143,16 @@ private:
 
   FaceBackingBuffer m_faceData;
 
+  struct NodeCellBackingBuffer
+  {
+    axom::Array<IndexType> n2c;
+    axom::Array<IndexType> n2coff;
+    axom::Array<IndexType> colorCells;
+    axom::Array<IndexType> colorOff;
+  };
+
+  NodeCellBackingBuffer m_nodeCellData;
+
   /*! \brief The nodes for each cell */
   CellToNodeConnectivity* m_cell_to_node;
 
@@ -250,6 +250,76 @@ bool initFaces(Mesh* mesh,
   return success;
 }
 
+IndexType initCellColors(IndexType numCells,
+                         const IndexType* c2n,
+                         const IndexType* c2noffsets,
+                         IndexType c2nstride,
+                         const IndexType* n2c,
+                         const IndexType* n2coffsets,
+                         Array<IndexType>& coloredCells,
+                         Array<IndexType>& colorOffsets)
+{
+  // Step 1. Greedily color the cells in order.  A color is forbidden for
+  // the current cell if it was marked with the current cellID while visiting
+  // the cells that share a node with it.
+  std::vector<IndexType> colors(numCells, -1);
+  std::vector<IndexType> forbidden;
+  IndexType numColors = 0;
+  for(IndexType cellID = 0; cellID < numCells; ++cellID)
+  {
+    const IndexType begin =
+      (c2noffsets != nullptr) ? c2noffsets[cellID] : cellID * c2nstride;
+    const IndexType end =
+      (c2noffsets != nullptr) ? c2noffsets[cellID + 1] : begin + c2nstride;
+    for(IndexType i = begin; i < end; ++i)
+    {
+      const IndexType nodeID = c2n[i];
+      for(IndexType j = n2coffsets[nodeID]; j < n2coffsets[nodeID + 1]; ++j)
+      {
+        const IndexType neighborColor = colors[n2c[j]];
+        if(neighborColor >= 0)
+        {
+          forbidden[neighborColor] = cellID;
+        }
+      }
+    }
+
+    IndexType color = 0;
+    while(color < numColors && forbidden[color] == cellID)
+    {
+      ++color;
+    }
+    if(color == numColors)
+    {
+      ++numColors;
+      forbidden.push_back(-1);
+    }
+    colors[cellID] = color;
+  }
+
+  // Step 2. Bucket the cells by color, keeping them in increasing order.
+  colorOffsets.resize(numColors + 1);
+  colorOffsets.fill(0);
+  for(IndexType cellID = 0; cellID < numCells; ++cellID)
+  {
+    colorOffsets[colors[cellID] + 1] += 1;
+  }
+  for(IndexType color = 0; color < numColors; ++color)
+  {
+    colorOffsets[color + 1] += colorOffsets[color];
+  }
+
+  coloredCells.resize(numCells);
+  std::vector<IndexType> position(colorOffsets.begin(),
+                                  colorOffsets.end() - 1);
+  for(IndexType cellID = 0; cellID < numCells; ++cellID)
+  {
+    coloredCells[position[colors[cellID]]++] = cellID;
+  }
+
+  return numColors;
+}
+
 } /* namespace internal */
 } /* namespace mint */
 } /* namespace axom */
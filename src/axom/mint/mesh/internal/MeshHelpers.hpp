@@ -8,10 +8,19 @@
 #include "axom/core/Macros.hpp"  // for AXOM_UNUSED_PARAM
 #include "axom/core/Types.hpp"   // for nullptr
 #include "axom/core/Array.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
 #include "axom/mint/config.hpp"          // for mint compile-time type
 #include "axom/mint/mesh/CellTypes.hpp"  // for CellType
 
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+#include <algorithm>
+#include <numeric>
 #include <string>
+#include <vector>
 
 namespace axom
 {
@@ -74,6 +83,227 @@ bool initFaces(Mesh* m,
                Array<IndexType>& f2noffsets,
                Array<CellType>& f2ntypes);
 
+/*! \brief Find the offset of the first entry of each key in an array of
+ *         sorted keys.
+ *
+ * \param [in] numValues the number of sorted keys.
+ * \param [in] sortedKeys the keys, in [0, numKeys) and in increasing order.
+ * \param [in] numKeys the number of distinct key values.
+ * \param [out] offsets the position of the first entry of each key in
+ *              sortedKeys, of length numKeys + 1, with offsets[numKeys]
+ *              equal to numValues.
+ *
+ * The offsets are found in parallel over the keys, with a binary search in
+ * the sorted keys.
+ *
+ * \tparam ExecPolicy the execution policy, e.g., axom::SEQ_EXEC.
+ */
+template <typename ExecPolicy>
+void initSortedOffsets(IndexType numValues,
+                       const IndexType* sortedKeys,
+                       IndexType numKeys,
+                       Array<IndexType>& offsets)
+{
+  offsets.resize(numKeys + 1);
+  const auto offsets_v = offsets.view();
+
+  axom::for_all<ExecPolicy>(
+    numKeys + 1,
+    AXOM_LAMBDA(IndexType key) {
+      IndexType lo = 0;
+      IndexType hi = numValues;
+      while(lo < hi)
+      {
+        const IndexType mid = lo + (hi - lo) / 2;
+        if(sortedKeys[mid] < key)
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+      offsets_v[key] = lo;
+    });
+}
+
+/*! \brief Reorder the tuples of an array such that the i-th tuple becomes
+ *         the perm[i]-th tuple of the original array.
+ *
+ * \param [in] numTuples the number of tuples.
+ * \param [in] numComponents the number of components of each tuple.
+ * \param [in] perm the permutation, of length numTuples.
+ * \param [in,out] data the array to reorder, of length
+ *              numTuples * numComponents.
+ *
+ * \tparam ExecPolicy the execution policy, e.g., axom::SEQ_EXEC.
+ * \tparam T the type of the array entries.
+ */
+template <typename ExecPolicy, typename T>
+void permuteTuples(IndexType numTuples,
+                   IndexType numComponents,
+                   const IndexType* perm,
+                   T* data)
+{
+  const IndexType numValues = numTuples * numComponents;
+  Array<T> gathered(numValues);
+  const auto gathered_v = gathered.view();
+
+  axom::for_all<ExecPolicy>(
+    numValues,
+    AXOM_LAMBDA(IndexType i) {
+      const IndexType tuple = i / numComponents;
+      const IndexType component = i - tuple * numComponents;
+      gathered_v[i] = data[perm[tuple] * numComponents + component];
+    });
+
+  axom::for_all<ExecPolicy>(
+    numValues,
+    AXOM_LAMBDA(IndexType i) { data[i] = gathered_v[i]; });
+}
+
+/*! \brief Return the Morton index of the given grid cell, i.e., its position
+ *         along the Z-order curve through a grid of 2^bits cells along each
+ *         dimension.
+ *
+ * \param [in] ijk the grid indices of the cell, in [0, 2^bits).
+ * \param [in] ndims the grid dimension.
+ * \param [in] bits the number of bits of each grid index.
+ */
+AXOM_HOST_DEVICE inline IndexType mortonIndex(const IndexType* ijk,
+                                              int ndims,
+                                              int bits)
+{
+  IndexType index = 0;
+  for(int b = 0; b < bits; ++b)
+  {
+    for(int d = 0; d < ndims; ++d)
+    {
+      index |= ((ijk[d] >> b) & 1) << (b * ndims + d);
+    }
+  }
+  return index;
+}
+
+/*! \brief Record the node-to-cell relation of a mesh given its cell-to-node
+ *         relation.
+ *
+ * \param [in] numCells the number of cells.
+ * \param [in] numNodes the number of nodes.
+ * \param [in] c2n the nodes of cell c, stored contiguously starting at
+ *              c2n[c2noffsets[c]], or at c2n[c * c2nstride] if c2noffsets
+ *              is nullptr.
+ * \param [in] c2noffsets the offset in c2n of the first node of each cell,
+ *              or nullptr if all cells have c2nstride nodes.
+ * \param [in] c2nstride the number of nodes of each cell, used when
+ *              c2noffsets is nullptr.
+ * \param [out] n2c the relation between node n and its incident cells with
+ *              cellIDs stored contiguously, in increasing order, starting
+ *              at n2c[n2coffsets[n]].
+ * \param [out] n2coffsets the offset in n2c of the first cell of each node,
+ *              of length numNodes + 1.
+ *
+ * This routine records the (node, cell) pair of each entry of the
+ * cell-to-node relation in parallel over the cells, and stably sorts the
+ * pairs by node.  The offsets are then found in parallel over the nodes,
+ * with a binary search in the sorted node IDs.
+ *
+ * \tparam ExecPolicy the execution policy, e.g., axom::SEQ_EXEC.
+ */
+template <typename ExecPolicy>
+void initNodeCells(IndexType numCells,
+                   IndexType numNodes,
+                   const IndexType* c2n,
+                   const IndexType* c2noffsets,
+                   IndexType c2nstride,
+                   Array<IndexType>& n2c,
+                   Array<IndexType>& n2coffsets)
+{
+  const IndexType numValues =
+    (c2noffsets != nullptr) ? c2noffsets[numCells] : numCells * c2nstride;
+
+  Array<IndexType> keys(numValues);
+  n2c.resize(numValues);
+
+  const auto keys_v = keys.view();
+  const auto n2c_v = n2c.view();
+
+  // record the node and cell of each entry of the cell-to-node relation
+  axom::for_all<ExecPolicy>(
+    numCells,
+    AXOM_LAMBDA(IndexType cellID) {
+      const IndexType begin =
+        (c2noffsets != nullptr) ? c2noffsets[cellID] : cellID * c2nstride;
+      const IndexType end = (c2noffsets != nullptr) ? c2noffsets[cellID + 1]
+                                                    : begin + c2nstride;
+      for(IndexType i = begin; i < end; ++i)
+      {
+        keys_v[i] = c2n[i];
+        n2c_v[i] = cellID;
+      }
+    });
+
+  // sort by node, keeping the cells of each node in increasing order
+#ifdef AXOM_USE_RAJA
+  using loop_pol = typename axom::execution_space<ExecPolicy>::loop_policy;
+  RAJA::stable_sort_pairs<loop_pol>(RAJA::make_span(keys.data(), numValues),
+                                    RAJA::make_span(n2c.data(), numValues));
+#else
+  std::vector<IndexType> perm(numValues);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::stable_sort(perm.begin(), perm.end(), [=](IndexType i1, IndexType i2) {
+    return keys_v[i1] < keys_v[i2];
+  });
+
+  std::vector<IndexType> sorted_keys(numValues);
+  std::vector<IndexType> sorted_cells(numValues);
+  for(IndexType i = 0; i < numValues; ++i)
+  {
+    sorted_keys[i] = keys[perm[i]];
+    sorted_cells[i] = n2c[perm[i]];
+  }
+  std::copy(sorted_keys.begin(), sorted_keys.end(), keys.begin());
+  std::copy(sorted_cells.begin(), sorted_cells.end(), n2c.begin());
+#endif
+
+  // the offset of each node is the position of its first entry
+  initSortedOffsets<ExecPolicy>(numValues, keys.data(), numNodes, n2coffsets);
+}
+
+/*! \brief Compute a coloring of a mesh's cells such that no two cells of
+ *         the same color share a node.
+ *
+ * \param [in] numCells the number of cells.
+ * \param [in] c2n the cell-to-node relation, see initNodeCells().
+ * \param [in] c2noffsets the offsets of the cell-to-node relation, or
+ *              nullptr if all cells have c2nstride nodes.
+ * \param [in] c2nstride the number of nodes of each cell, used when
+ *              c2noffsets is nullptr.
+ * \param [in] n2c the node-to-cell relation, see initNodeCells().
+ * \param [in] n2coffsets the offsets of the node-to-cell relation.
+ * \param [out] coloredCells the cellIDs of each color, stored contiguously
+ *              and in increasing order starting at
+ *              coloredCells[colorOffsets[color]].
+ * \param [out] colorOffsets the offset in coloredCells of the first cell
+ *              of each color, of length numColors + 1.
+ *
+ * \returns numColors the number of colors.
+ *
+ * This routine visits the cells in order and greedily assigns each cell the
+ * smallest color that is not used by a previously visited cell with which
+ * it shares a node.  The number of colors is thus at most one more than the
+ * largest number of cells that neighbor a single cell through its nodes.
+ */
+IndexType initCellColors(IndexType numCells,
+                         const IndexType* c2n,
+                         const IndexType* c2noffsets,
+                         IndexType c2nstride,
+                         const IndexType* n2c,
+                         const IndexType* n2coffsets,
+                         Array<IndexType>& coloredCells,
+                         Array<IndexType>& colorOffsets);
+
 } /* namespace internal */
 } /* namespace mint */
 } /* namespace axom */
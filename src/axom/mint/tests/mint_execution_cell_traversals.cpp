@@ -21,6 +21,9 @@
 // gtest includes
 #include "gtest/gtest.h"
 
+// C/C++ includes
+#include <vector>
+
 namespace axom
 {
 namespace mint
@@ -165,6 +168,92 @@ void check_for_all_cells_ijk()
   test_mesh = nullptr;
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, int MeshType>
+void check_for_all_cells_stencil(int dimension)
+{
+  SLIC_INFO("dimension=" << dimension
+                         << ", policy=" << execution_space<ExecPolicy>::name()
+                         << ", mesh_type="
+                         << internal::mesh_type<MeshType>::name());
+
+  constexpr int MAX_NEIGHBORS = 27;
+
+  const IndexType Ni = 20;
+  const IndexType Nj = 15;
+  const IndexType Nk = (dimension == 3) ? 10 : -1;
+
+  const double lo[] = {-10, -10, -10};
+  const double hi[] = {10, 10, 10};
+  UniformMesh uniform_mesh(lo, hi, Ni, Nj, Nk);
+
+  using MESH = typename internal::mesh_type<MeshType>::MeshType;
+  MESH* test_mesh =
+    dynamic_cast<MESH*>(internal::create_mesh<MeshType>(uniform_mesh));
+  EXPECT_TRUE(test_mesh != nullptr);
+
+  IndexType* count =
+    test_mesh->template createField<IndexType>("count", CELL_CENTERED);
+  IndexType* neighbors =
+    test_mesh->template createField<IndexType>("neighbors",
+                                               CELL_CENTERED,
+                                               MAX_NEIGHBORS);
+
+  for_all_cells<ExecPolicy, xargs::stencil>(
+    test_mesh,
+    AXOM_LAMBDA(IndexType cellID, const IndexType* neighborIDs, IndexType N) {
+      count[cellID] = N;
+      for(int n = 0; n < N; ++n)
+      {
+        neighbors[cellID * MAX_NEIGHBORS + n] = neighborIDs[n];
+      }
+    });
+
+  // compare against the neighbors found from the IJK indices of the cells
+  const IndexType ncells_i = Ni - 1;
+  const IndexType ncells_j = Nj - 1;
+  const IndexType ncells_k = (dimension == 3) ? Nk - 1 : 1;
+  const int dk_max = (dimension == 3) ? 1 : 0;
+
+  IndexType cellID = 0;
+  for(IndexType k = 0; k < ncells_k; ++k)
+  {
+    for(IndexType j = 0; j < ncells_j; ++j)
+    {
+      for(IndexType i = 0; i < ncells_i; ++i)
+      {
+        EXPECT_EQ(count[cellID], (dimension == 3) ? 27 : 9);
+        for(int dk = -dk_max; dk <= dk_max; ++dk)
+        {
+          for(int dj = -1; dj <= 1; ++dj)
+          {
+            for(int di = -1; di <= 1; ++di)
+            {
+              const IndexType ii = i + di;
+              const IndexType jj = j + dj;
+              const IndexType kk = k + dk;
+              const bool inside = ii >= 0 && ii < ncells_i && jj >= 0 &&
+                jj < ncells_j && kk >= 0 && kk < ncells_k;
+              const IndexType expected = inside
+                ? ii + jj * ncells_i + kk * ncells_i * ncells_j
+                : -1;
+
+              const int n = (dimension == 3)
+                ? xargs::stencil::position(di, dj, dk)
+                : xargs::stencil::position(di, dj);
+              EXPECT_EQ(neighbors[cellID * MAX_NEIGHBORS + n], expected);
+            }
+          }
+        }
+        ++cellID;
+      }  // END for all i
+    }    // END for all j
+  }      // END for all k
+
+  delete test_mesh;
+  test_mesh = nullptr;
+}
+
 //------------------------------------------------------------------------------
 template <typename ExecPolicy, int MeshType, int Topology = SINGLE_SHAPE>
 void check_for_all_cell_nodes(int dimension)
@@ -343,6 +432,107 @@ void check_for_all_cell_faces(int dimension)
   test_mesh = nullptr;
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, int Topology>
+void check_for_all_colored_cells(int dimension)
+{
+  constexpr char* mesh_name =
+    internal::mesh_type<UNSTRUCTURED_MESH, Topology>::name();
+  SLIC_INFO("dimension=" << dimension
+                         << ", policy=" << execution_space<ExecPolicy>::name()
+                         << ", mesh_type=" << mesh_name);
+
+  const IndexType Ni = 20;
+  const IndexType Nj = (dimension >= 2) ? Ni : -1;
+  const IndexType Nk = (dimension == 3) ? Ni : -1;
+
+  const double lo[] = {-10, -10, -10};
+  const double hi[] = {10, 10, 10};
+  UniformMesh uniform_mesh(lo, hi, Ni, Nj, Nk);
+
+  using MESH = typename internal::mesh_type<UNSTRUCTURED_MESH, Topology>::MeshType;
+  MESH* test_mesh = dynamic_cast<MESH*>(
+    internal::create_mesh<UNSTRUCTURED_MESH, Topology>(uniform_mesh));
+  EXPECT_TRUE(test_mesh != nullptr);
+
+  EXPECT_FALSE(test_mesh->hasCellColoring());
+  EXPECT_TRUE(test_mesh->initializeCellColoring());
+  EXPECT_TRUE(test_mesh->hasCellColoring());
+  EXPECT_TRUE(test_mesh->hasNodeCellConnectivity());
+
+  // a structured grid of cells needs at least 2^dimension colors, which the
+  // greedy coloring finds when visiting the cells in lexicographic order
+  const IndexType numColors = test_mesh->getNumberOfCellColors();
+  EXPECT_GE(numColors, 1 << dimension);
+  if(Topology == SINGLE_SHAPE)
+  {
+    EXPECT_EQ(numColors, 1 << dimension);
+  }
+
+  // cells of the same color must not share a node
+  const IndexType numNodes = test_mesh->getNumberOfNodes();
+  const IndexType numCells = test_mesh->getNumberOfCells();
+  const IndexType* colored_cells = test_mesh->getColoredCellsArray();
+  const IndexType* color_offsets = test_mesh->getCellColorOffsetsArray();
+  EXPECT_EQ(color_offsets[numColors], numCells);
+
+  std::vector<IndexType> nodeColor(numNodes, -1);
+  IndexType cellNodes[MAX_CELL_NODES];
+  for(IndexType color = 0; color < numColors; ++color)
+  {
+    for(IndexType i = color_offsets[color]; i < color_offsets[color + 1]; ++i)
+    {
+      const IndexType N = test_mesh->getCellNodeIDs(colored_cells[i], cellNodes);
+      for(int j = 0; j < N; ++j)
+      {
+        EXPECT_NE(nodeColor[cellNodes[j]], color);
+        nodeColor[cellNodes[j]] = color;
+      }
+    }
+  }
+
+  // each cell is visited exactly once
+  IndexType* visits =
+    test_mesh->template createField<IndexType>("visits", CELL_CENTERED);
+  for_all_cells<ExecPolicy>(
+    test_mesh,
+    AXOM_LAMBDA(IndexType cellID) { visits[cellID] = 0; });
+  for_all_colored_cells<ExecPolicy>(
+    test_mesh,
+    AXOM_LAMBDA(IndexType cellID) { visits[cellID] += 1; });
+
+  for(IndexType cellID = 0; cellID < numCells; ++cellID)
+  {
+    EXPECT_EQ(visits[cellID], 1);
+  }
+
+  // scattering to the nodes without atomics counts the cells of each node
+  IndexType* count =
+    test_mesh->template createField<IndexType>("count", NODE_CENTERED);
+  for_all_nodes<ExecPolicy>(
+    test_mesh,
+    AXOM_LAMBDA(IndexType nodeID) { count[nodeID] = 0; });
+  for_all_colored_cells<ExecPolicy, xargs::nodeids>(
+    test_mesh,
+    AXOM_LAMBDA(IndexType AXOM_UNUSED_PARAM(cellID),
+                const IndexType* nodes,
+                IndexType N) {
+      for(int i = 0; i < N; ++i)
+      {
+        count[nodes[i]] += 1;
+      }
+    });
+
+  for(IndexType nodeID = 0; nodeID < numNodes; ++nodeID)
+  {
+    EXPECT_EQ(count[nodeID], test_mesh->getNumberOfNodeCells(nodeID));
+  }
+
+  /* clean up */
+  delete test_mesh;
+  test_mesh = nullptr;
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -412,6 +602,71 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_nodeids)
   }  // END for all dimensions
 }
 
+//------------------------------------------------------------------------------
+AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_stencil)
+{
+  for(int i = 2; i <= 3; ++i)
+  {
+    using seq_exec = axom::SEQ_EXEC;
+    check_for_all_cells_stencil<seq_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_cells_stencil<seq_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_cells_stencil<seq_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+
+    using tiled_seq_exec = TILED_EXEC<seq_exec, 8, 4, 2>;
+    check_for_all_cells_stencil<tiled_seq_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_cells_stencil<tiled_seq_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_cells_stencil<tiled_seq_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
+  defined(RAJA_ENABLE_OPENMP)
+
+    using omp_exec = axom::OMP_EXEC;
+    check_for_all_cells_stencil<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_cells_stencil<omp_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_cells_stencil<omp_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+
+    using tiled_omp_exec = TILED_EXEC<omp_exec, 8, 4, 2>;
+    check_for_all_cells_stencil<tiled_omp_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_cells_stencil<tiled_omp_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_cells_stencil<tiled_omp_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+
+#endif
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_CUDA) && \
+  defined(RAJA_ENABLE_CUDA) && defined(AXOM_USE_UMPIRE)
+
+    using cuda_exec = axom::CUDA_EXEC<512>;
+
+    const int exec_space_id = axom::execution_space<cuda_exec>::allocatorID();
+    const int prev_allocator = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(exec_space_id);
+
+    check_for_all_cells_stencil<cuda_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_cells_stencil<cuda_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_cells_stencil<cuda_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+
+    setDefaultAllocator(prev_allocator);
+#endif
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_HIP) && \
+  defined(RAJA_ENABLE_HIP) && defined(AXOM_USE_UMPIRE)
+
+    using hip_exec = axom::HIP_EXEC<512>;
+
+    const int exec_space_id = axom::execution_space<hip_exec>::allocatorID();
+    const int prev_allocator = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(exec_space_id);
+
+    check_for_all_cells_stencil<hip_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_cells_stencil<hip_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_cells_stencil<hip_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+
+    setDefaultAllocator(prev_allocator);
+#endif
+
+  }  // END for all dimensions
+}
+
 AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_coords)
 {
   constexpr int NDIMS = 3;
@@ -546,6 +801,11 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ij)
   check_for_all_cells_ij<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ij<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
+  using tiled_seq_exec = TILED_EXEC<seq_exec, 8, 4, 2>;
+  check_for_all_cells_ij<tiled_seq_exec, STRUCTURED_UNIFORM_MESH>();
+  check_for_all_cells_ij<tiled_seq_exec, STRUCTURED_CURVILINEAR_MESH>();
+  check_for_all_cells_ij<tiled_seq_exec, STRUCTURED_RECTILINEAR_MESH>();
+
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
   defined(RAJA_ENABLE_OPENMP)
 
@@ -554,6 +814,11 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ij)
   check_for_all_cells_ij<omp_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ij<omp_exec, STRUCTURED_RECTILINEAR_MESH>();
 
+  using tiled_omp_exec = TILED_EXEC<omp_exec, 8, 4, 2>;
+  check_for_all_cells_ij<tiled_omp_exec, STRUCTURED_UNIFORM_MESH>();
+  check_for_all_cells_ij<tiled_omp_exec, STRUCTURED_CURVILINEAR_MESH>();
+  check_for_all_cells_ij<tiled_omp_exec, STRUCTURED_RECTILINEAR_MESH>();
+
 #endif
 
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_CUDA) && \
@@ -597,6 +862,11 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ijk)
   check_for_all_cells_ijk<seq_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ijk<seq_exec, STRUCTURED_RECTILINEAR_MESH>();
 
+  using tiled_seq_exec = TILED_EXEC<seq_exec, 8, 4, 2>;
+  check_for_all_cells_ijk<tiled_seq_exec, STRUCTURED_UNIFORM_MESH>();
+  check_for_all_cells_ijk<tiled_seq_exec, STRUCTURED_CURVILINEAR_MESH>();
+  check_for_all_cells_ijk<tiled_seq_exec, STRUCTURED_RECTILINEAR_MESH>();
+
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
   defined(RAJA_ENABLE_OPENMP)
 
@@ -605,6 +875,11 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_ijk)
   check_for_all_cells_ijk<omp_exec, STRUCTURED_CURVILINEAR_MESH>();
   check_for_all_cells_ijk<omp_exec, STRUCTURED_RECTILINEAR_MESH>();
 
+  using tiled_omp_exec = TILED_EXEC<omp_exec, 8, 4, 2>;
+  check_for_all_cells_ijk<tiled_omp_exec, STRUCTURED_UNIFORM_MESH>();
+  check_for_all_cells_ijk<tiled_omp_exec, STRUCTURED_CURVILINEAR_MESH>();
+  check_for_all_cells_ijk<tiled_omp_exec, STRUCTURED_RECTILINEAR_MESH>();
+
 #endif
 
 #if defined(AXOM_USE_RAJA) && defined(AXOM_USE_CUDA) && \
@@ -704,6 +979,58 @@ AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_cells_index)
   }  // END for all dimensions
 }
 
+//------------------------------------------------------------------------------
+AXOM_CUDA_TEST(mint_execution_cell_traversals, for_all_colored_cells)
+{
+  constexpr int NDIMS = 3;
+  for(int i = 1; i <= NDIMS; ++i)
+  {
+    using seq_exec = axom::SEQ_EXEC;
+    check_for_all_colored_cells<seq_exec, SINGLE_SHAPE>(i);
+    check_for_all_colored_cells<seq_exec, MIXED_SHAPE>(i);
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
+  defined(RAJA_ENABLE_OPENMP)
+
+    using omp_exec = axom::OMP_EXEC;
+    check_for_all_colored_cells<omp_exec, SINGLE_SHAPE>(i);
+    check_for_all_colored_cells<omp_exec, MIXED_SHAPE>(i);
+
+#endif
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_CUDA) && \
+  defined(RAJA_ENABLE_CUDA) && defined(AXOM_USE_UMPIRE)
+
+    using cuda_exec = axom::CUDA_EXEC<512>;
+
+    const int exec_space_id = axom::execution_space<cuda_exec>::allocatorID();
+    const int prev_allocator = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(exec_space_id);
+
+    check_for_all_colored_cells<cuda_exec, SINGLE_SHAPE>(i);
+    check_for_all_colored_cells<cuda_exec, MIXED_SHAPE>(i);
+
+    setDefaultAllocator(prev_allocator);
+#endif
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_HIP) && \
+  defined(RAJA_ENABLE_HIP) && defined(AXOM_USE_UMPIRE)
+
+    using hip_exec = axom::HIP_EXEC<512>;
+
+    const int exec_space_id = axom::execution_space<hip_exec>::allocatorID();
+    const int prev_allocator = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(exec_space_id);
+
+    check_for_all_colored_cells<hip_exec, SINGLE_SHAPE>(i);
+    check_for_all_colored_cells<hip_exec, MIXED_SHAPE>(i);
+
+    setDefaultAllocator(prev_allocator);
+#endif
+
+  }  // END for all dimensions
+}
+
 } /* namespace mint */
 } /* namespace axom */
 
@@ -20,6 +20,9 @@
 // gtest includes
 #include "gtest/gtest.h"  // for gtest
 
+// C/C++ includes
+#include <vector>  // for std::vector
+
 namespace axom
 {
 namespace mint
@@ -316,6 +319,89 @@ void check_for_all_nodes_x()
   axom::deallocate(x);
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, typename MeshType>
+void init_node_cells(MeshType* AXOM_UNUSED_PARAM(mesh))
+{ }
+
+template <typename ExecPolicy, Topology TOPO>
+void init_node_cells(UnstructuredMesh<TOPO>* mesh)
+{
+  mesh->template initializeNodeCellConnectivity<ExecPolicy>();
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy, int MeshType, int Topology = SINGLE_SHAPE>
+void check_for_all_nodes_cellids(int dimension)
+{
+  constexpr char* mesh_name = internal::mesh_type<MeshType, Topology>::name();
+  SLIC_INFO("dimension=" << dimension
+                         << ", policy=" << execution_space<ExecPolicy>::name()
+                         << ", mesh_type=" << mesh_name);
+
+  // the mixed shape mesh splits each hexahedron into pyramids
+  constexpr int MAX_NODE_CELLS = 32;
+
+  const IndexType Ni = 20;
+  const IndexType Nj = (dimension >= 2) ? Ni : -1;
+  const IndexType Nk = (dimension == 3) ? Ni : -1;
+
+  const double lo[] = {-10, -10, -10};
+  const double hi[] = {10, 10, 10};
+  UniformMesh uniform_mesh(lo, hi, Ni, Nj, Nk);
+
+  using MESH = typename internal::mesh_type<MeshType, Topology>::MeshType;
+  MESH* test_mesh =
+    dynamic_cast<MESH*>(internal::create_mesh<MeshType, Topology>(uniform_mesh));
+  EXPECT_TRUE(test_mesh != nullptr);
+  init_node_cells<ExecPolicy>(test_mesh);
+
+  const IndexType numNodes = test_mesh->getNumberOfNodes();
+  const IndexType numCells = test_mesh->getNumberOfCells();
+  IndexType* count =
+    test_mesh->template createField<IndexType>("count", NODE_CENTERED);
+  IndexType* node_cells =
+    test_mesh->template createField<IndexType>("node_cells",
+                                               NODE_CENTERED,
+                                               MAX_NODE_CELLS);
+
+  for_all_nodes<ExecPolicy, xargs::cellids>(
+    test_mesh,
+    AXOM_LAMBDA(IndexType nodeID, const IndexType* cells, IndexType N) {
+      count[nodeID] = N;
+      for(int i = 0; i < N; ++i)
+      {
+        node_cells[nodeID * MAX_NODE_CELLS + i] = cells[i];
+      }
+    });
+
+  // build the expected node-to-cell relation from the cell-to-node relation
+  std::vector<std::vector<IndexType>> expected(numNodes);
+  IndexType cellNodes[MAX_CELL_NODES];
+  for(IndexType cellID = 0; cellID < numCells; ++cellID)
+  {
+    const IndexType N = test_mesh->getCellNodeIDs(cellID, cellNodes);
+    for(int i = 0; i < N; ++i)
+    {
+      expected[cellNodes[i]].push_back(cellID);
+    }
+  }
+
+  for(IndexType nodeID = 0; nodeID < numNodes; ++nodeID)
+  {
+    const IndexType N = static_cast<IndexType>(expected[nodeID].size());
+    ASSERT_EQ(count[nodeID], N);
+    ASSERT_LE(N, MAX_NODE_CELLS);
+    for(int i = 0; i < N; ++i)
+    {
+      EXPECT_EQ(node_cells[nodeID * MAX_NODE_CELLS + i], expected[nodeID][i]);
+    }
+  }  // END for all nodes
+
+  delete test_mesh;
+  test_mesh = nullptr;
+}
+
 } /* end anonymous namespace */
 
 //------------------------------------------------------------------------------
@@ -680,6 +766,70 @@ AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_index)
   }  // END for all dimensions
 }
 
+//------------------------------------------------------------------------------
+AXOM_CUDA_TEST(mint_execution_node_traversals, for_all_nodes_cellids)
+{
+  constexpr int NDIMS = 3;
+  for(int i = 1; i <= NDIMS; ++i)
+  {
+    using seq_exec = axom::SEQ_EXEC;
+    check_for_all_nodes_cellids<seq_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_nodes_cellids<seq_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<seq_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<seq_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
+    check_for_all_nodes_cellids<seq_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP) && \
+  defined(RAJA_ENABLE_OPENMP)
+
+    using omp_exec = axom::OMP_EXEC;
+    check_for_all_nodes_cellids<omp_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_nodes_cellids<omp_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<omp_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<omp_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
+    check_for_all_nodes_cellids<omp_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
+
+#endif
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_CUDA) && \
+  defined(RAJA_ENABLE_CUDA) && defined(AXOM_USE_UMPIRE)
+
+    using cuda_exec = axom::CUDA_EXEC<512>;
+
+    const int exec_space_id = axom::execution_space<cuda_exec>::allocatorID();
+    const int prev_allocator = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(exec_space_id);
+
+    check_for_all_nodes_cellids<cuda_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_nodes_cellids<cuda_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<cuda_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<cuda_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
+    check_for_all_nodes_cellids<cuda_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
+
+    setDefaultAllocator(prev_allocator);
+#endif
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_HIP) && \
+  defined(RAJA_ENABLE_HIP) && defined(AXOM_USE_UMPIRE)
+
+    using hip_exec = axom::HIP_EXEC<512>;
+
+    const int exec_space_id = axom::execution_space<hip_exec>::allocatorID();
+    const int prev_allocator = axom::getDefaultAllocatorID();
+    axom::setDefaultAllocator(exec_space_id);
+
+    check_for_all_nodes_cellids<hip_exec, STRUCTURED_UNIFORM_MESH>(i);
+    check_for_all_nodes_cellids<hip_exec, STRUCTURED_CURVILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<hip_exec, STRUCTURED_RECTILINEAR_MESH>(i);
+    check_for_all_nodes_cellids<hip_exec, UNSTRUCTURED_MESH, SINGLE_SHAPE>(i);
+    check_for_all_nodes_cellids<hip_exec, UNSTRUCTURED_MESH, MIXED_SHAPE>(i);
+
+    setDefaultAllocator(prev_allocator);
+#endif
+
+  }  // END for all dimensions
+}
+
 } /* namespace mint */
 } /* namespace axom */
 
@@ -50,6 +50,7 @@ TEST(mint_execution_xargs, check_types)
   check_valid<xargs::coords>();
   check_valid<xargs::faceids>();
   check_valid<xargs::cellids>();
+  check_valid<xargs::stencil>();
 
   struct invalid_type
   { };
@@ -17,6 +17,11 @@ namespace sidre = axom::sidre;
 
 #include "gtest/gtest.h"
 
+// C/C++ includes
+#include <algorithm>  // for std::min, std::max
+#include <cstdlib>    // for std::rand
+#include <vector>     // for std::vector
+
 // namespace aliases
 namespace mint = axom::mint;
 
@@ -230,6 +235,142 @@ void check_create_field(mint::ParticleMesh* particles,
   EXPECT_EQ(vel, mint::Field::getDataPtr<double>(f));
 }
 
+//------------------------------------------------------------------------------
+// Returns the sort key of the given particle, computed independently of
+// ParticleMesh::sort()
+axom::IndexType particle_sort_key(const mint::ParticleMesh* particles,
+                                  axom::IndexType particleID,
+                                  mint::ParticleOrdering ordering,
+                                  const double* lo,
+                                  const double* hi,
+                                  axom::IndexType resolution)
+{
+  const int ndims = particles->getDimension();
+
+  double x[3];
+  particles->getNode(particleID, x);
+
+  axom::IndexType ijk[3] = {0, 0, 0};
+  for(int d = 0; d < ndims; ++d)
+  {
+    const double t = (x[d] - lo[d]) / (hi[d] - lo[d]);
+    ijk[d] = std::min(std::max(static_cast<axom::IndexType>(t * resolution),
+                               axom::IndexType(0)),
+                      resolution - 1);
+  }
+
+  if(ordering == mint::ParticleOrdering::GRID_CELL)
+  {
+    return ijk[0] + resolution * (ijk[1] + resolution * ijk[2]);
+  }
+
+  // interleave the bits of the grid indices
+  axom::IndexType key = 0;
+  int bit = 0;
+  for(axom::IndexType b = 1; b < resolution; b <<= 1)
+  {
+    for(int d = 0; d < ndims; ++d, ++bit)
+    {
+      if(ijk[d] & b)
+      {
+        key |= axom::IndexType(1) << bit;
+      }
+    }
+  }
+  return key;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecPolicy>
+void check_sort(int dimension, mint::ParticleOrdering ordering)
+{
+  constexpr axom::IndexType NUM_PARTICLES = 500;
+  constexpr axom::IndexType RESOLUTION = 5;
+  const double lo[] = {-1., -1., -1.};
+  const double hi[] = {1., 1., 1.};
+
+  mint::ParticleMesh particles(dimension, NUM_PARTICLES);
+  double* x[3] = {nullptr, nullptr, nullptr};
+  for(int d = 0; d < dimension; ++d)
+  {
+    x[d] = particles.getCoordinateArray(d);
+  }
+
+  // the fields record the original positions and IDs of the particles
+  double* pos = particles.createField<double>("pos", mint::NODE_CENTERED, 3);
+  int* id = particles.createField<int>("id", mint::NODE_CENTERED);
+  float* rank = particles.createField<float>("rank", mint::NODE_CENTERED);
+
+  for(axom::IndexType i = 0; i < NUM_PARTICLES; ++i)
+  {
+    for(int d = 0; d < 3; ++d)
+    {
+      // a few particles lie outside of the grid
+      const double c = 2.2 * std::rand() / RAND_MAX - 1.1;
+      pos[i * 3 + d] = (d < dimension) ? c : 0.;
+      if(d < dimension)
+      {
+        x[d][i] = c;
+      }
+    }
+    id[i] = static_cast<int>(i);
+    rank[i] = static_cast<float>(i);
+  }
+
+  axom::Array<axom::IndexType> offsets;
+  particles.sort<ExecPolicy>(ordering, lo, hi, RESOLUTION, &offsets);
+
+  // the MORTON ordering rounds the resolution up to a power of two
+  const axom::IndexType N =
+    (ordering == mint::ParticleOrdering::MORTON) ? 8 : RESOLUTION;
+  axom::IndexType numBins = 1;
+  for(int d = 0; d < dimension; ++d)
+  {
+    numBins *= N;
+  }
+  ASSERT_EQ(offsets.size(), numBins + 1);
+  EXPECT_EQ(offsets[0], 0);
+  EXPECT_EQ(offsets[numBins], NUM_PARTICLES);
+
+  // the fields moved with their particles
+  std::vector<bool> found(NUM_PARTICLES, false);
+  for(axom::IndexType i = 0; i < NUM_PARTICLES; ++i)
+  {
+    ASSERT_TRUE(id[i] >= 0 && id[i] < NUM_PARTICLES);
+    EXPECT_FALSE(found[id[i]]);
+    found[id[i]] = true;
+    EXPECT_EQ(rank[i], static_cast<float>(id[i]));
+    for(int d = 0; d < dimension; ++d)
+    {
+      EXPECT_EQ(x[d][i], pos[i * 3 + d]);
+    }
+  }
+
+  // the particles are sorted by bin, in their original order within a bin
+  for(axom::IndexType bin = 0; bin < numBins; ++bin)
+  {
+    EXPECT_LE(offsets[bin], offsets[bin + 1]);
+    for(axom::IndexType i = offsets[bin]; i < offsets[bin + 1]; ++i)
+    {
+      EXPECT_EQ(particle_sort_key(&particles, i, ordering, lo, hi, N), bin);
+      if(i > offsets[bin])
+      {
+        EXPECT_LT(id[i - 1], id[i]);
+      }
+    }
+  }
+
+  // sorting again, with the bounding box of the particles, is stable
+  particles.sort<ExecPolicy>(ordering, RESOLUTION);
+  for(axom::IndexType i = 0; i < NUM_PARTICLES; ++i)
+  {
+    for(int d = 0; d < dimension; ++d)
+    {
+      EXPECT_EQ(x[d][i], pos[i * 3 + d]);
+    }
+  }
+}
+
 }  // namespace
 
 //------------------------------------------------------------------------------
@@ -548,6 +689,41 @@ TEST(mint_mesh_particle_mesh, shrink)
 #endif
 }
 
+//------------------------------------------------------------------------------
+TEST(mint_mesh_particle_mesh, sort)
+{
+  for(int dim = 1; dim <= 3; ++dim)
+  {
+    check_sort<axom::SEQ_EXEC>(dim, mint::ParticleOrdering::GRID_CELL);
+    check_sort<axom::SEQ_EXEC>(dim, mint::ParticleOrdering::MORTON);
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+    check_sort<axom::OMP_EXEC>(dim, mint::ParticleOrdering::GRID_CELL);
+    check_sort<axom::OMP_EXEC>(dim, mint::ParticleOrdering::MORTON);
+#endif
+  }
+}
+
+//------------------------------------------------------------------------------
+TEST(mint_mesh_particle_mesh, sort_external)
+{
+  constexpr axom::IndexType NUM_PARTICLES = 6;
+  double x[] = {0.9, 0.1, 0.6, 0.4, 0.0, 1.0};
+  double y[] = {0.9, 0.9, 0.1, 0.1, 0.6, 0.0};
+
+  mint::ParticleMesh particles(NUM_PARTICLES, x, y);
+  particles.sort(mint::ParticleOrdering::GRID_CELL, 2);
+
+  // the particles are sorted by quadrant of their bounding box
+  const double expected_x[] = {0.4, 0.6, 1.0, 0.1, 0.0, 0.9};
+  const double expected_y[] = {0.1, 0.1, 0.0, 0.9, 0.6, 0.9};
+  for(axom::IndexType i = 0; i < NUM_PARTICLES; ++i)
+  {
+    EXPECT_DOUBLE_EQ(x[i], expected_x[i]);
+    EXPECT_DOUBLE_EQ(y[i], expected_y[i]);
+  }
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -378,6 +378,42 @@ void various_traversal_methods(int nmats,
   SLIC_INFO("  Field2D: " << timer.elapsed() << " sec");
   SLIC_ASSERT(x_sum == sum);
 
+  // ---------- traversal kernels ------------
+  SLIC_INFO("\n -- With MultiMat traversal kernels -- ");
+  sum = 0;
+  timer.reset();
+  timer.start();
+  {
+    MultiMat::Field2D<double>& map2d = mm.get2dField<double>("CellMat Array");
+    MultiMat::Field2D<double>& volfrac = mm.getVolfracField();
+    std::vector<double> cell_sum(mm.getNumberOfCells(), 0.);
+
+    // Volfrac and the cell-material array are gathered in a single traversal.
+    // Components of an entry are contiguous, starting at the given reference.
+    mm.for_all_cells<axom::SEQ_EXEC>(
+      [&](axom::IndexType cell_id,
+          axom::IndexType /*mat_id*/,
+          double& /*vf*/,
+          double& val) {
+        const double* comps = &val;
+        for(int comp = 0; comp < ncomp; ++comp)
+        {
+          cell_sum[cell_id] += comps[comp];  //<----
+        }
+      },
+      volfrac,
+      map2d);
+
+    for(double s : cell_sum)
+    {
+      sum += s;
+    }
+  }
+  timer.stop();
+  SLIC_INFO("  Field2D: " << timer.elapsed() << " sec");
+  // the values are summed per cell, in a different order than x_sum
+  SLIC_ASSERT(axom::utilities::isNearlyEqualRelative(x_sum, sum));
+
   SLIC_INFO("\n");
 }
 
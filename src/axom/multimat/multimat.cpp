@@ -119,6 +119,41 @@ bool MultiMat::hasValidDynamicRelation(DataLayout layout) const
   return rel.hasFromSet() && rel.hasToSet();
 }
 
+void MultiMat::transposeTraversal(const TraversalInfo& info,
+                                  IndBufferType& begins,
+                                  IndBufferType& indices,
+                                  IndBufferType& positions) const
+{
+  const int numDominant = info.isCellDom ? info.numCells : info.numMats;
+  const int numSecondary = info.isCellDom ? info.numMats : info.numCells;
+  const SetPosType numEntries = info.begins[numDominant];
+
+  // Count the entries in each row of the transposed relation
+  begins.assign(numSecondary + 1, 0);
+  for(SetPosType j = 0; j < numEntries; ++j)
+  {
+    ++begins[info.indices[j] + 1];
+  }
+  for(int i = 0; i < numSecondary; ++i)
+  {
+    begins[i + 1] += begins[i];
+  }
+
+  // Fill the rows, keeping the dominant indices sorted within each row
+  IndBufferType offsets(begins.begin(), begins.end() - 1);
+  indices.resize(numEntries);
+  positions.resize(numEntries);
+  for(int d = 0; d < numDominant; ++d)
+  {
+    for(SetPosType j = info.begins[d]; j < info.begins[d + 1]; ++j)
+    {
+      const SetPosType pos = offsets[info.indices[j]]++;
+      indices[pos] = d;
+      positions[pos] = j;
+    }
+  }
+}
+
 // Copy constructor
 MultiMat::MultiMat(const MultiMat& other)
   : m_ncells(other.m_ncells)
@@ -620,6 +655,61 @@ bool MultiMat::removeEntry(int cell_id, int mat_id)
   return true;
 }
 
+void MultiMat::buildEntryChanges(
+  DataLayout layout,
+  const std::vector<std::pair<int, int>>& added,
+  const std::vector<std::pair<int, int>>& removed,
+  EntryChanges& changes)
+{
+  const bool isCellDom = (layout == DataLayout::CELL_DOM);
+  const int numDominant = relDominantSet(layout).size();
+  const int numChanges = added.size() + removed.size();
+
+  // Bucket the changes by row, with the removals first
+  IndBufferType offsets(numDominant + 1, 0);
+  for(const auto* batch : {&removed, &added})
+  {
+    for(const auto& entry : *batch)
+    {
+      SLIC_ASSERT(0 <= entry.first && entry.first < (int)m_ncells);
+      SLIC_ASSERT(0 <= entry.second && entry.second < (int)m_nmats);
+      ++offsets[(isCellDom ? entry.first : entry.second) + 1];
+    }
+  }
+  for(int r = 0; r < numDominant; ++r)
+  {
+    offsets[r + 1] += offsets[r];
+  }
+
+  changes.secondary.resize(numChanges);
+  changes.isAddition.resize(numChanges);
+  IndBufferType fill(offsets.begin(), offsets.end() - 1);
+  for(const auto* batch : {&removed, &added})
+  {
+    const SetPosType isAddition = (batch == &added) ? 1 : 0;
+    for(const auto& entry : *batch)
+    {
+      const int row = isCellDom ? entry.first : entry.second;
+      const SetPosType pos = fill[row]++;
+      changes.secondary[pos] = isCellDom ? entry.second : entry.first;
+      changes.isAddition[pos] = isAddition;
+    }
+  }
+
+  // Keep the rows with at least one change
+  changes.rows.clear();
+  changes.begins.clear();
+  for(int r = 0; r < numDominant; ++r)
+  {
+    if(offsets[r + 1] > offsets[r])
+    {
+      changes.rows.push_back(r);
+      changes.begins.push_back(offsets[r]);
+    }
+  }
+  changes.begins.push_back(numChanges);
+}
+
 void MultiMat::makeOtherRelation(DataLayout layout)
 {
   DataLayout old_layout =
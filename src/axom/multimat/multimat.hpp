@@ -12,9 +12,11 @@
 #ifndef MULTIMAT_H_
 #define MULTIMAT_H_
 
+#include "axom/core/execution/for_all.hpp"
 #include "axom/slam.hpp"
 
 #include <vector>
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 #include <memory>
@@ -408,6 +410,59 @@ public:
   /** Return the number of cells this object holds **/
   int getNumberOfCells() const { return m_ncells; }
 
+  //Traversal functions
+
+  /**
+   * \brief Applies a kernel to the (cell, material) entries of one or more
+   *  Field2D fields, in parallel over the cells.
+   *
+   * \detail The kernel is invoked as `kernel(cell, mat, values...)` with a
+   * reference to the first component of each field's entry. Each cell is
+   * handled by a single thread, which visits its materials in order, so the
+   * kernel may accumulate into per-cell data without atomics.\n
+   * The loop structure is chosen from the layout of the fields: a
+   * material-dominant sparse field is traversed through a cell-dominant
+   * transpose of its relation, which is built on the host at each call and
+   * holds three extra index arrays, of one entry per cell and two entries
+   * per (cell, material) pair. Dense fields visit every material of each
+   * cell, including those not present in the cell.
+   *
+   * All fields must share the same data and sparsity layout. The field data
+   * lives in host memory, so \a ExecSpace must be a host execution space,
+   * e.g., axom::SEQ_EXEC or axom::OMP_EXEC.
+   *
+   * \tparam ExecSpace the execution space in which to run the traversal
+   * \param kernel the kernel to apply to each entry
+   * \param fields the fields to gather in a single, fused traversal
+   */
+  template <typename ExecSpace, typename KernelType, typename... FieldTypes>
+  void for_all_cells(KernelType&& kernel, FieldTypes&... fields);
+
+  /**
+   * \brief Applies a kernel to the (cell, material) entries of one or more
+   *  Field2D fields, in parallel over the materials.
+   *
+   * \detail Material-dominant counterpart of for_all_cells(): each material is
+   * handled by a single thread, which visits its cells in order.
+   *
+   * \sa for_all_cells()
+   */
+  template <typename ExecSpace, typename KernelType, typename... FieldTypes>
+  void for_all_materials(KernelType&& kernel, FieldTypes&... fields);
+
+  /**
+   * \brief Applies a kernel to the (cell, material) entries of one or more
+   *  Field2D fields, in their storage order.
+   *
+   * \detail This is the fastest traversal since it follows the fields' layout,
+   * but the order in which entries are visited is unspecified: kernels must
+   * not write to data shared by several entries without atomics.
+   *
+   * \sa for_all_cells()
+   */
+  template <typename ExecSpace, typename KernelType, typename... FieldTypes>
+  void for_all_cellmat(KernelType&& kernel, FieldTypes&... fields);
+
   //Layout modification functions
 
   void convertFieldLayout(int field_idx, SparsityLayout, DataLayout);
@@ -478,6 +533,31 @@ public:
    */
   bool removeEntry(int firstIdx, int secondIdx);
 
+  /**
+   * \brief Adds and removes a batch of (cell, material) entries.
+   *
+   * \detail Entries are given as (cell, material) pairs, regardless of the
+   * layout. Removals are applied before insertions; inserting an entry that
+   * is already present, or removing one that is not, has no effect.\n
+   * Only the relation rows touched by the batch are edited, in parallel with
+   * \a ExecSpace, and every 2D field is updated in the same pass: sparse
+   * fields are compacted around the new relation, with zero values for
+   * inserted entries, while removed entries of dense fields are set to zero.
+   * This works both in static and in dynamic mode, and does not require a
+   * conversion between the two.
+   *
+   * \note Updating a sparse field reallocates it, so references obtained
+   *  earlier through get2dField() should not be used afterwards.
+   *
+   * \tparam ExecSpace the execution space in which to edit the rows. Data is
+   *  stored in host memory, so this must be a host execution space.
+   * \param added the (cell, material) entries to insert
+   * \param removed the (cell, material) entries to remove
+   */
+  template <typename ExecSpace = axom::SEQ_EXEC>
+  void updateEntries(const std::vector<std::pair<int, int>>& added,
+                     const std::vector<std::pair<int, int>>& removed);
+
   /** Print the detail of this object */
   void print() const;
   /**
@@ -595,6 +675,111 @@ private:  //private functions
    */
   bool hasValidStaticRelation(DataLayout layout) const;
 
+  /// Layout information used by the field traversal functions
+  struct TraversalInfo
+  {
+    bool isDense;
+    bool isCellDom;
+    int numCells;
+    int numMats;
+    const SetPosType* begins;
+    const SetPosType* indices;
+  };
+
+  /// Raw view of the data of a field, used by the traversal functions
+  template <typename T>
+  struct TraversalField
+  {
+    T* data;
+    SetPosType stride;
+
+    T& operator[](SetPosType i) const { return data[i * stride]; }
+  };
+
+  /*!
+   * \brief Returns the traversal information of a set of fields, which must
+   *        share the same data and sparsity layout.
+   */
+  template <typename FieldType, typename... FieldTypes>
+  TraversalInfo getTraversalInfo(const FieldType& field,
+                                 const FieldTypes&... fields);
+
+  /*!
+   * \brief Implements for_all_cells() and for_all_materials(), running in
+   *        parallel over the cells when \a overCells is true, and over the
+   *        materials otherwise.
+   */
+  template <typename ExecSpace, typename KernelType, typename... DataTypes>
+  void for_all_rows_impl(bool overCells,
+                         const TraversalInfo& info,
+                         KernelType kernel,
+                         TraversalField<DataTypes>... fields);
+
+  /*!
+   * \brief Transposes the static relation of a sparse traversal so that its
+   *        rows run over the secondary set.
+   *
+   * \param [out] begins offsets of each row of the transposed relation
+   * \param [out] indices the dominant set index of each transposed entry
+   * \param [out] positions the position of each transposed entry in the
+   *              field data
+   */
+  void transposeTraversal(const TraversalInfo& info,
+                          IndBufferType& begins,
+                          IndBufferType& indices,
+                          IndBufferType& positions) const;
+
+  /// Insertions and removals of a batch, grouped by relation row
+  struct EntryChanges
+  {
+    IndBufferType rows;        // the affected rows
+    IndBufferType begins;      // offsets of the changes of each affected row
+    IndBufferType secondary;   // the secondary index of each change
+    IndBufferType isAddition;  // 1 for an insertion, 0 for a removal
+  };
+
+  /*!
+   * \brief Groups a batch of entry updates by the rows of the relation
+   *        corresponding to \a layout, with removals before insertions.
+   */
+  void buildEntryChanges(DataLayout layout,
+                         const std::vector<std::pair<int, int>>& added,
+                         const std::vector<std::pair<int, int>>& removed,
+                         EntryChanges& changes);
+
+  /*!
+   * \brief Applies a batch of updates to the static relation of a layout
+   *
+   * \param [out] positions the old position of each entry of the updated
+   *              relation, or -1 for inserted entries
+   */
+  template <typename ExecSpace>
+  void updateStaticRelation(DataLayout layout,
+                            const EntryChanges& changes,
+                            IndBufferType& positions);
+
+  /// Applies a batch of updates to the dynamic relation of a layout
+  template <typename ExecSpace>
+  void updateDynamicRelation(DataLayout layout, const EntryChanges& changes);
+
+  /*!
+   * \brief Updates a 2D field after a batch of entry updates to the relation
+   *        of its data layout.
+   *
+   * \param positions for sparse fields, the old position of each entry in
+   *        the updated relation, or -1 for inserted entries
+   */
+  template <typename ExecSpace, typename DataType>
+  void updateFieldEntries(int field_idx,
+                          const EntryChanges& changes,
+                          const IndBufferType& positions);
+
+  /// Implements for_all_cellmat()
+  template <typename ExecSpace, typename KernelType, typename... DataTypes>
+  void for_all_cellmat_impl(const TraversalInfo& info,
+                            KernelType kernel,
+                            TraversalField<DataTypes>... fields);
+
   /*!
    * \brief Returns true if the dynamic relation corresponding to the given data
    *        layout is valid.
@@ -877,6 +1062,508 @@ slam::BivariateMap<T, BSetType> MultiMat::get2dFieldAsSlamBivarMap(
   return typedBMap;
 }
 
+template <typename ExecSpace, typename KernelType, typename... FieldTypes>
+void MultiMat::for_all_cells(KernelType&& kernel, FieldTypes&... fields)
+{
+  const TraversalInfo info = getTraversalInfo(fields...);
+  for_all_rows_impl<ExecSpace>(
+    true,
+    info,
+    kernel,
+    TraversalField<typename FieldTypes::DataType> {fields.getMap()->data().data(),
+                                                   fields.numComp()}...);
+}
+
+template <typename ExecSpace, typename KernelType, typename... FieldTypes>
+void MultiMat::for_all_materials(KernelType&& kernel, FieldTypes&... fields)
+{
+  const TraversalInfo info = getTraversalInfo(fields...);
+  for_all_rows_impl<ExecSpace>(
+    false,
+    info,
+    kernel,
+    TraversalField<typename FieldTypes::DataType> {fields.getMap()->data().data(),
+                                                   fields.numComp()}...);
+}
+
+template <typename ExecSpace, typename KernelType, typename... FieldTypes>
+void MultiMat::for_all_cellmat(KernelType&& kernel, FieldTypes&... fields)
+{
+  const TraversalInfo info = getTraversalInfo(fields...);
+  for_all_cellmat_impl<ExecSpace>(
+    info,
+    kernel,
+    TraversalField<typename FieldTypes::DataType> {fields.getMap()->data().data(),
+                                                   fields.numComp()}...);
+}
+
+template <typename FieldType, typename... FieldTypes>
+MultiMat::TraversalInfo MultiMat::getTraversalInfo(const FieldType& field,
+                                                   const FieldTypes&... fields)
+{
+  const bool sameLayout[] = {true,
+                             (fields.isDense() == field.isDense() &&
+                              fields.isCellDom() == field.isCellDom())...};
+  for(bool same : sameLayout)
+  {
+    SLIC_ERROR_IF(!same,
+                  "MultiMat: fields of a fused traversal must share the same "
+                  "data and sparsity layout.");
+  }
+
+  const DataLayout layout =
+    field.isCellDom() ? DataLayout::CELL_DOM : DataLayout::MAT_DOM;
+
+  TraversalInfo info;
+  info.isDense = field.isDense();
+  info.isCellDom = field.isCellDom();
+  info.numCells = m_ncells;
+  info.numMats = m_nmats;
+  info.begins = nullptr;
+  info.indices = nullptr;
+  if(!info.isDense)
+  {
+    SLIC_ASSERT(hasValidStaticRelation(layout));
+    info.begins = relBeginVec(layout).data();
+    info.indices = relIndVec(layout).data();
+  }
+
+  return info;
+}
+
+template <typename ExecSpace, typename KernelType, typename... DataTypes>
+void MultiMat::for_all_rows_impl(bool overCells,
+                                 const TraversalInfo& info,
+                                 KernelType kernel,
+                                 TraversalField<DataTypes>... fields)
+{
+  const int ncells = info.numCells;
+  const int nmats = info.numMats;
+
+  if(info.isDense)
+  {
+    // Entries of a dense field are at (dominant * numSecondary + secondary)
+    const int cellStride = info.isCellDom ? nmats : 1;
+    const int matStride = info.isCellDom ? 1 : ncells;
+    if(overCells)
+    {
+      axom::for_all<ExecSpace>(
+        ncells,
+        AXOM_LAMBDA(axom::IndexType c) {
+          for(int m = 0; m < nmats; ++m)
+          {
+            const SetPosType idx = c * cellStride + m * matStride;
+            kernel(c, m, fields[idx]...);
+          }
+        });
+    }
+    else
+    {
+      axom::for_all<ExecSpace>(
+        nmats,
+        AXOM_LAMBDA(axom::IndexType m) {
+          for(int c = 0; c < ncells; ++c)
+          {
+            const SetPosType idx = c * cellStride + m * matStride;
+            kernel(c, m, fields[idx]...);
+          }
+        });
+    }
+    return;
+  }
+
+  // Sparse fields are traversed along the rows of their relation. When the
+  // rows do not run over the requested set, we traverse a transposed copy.
+  const SetPosType* begins = info.begins;
+  const SetPosType* indices = info.indices;
+  const SetPosType* positions = nullptr;
+
+  IndBufferType transBegins, transIndices, transPositions;
+  if(overCells != info.isCellDom)
+  {
+    transposeTraversal(info, transBegins, transIndices, transPositions);
+    begins = transBegins.data();
+    indices = transIndices.data();
+    positions = transPositions.data();
+  }
+
+  if(overCells)
+  {
+    axom::for_all<ExecSpace>(
+      ncells,
+      AXOM_LAMBDA(axom::IndexType c) {
+        for(SetPosType j = begins[c]; j < begins[c + 1]; ++j)
+        {
+          const SetPosType idx = positions != nullptr ? positions[j] : j;
+          kernel(c, indices[j], fields[idx]...);
+        }
+      });
+  }
+  else
+  {
+    axom::for_all<ExecSpace>(
+      nmats,
+      AXOM_LAMBDA(axom::IndexType m) {
+        for(SetPosType j = begins[m]; j < begins[m + 1]; ++j)
+        {
+          const SetPosType idx = positions != nullptr ? positions[j] : j;
+          kernel(indices[j], m, fields[idx]...);
+        }
+      });
+  }
+}
+
+template <typename ExecSpace, typename KernelType, typename... DataTypes>
+void MultiMat::for_all_cellmat_impl(const TraversalInfo& info,
+                                    KernelType kernel,
+                                    TraversalField<DataTypes>... fields)
+{
+  if(!info.isDense)
+  {
+    for_all_rows_impl<ExecSpace>(info.isCellDom, info, kernel, fields...);
+    return;
+  }
+
+  // Dense fields are traversed as a flat array
+  const int ncells = info.numCells;
+  const int nmats = info.numMats;
+  if(info.isCellDom)
+  {
+    axom::for_all<ExecSpace>(
+      ncells * nmats,
+      AXOM_LAMBDA(axom::IndexType idx) {
+        kernel(idx / nmats, idx % nmats, fields[idx]...);
+      });
+  }
+  else
+  {
+    axom::for_all<ExecSpace>(
+      ncells * nmats,
+      AXOM_LAMBDA(axom::IndexType idx) {
+        kernel(idx % ncells, idx / ncells, fields[idx]...);
+      });
+  }
+}
+
+template <typename ExecSpace>
+void MultiMat::updateEntries(const std::vector<std::pair<int, int>>& added,
+                             const std::vector<std::pair<int, int>>& removed)
+{
+  EntryChanges changes;
+  IndBufferType positions;
+  for(DataLayout layout : {DataLayout::CELL_DOM, DataLayout::MAT_DOM})
+  {
+    const bool hasRelation = m_dynamic_mode ? hasValidDynamicRelation(layout)
+                                            : hasValidStaticRelation(layout);
+    if(!hasRelation)
+    {
+      // We don't have a relation for this layout type
+      continue;
+    }
+
+    buildEntryChanges(layout, added, removed, changes);
+    if(changes.rows.empty())
+    {
+      continue;
+    }
+
+    if(m_dynamic_mode)
+    {
+      updateDynamicRelation<ExecSpace>(layout, changes);
+    }
+    else
+    {
+      updateStaticRelation<ExecSpace>(layout, changes, positions);
+    }
+
+    for(int i = 0; i < getNumberOfFields(); ++i)
+    {
+      if(m_mapVec[i] == nullptr ||
+         m_fieldMappingVec[i] != FieldMapping::PER_CELL_MAT ||
+         m_fieldDataLayoutVec[i] != layout)
+      {
+        continue;
+      }
+
+      switch(m_dataTypeVec[i])
+      {
+      case DataTypeSupported::TypeDouble:
+        updateFieldEntries<ExecSpace, double>(i, changes, positions);
+        break;
+      case DataTypeSupported::TypeFloat:
+        updateFieldEntries<ExecSpace, float>(i, changes, positions);
+        break;
+      case DataTypeSupported::TypeInt:
+        updateFieldEntries<ExecSpace, int>(i, changes, positions);
+        break;
+      case DataTypeSupported::TypeUnsignChar:
+        updateFieldEntries<ExecSpace, unsigned char>(i, changes, positions);
+        break;
+      default:
+        SLIC_ASSERT(false);
+      }
+    }
+  }
+}
+
+template <typename ExecSpace>
+void MultiMat::updateStaticRelation(DataLayout layout,
+                                    const EntryChanges& changes,
+                                    IndBufferType& positions)
+{
+  const int numDominant = relDominantSet(layout).size();
+  const int numAffected = changes.rows.size();
+
+  IndBufferType& beginsVec = relBeginVec(layout);
+  IndBufferType& indicesVec = relIndVec(layout);
+
+  // Edit each affected row into a scratch buffer with room for its insertions
+  IndBufferType scratchBegins(numAffected + 1, 0);
+  for(int k = 0; k < numAffected; ++k)
+  {
+    const SetPosType row = changes.rows[k];
+    scratchBegins[k + 1] = scratchBegins[k] + beginsVec[row + 1] -
+      beginsVec[row] + changes.begins[k + 1] - changes.begins[k];
+  }
+  IndBufferType scratchIndices(scratchBegins[numAffected]);
+  IndBufferType scratchPositions(scratchBegins[numAffected]);
+  IndBufferType scratchSizes(numAffected);
+
+  {
+    const SetPosType* rows = changes.rows.data();
+    const SetPosType* changeBegins = changes.begins.data();
+    const SetPosType* secondary = changes.secondary.data();
+    const SetPosType* isAddition = changes.isAddition.data();
+    const SetPosType* begins = beginsVec.data();
+    const SetPosType* indices = indicesVec.data();
+    const SetPosType* rowOffsets = scratchBegins.data();
+    SetPosType* rowIndices = scratchIndices.data();
+    SetPosType* rowPositions = scratchPositions.data();
+    SetPosType* rowSizes = scratchSizes.data();
+
+    axom::for_all<ExecSpace>(
+      numAffected,
+      AXOM_LAMBDA(axom::IndexType k) {
+        const SetPosType row = rows[k];
+        SetPosType* newIndices = rowIndices + rowOffsets[k];
+        SetPosType* newPositions = rowPositions + rowOffsets[k];
+        SetPosType n = 0;
+
+        // Keep the entries that are not removed ...
+        for(SetPosType j = begins[row]; j < begins[row + 1]; ++j)
+        {
+          bool isRemoved = false;
+          for(SetPosType c = changeBegins[k]; c < changeBegins[k + 1]; ++c)
+          {
+            isRemoved |= (!isAddition[c] && secondary[c] == indices[j]);
+          }
+          if(!isRemoved)
+          {
+            newIndices[n] = indices[j];
+            newPositions[n] = j;
+            ++n;
+          }
+        }
+
+        // ... append the insertions that are not present yet ...
+        for(SetPosType c = changeBegins[k]; c < changeBegins[k + 1]; ++c)
+        {
+          bool isPresent = !isAddition[c];
+          for(SetPosType i = 0; i < n && !isPresent; ++i)
+          {
+            isPresent = (newIndices[i] == secondary[c]);
+          }
+          if(!isPresent)
+          {
+            newIndices[n] = secondary[c];
+            newPositions[n] = -1;
+            ++n;
+          }
+        }
+
+        // ... and keep the row sorted
+        for(SetPosType i = 1; i < n; ++i)
+        {
+          const SetPosType idx = newIndices[i];
+          const SetPosType pos = newPositions[i];
+          SetPosType j = i;
+          for(; j > 0 && newIndices[j - 1] > idx; --j)
+          {
+            newIndices[j] = newIndices[j - 1];
+            newPositions[j] = newPositions[j - 1];
+          }
+          newIndices[j] = idx;
+          newPositions[j] = pos;
+        }
+
+        rowSizes[k] = n;
+      });
+  }
+
+  // Compute the offsets of the updated relation
+  IndBufferType affectedRow(numDominant, -1);
+  IndBufferType newBeginsVec(numDominant + 1, 0);
+  for(int k = 0; k < numAffected; ++k)
+  {
+    affectedRow[changes.rows[k]] = k;
+  }
+  for(int r = 0; r < numDominant; ++r)
+  {
+    const SetPosType k = affectedRow[r];
+    const SetPosType size =
+      (k < 0) ? beginsVec[r + 1] - beginsVec[r] : scratchSizes[k];
+    newBeginsVec[r + 1] = newBeginsVec[r] + size;
+  }
+
+  // Assemble the updated relation; unaffected rows are copied over
+  IndBufferType newIndicesVec(newBeginsVec[numDominant]);
+  positions.resize(newBeginsVec[numDominant]);
+  {
+    const SetPosType* affected = affectedRow.data();
+    const SetPosType* begins = beginsVec.data();
+    const SetPosType* indices = indicesVec.data();
+    const SetPosType* newBegins = newBeginsVec.data();
+    const SetPosType* rowOffsets = scratchBegins.data();
+    const SetPosType* rowIndices = scratchIndices.data();
+    const SetPosType* rowPositions = scratchPositions.data();
+    SetPosType* newIndices = newIndicesVec.data();
+    SetPosType* newPositions = positions.data();
+
+    axom::for_all<ExecSpace>(
+      numDominant,
+      AXOM_LAMBDA(axom::IndexType r) {
+        const SetPosType k = affected[r];
+        const SetPosType size = newBegins[r + 1] - newBegins[r];
+        for(SetPosType i = 0; i < size; ++i)
+        {
+          const SetPosType dst = newBegins[r] + i;
+          if(k < 0)
+          {
+            newIndices[dst] = indices[begins[r] + i];
+            newPositions[dst] = begins[r] + i;
+          }
+          else
+          {
+            newIndices[dst] = rowIndices[rowOffsets[k] + i];
+            newPositions[dst] = rowPositions[rowOffsets[k] + i];
+          }
+        }
+      });
+  }
+
+  beginsVec.swap(newBeginsVec);
+  indicesVec.swap(newIndicesVec);
+
+  RangeSetType& set1 = relDominantSet(layout);
+  RangeSetType& set2 = relSecondarySet(layout);
+
+  StaticVariableRelationType& rel = relStatic(layout);
+  rel = StaticVariableRelationType(&set1, &set2);
+  rel.bindBeginOffsets(set1.size(), &beginsVec);
+  rel.bindIndices(indicesVec.size(), &indicesVec);
+  SLIC_ASSERT(rel.isValid());
+
+  relSparseSet(layout) = RelationSetType(&rel);
+  SLIC_ASSERT(relSparseSet(layout).isValid());
+}
+
+template <typename ExecSpace>
+void MultiMat::updateDynamicRelation(DataLayout layout,
+                                     const EntryChanges& changes)
+{
+  DynamicVariableRelationType* relDyn = &relDynamic(layout);
+  const SetPosType* rows = changes.rows.data();
+  const SetPosType* changeBegins = changes.begins.data();
+  const SetPosType* secondary = changes.secondary.data();
+  const SetPosType* isAddition = changes.isAddition.data();
+
+  // Each row of the dynamic relation is a separate vector; insertions keep
+  // sorted rows sorted
+  axom::for_all<ExecSpace>(
+    changes.rows.size(),
+    AXOM_LAMBDA(axom::IndexType k) {
+      auto& rel_vec = relDyn->data(rows[k]);
+      for(SetPosType c = changeBegins[k]; c < changeBegins[k + 1]; ++c)
+      {
+        auto found_iter =
+          std::find(rel_vec.begin(), rel_vec.end(), secondary[c]);
+        if(isAddition[c] && found_iter == rel_vec.end())
+        {
+          rel_vec.insert(
+            std::lower_bound(rel_vec.begin(), rel_vec.end(), secondary[c]),
+            secondary[c]);
+        }
+        else if(!isAddition[c] && found_iter != rel_vec.end())
+        {
+          rel_vec.erase(found_iter);
+        }
+      }
+    });
+}
+
+template <typename ExecSpace, typename DataType>
+void MultiMat::updateFieldEntries(int field_idx,
+                                  const EntryChanges& changes,
+                                  const IndBufferType& positions)
+{
+  Field2D<DataType>& old_map =
+    *dynamic_cast<Field2D<DataType>*>(m_mapVec[field_idx].get());
+  const int stride = old_map.stride();
+
+  if(m_fieldSparsityLayoutVec[field_idx] == SparsityLayout::DENSE)
+  {
+    // Zero out the removed entries
+    DataType* data = old_map.getMap()->data().data();
+    const SetPosType* rows = changes.rows.data();
+    const SetPosType* changeBegins = changes.begins.data();
+    const SetPosType* secondary = changes.secondary.data();
+    const SetPosType* isAddition = changes.isAddition.data();
+    const SetPosType numSecondary = old_map.secondSetSize();
+
+    axom::for_all<ExecSpace>(
+      changes.rows.size(),
+      AXOM_LAMBDA(axom::IndexType k) {
+        for(SetPosType c = changeBegins[k]; c < changeBegins[k + 1]; ++c)
+        {
+          if(!isAddition[c])
+          {
+            const SetPosType idx = rows[k] * numSecondary + secondary[c];
+            for(int s = 0; s < stride; ++s)
+            {
+              data[idx * stride + s] = DataType {};
+            }
+          }
+        }
+      });
+    return;
+  }
+
+  // Gather the values of a sparse field into the updated relation
+  std::vector<DataType> arr_data(positions.size() * stride);
+  {
+    const DataType* oldData = old_map.getMap()->data().data();
+    const SetPosType* oldPositions = positions.data();
+    DataType* newData = arr_data.data();
+
+    axom::for_all<ExecSpace>(
+      positions.size(),
+      AXOM_LAMBDA(axom::IndexType j) {
+        const SetPosType pos = oldPositions[j];
+        for(int s = 0; s < stride; ++s)
+        {
+          newData[j * stride + s] =
+            (pos < 0) ? DataType {} : oldData[pos * stride + s];
+        }
+      });
+  }
+
+  RelationSetType* nz_set = &relSparseSet(m_fieldDataLayoutVec[field_idx]);
+  Field2D<DataType>* new_field =
+    new Field2D<DataType>(*this, nz_set, old_map.getName(), arr_data.data(), stride);
+
+  m_mapVec[field_idx].reset(new_field);
+}
+
 }  //end namespace multimat
 }  //end namespace axom
 
@@ -15,6 +15,8 @@
 
 #include "axom/slic.hpp"
 
+#include <algorithm>
+
 using namespace axom::multimat;
 
 TEST(multimat, construct_empty_multimat_obj)
@@ -652,6 +654,241 @@ TEST(multimat, test_dynamic_multimat_1_array)
   }
 }
 
+/* Test batched insertion and removal of entries */
+TEST(multimat, test_update_entries)
+{
+  using ExecSpace = axom::SEQ_EXEC;
+
+  const int num_cells = 20;
+  const int num_mats = 10;
+  const int stride_val = 1;
+
+  std::vector<DataLayout> data_layouts = {DataLayout::CELL_DOM,
+                                          DataLayout::MAT_DOM};
+  std::vector<SparsityLayout> sparsity_layouts = {SparsityLayout::DENSE,
+                                                  SparsityLayout::SPARSE};
+
+  std::string array_name = "Array 1";
+
+  for(bool use_dynamic : {false, true})
+  {
+    for(auto layout_used : data_layouts)
+    {
+      for(auto sparsity_used : sparsity_layouts)
+      {
+        MM_test_data<double> data(num_cells, num_mats, stride_val);
+        MultiMat* mm_ptr = newMM(data, layout_used, sparsity_used, array_name);
+        MultiMat& mm = *mm_ptr;
+        SLIC_INFO("Updating entries with layout: "
+                  << mm.getFieldDataLayoutAsString(0) << " and "
+                  << mm.getFieldSparsityLayoutAsString(0)
+                  << (use_dynamic ? " in dynamic mode" : ""));
+
+        if(use_dynamic)
+        {
+          mm.convertToDynamic();
+        }
+
+        // Remove some of the entries and insert some of the missing ones
+        std::vector<std::pair<int, int>> added, removed;
+        std::vector<bool> is_added(num_cells * num_mats, false);
+        for(int ci = 0; ci < num_cells; ++ci)
+        {
+          for(int mi = 0; mi < num_mats; ++mi)
+          {
+            const int idx = ci * num_mats + mi;
+            if(data.fillBool_cellcen[idx] && mi % 2 == 0)
+            {
+              removed.push_back({ci, mi});
+              data.setVal(ci, mi, 0.);
+            }
+            else if(!data.fillBool_cellcen[idx] && (ci + mi) % 4 == 1)
+            {
+              added.push_back({ci, mi});
+              is_added[idx] = true;
+              data.setVal(ci, mi, 1.);
+            }
+          }
+        }
+        ASSERT_FALSE(added.empty());
+        ASSERT_FALSE(removed.empty());
+
+        // Inserting a present entry or removing a missing one is a no-op
+        added.push_back(added.front());
+        removed.push_back(removed.front());
+
+        mm.updateEntries<ExecSpace>(added, removed);
+
+        // Inserted entries start out as zero
+        auto& volfrac = mm.getVolfracField();
+        auto& arr = mm.get2dField<double>(array_name);
+        int num_visits = 0;
+        mm.for_all_cells<ExecSpace>(
+          [&](int c, int m, double& vf, double& val) {
+            const int idx = c * num_mats + m;
+            num_visits++;
+            if(is_added[idx])
+            {
+              EXPECT_EQ(vf, 0.);
+              EXPECT_EQ(val, 0.);
+              vf = data.volfrac_cellcen_dense[idx];
+              val = data.cellmat_dense_arr[idx];
+            }
+          },
+          volfrac,
+          arr);
+        if(sparsity_used == SparsityLayout::SPARSE && !use_dynamic)
+        {
+          const int num_filled = std::count(data.fillBool_cellcen.begin(),
+                                            data.fillBool_cellcen.end(),
+                                            true);
+          EXPECT_EQ(num_filled, num_visits);
+        }
+
+        // Rescale the volume fractions so that they sum to one in each cell
+        std::vector<double> volfrac_sum(num_cells, 0.);
+        mm.for_all_cells<ExecSpace>(
+          [&](int c, int, double& vf) { volfrac_sum[c] += vf; },
+          volfrac);
+        mm.for_all_cells<ExecSpace>(
+          [&](int c, int, double& vf) { vf /= volfrac_sum[c]; },
+          volfrac);
+
+        EXPECT_TRUE(mm.isValid(true));
+        check_values<double>(mm, array_name, data);
+
+        if(use_dynamic)
+        {
+          mm.convertToStatic();
+          EXPECT_TRUE(mm.isValid(true));
+          check_values<double>(mm, array_name, data);
+        }
+
+        delete mm_ptr;
+      }
+    }
+  }
+}
+
+/* Checks the execution-space traversal kernels over 2D fields. Kernels only
+ * write to data of their own entry, or of their own cell or material, so that
+ * they can run in parallel. */
+template <typename ExecSpace>
+void check_traverse_fields()
+{
+  const int num_cells = 20;
+  const int num_mats = 10;
+  const int stride_val = 1;
+  MM_test_data<double> data(num_cells, num_mats, stride_val);
+
+  std::vector<DataLayout> data_layouts = {DataLayout::CELL_DOM,
+                                          DataLayout::MAT_DOM};
+  std::vector<SparsityLayout> sparsity_layouts = {SparsityLayout::DENSE,
+                                                  SparsityLayout::SPARSE};
+
+  std::string array_name = "Array 1";
+
+  for(auto layout_used : data_layouts)
+  {
+    for(auto sparsity_used : sparsity_layouts)
+    {
+      MultiMat* mm_ptr = newMM(data, layout_used, sparsity_used, array_name);
+      MultiMat& mm = *mm_ptr;
+      SLIC_INFO("Traversing layout: " << mm.getFieldDataLayoutAsString(0)
+                                      << " and "
+                                      << mm.getFieldSparsityLayoutAsString(0));
+
+      const bool is_dense = sparsity_used == SparsityLayout::DENSE;
+      std::vector<int> expected_visits(num_cells * num_mats);
+      for(int i = 0; i < num_cells * num_mats; ++i)
+      {
+        expected_visits[i] = is_dense || data.fillBool_cellcen[i] ? 1 : 0;
+      }
+
+      auto& volfrac = mm.getVolfracField();
+      auto& arr = mm.get2dField<double>(array_name);
+
+      // Per-cell traversal visits the materials of each cell in order
+      std::vector<int> visits(num_cells * num_mats, 0);
+      std::vector<int> last_mat(num_cells, -1);
+      std::vector<int> cell_ok(num_cells, 1);
+      mm.for_all_cells<ExecSpace>(
+        [&](int c, int m, double& vf, double& val) {
+          const int idx = c * num_mats + m;
+          visits[idx]++;
+          if(last_mat[c] >= m || vf != data.volfrac_cellcen_dense[idx] ||
+             val != data.cellmat_dense_arr[idx])
+          {
+            cell_ok[c] = 0;
+          }
+          last_mat[c] = m;
+        },
+        volfrac,
+        arr);
+      EXPECT_EQ(visits, expected_visits);
+      EXPECT_EQ(cell_ok, std::vector<int>(num_cells, 1));
+
+      // Per-material traversal visits the cells of each material in order
+      std::fill(visits.begin(), visits.end(), 0);
+      std::vector<int> last_cell(num_mats, -1);
+      std::vector<int> mat_ok(num_mats, 1);
+      mm.for_all_materials<ExecSpace>(
+        [&](int c, int m, double& val) {
+          const int idx = c * num_mats + m;
+          visits[idx]++;
+          if(last_cell[m] >= c || val != data.cellmat_dense_arr[idx])
+          {
+            mat_ok[m] = 0;
+          }
+          last_cell[m] = c;
+        },
+        arr);
+      EXPECT_EQ(visits, expected_visits);
+      EXPECT_EQ(mat_ok, std::vector<int>(num_mats, 1));
+
+      // Fused traversal in storage order can update the fields
+      std::fill(visits.begin(), visits.end(), 0);
+      std::vector<int> entry_ok(num_cells * num_mats, 1);
+      mm.for_all_cellmat<ExecSpace>(
+        [&](int c, int m, double& vf, double& val) {
+          const int idx = c * num_mats + m;
+          visits[idx]++;
+          if(vf != data.volfrac_cellcen_dense[idx])
+          {
+            entry_ok[idx] = 0;
+          }
+          val *= 2.;
+        },
+        volfrac,
+        arr);
+      EXPECT_EQ(visits, expected_visits);
+
+      mm.for_all_cells<ExecSpace>(
+        [&](int c, int m, double& val) {
+          const int idx = c * num_mats + m;
+          if(val != 2. * data.cellmat_dense_arr[idx])
+          {
+            entry_ok[idx] = 0;
+          }
+        },
+        arr);
+      EXPECT_EQ(entry_ok, std::vector<int>(num_cells * num_mats, 1));
+
+      delete mm_ptr;
+    }
+  }
+}
+
+/* Test the execution-space traversal kernels over 2D fields */
+TEST(multimat, traverse_fields)
+{
+  check_traverse_fields<axom::SEQ_EXEC>();
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+  check_traverse_fields<axom::OMP_EXEC>();
+#endif
+}
+
 //----------------------------------------------------------------------
 
 int main(int argc, char* argv[])
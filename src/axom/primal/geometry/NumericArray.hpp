@@ -130,7 +130,7 @@ NumericArray<T, SIZE> operator/(const NumericArray<T, SIZE>& arr, double scalar)
  * \return A NumericArray whose coordinates are the absolute value of arr
  */
 template <typename T, int SIZE>
-NumericArray<T, SIZE> abs(const NumericArray<T, SIZE>& arr);
+AXOM_HOST_DEVICE NumericArray<T, SIZE> abs(const NumericArray<T, SIZE>& arr);
 
 /*!
  * \brief Overloaded output operator for numeric arrays
@@ -815,7 +815,8 @@ inline NumericArray<T, SIZE> operator-(const NumericArray<T, SIZE>& arr)
 
 //------------------------------------------------------------------------------
 template <typename T, int SIZE>
-inline NumericArray<T, SIZE> abs(const NumericArray<T, SIZE>& arr)
+AXOM_HOST_DEVICE inline NumericArray<T, SIZE> abs(
+  const NumericArray<T, SIZE>& arr)
 {
   NumericArray<T, SIZE> result(arr);
 
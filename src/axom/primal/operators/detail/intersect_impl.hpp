@@ -827,10 +827,10 @@ inline bool crossEdgesDisjoint(double d0, double d1, double r)
  * no. 1, 65–82, 2013  http://jcgt.org/published/0002/01/05/
  */
 template <typename T>
-bool intersect_tri_ray(const Triangle<T, 3>& tri,
-                       const Ray<T, 3>& R,
-                       T& t,
-                       Point<double, 3>& p)
+AXOM_HOST_DEVICE bool intersect_tri_ray(const Triangle<T, 3>& tri,
+                                        const Ray<T, 3>& R,
+                                        T& t,
+                                        Point<double, 3>& p)
 {
   // Ray origins inside of the triangle are considered a miss.
   // This is a good thing, as pointed out by Matt Larsen in January 2017,
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ * \file winding_number.hpp
+ *
+ * \brief Consists of methods that compute the generalized winding number
+ *  of a query point with respect to linear surface elements, i.e., segments
+ *  in 2D and triangles in 3D.
+ *
+ * Summing these over the elements of a surface mesh gives its generalized
+ * winding number, which is an integer for closed, consistently oriented
+ * surfaces and degrades gracefully for surfaces with gaps or overlaps.
+ */
+
+#ifndef AXOM_PRIMAL_WINDING_NUMBER_HPP_
+#define AXOM_PRIMAL_WINDING_NUMBER_HPP_
+
+// Axom includes
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Segment.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+
+// C/C++ includes
+#include <cmath>
+
+namespace axom
+{
+namespace primal
+{
+/*!
+ * \brief Computes the generalized winding number of a point with respect to
+ *  a segment
+ *
+ * \param [in] q The query point
+ * \param [in] seg The segment
+ *
+ * The winding number is the signed angle subtended by the segment at the
+ * query point, divided by \f$ 2\pi \f$. It is positive when the segment goes
+ * counterclockwise around the query point, so that segments of a closed
+ * polygon with counterclockwise orientation sum to one for interior points.
+ *
+ * \return the generalized winding number, in [-1/2, 1/2]
+ */
+template <typename T>
+AXOM_HOST_DEVICE inline double winding_number(const Point<T, 2>& q,
+                                              const Segment<T, 2>& seg)
+{
+  const Vector<T, 2> a(q, seg.source());
+  const Vector<T, 2> b(q, seg.target());
+
+  const double cross = a[0] * b[1] - a[1] * b[0];
+  return 0.5 * M_1_PI * atan2(cross, a.dot(b));
+}
+
+/*!
+ * \brief Computes the generalized winding number of a point with respect to
+ *  a triangle
+ *
+ * \param [in] q The query point
+ * \param [in] tri The triangle
+ *
+ * The winding number is the signed solid angle subtended by the triangle at
+ * the query point, divided by \f$ 4\pi \f$. It uses the formula of
+ * Van Oosterom and Strackee, and is positive when the query point is behind
+ * the triangle, i.e., on the opposite side of its (right-handed) normal.
+ * Triangles of a closed surface with outward normals thus sum to one for
+ * interior points.
+ *
+ * \return the generalized winding number, in [-1/2, 1/2]
+ */
+template <typename T>
+AXOM_HOST_DEVICE inline double winding_number(const Point<T, 3>& q,
+                                              const Triangle<T, 3>& tri)
+{
+  const Vector<T, 3> a(q, tri[0]);
+  const Vector<T, 3> b(q, tri[1]);
+  const Vector<T, 3> c(q, tri[2]);
+
+  const double la = a.norm();
+  const double lb = b.norm();
+  const double lc = c.norm();
+
+  const double numerator = Vector<T, 3>::scalar_triple_product(a, b, c);
+  const double denominator =
+    la * lb * lc + a.dot(b) * lc + a.dot(c) * lb + b.dot(c) * la;
+
+  return 0.5 * M_1_PI * atan2(numerator, denominator);
+}
+
+}  // namespace primal
+}  // namespace axom
+
+#endif  // AXOM_PRIMAL_WINDING_NUMBER_HPP_
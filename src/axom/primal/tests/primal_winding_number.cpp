@@ -307,6 +307,80 @@ TEST(primal_winding_number, self_intersecting_cases)
               abs_tol);
 }
 
+TEST(primal_winding_number, segments_and_triangles)
+{
+  using Point2D = primal::Point<double, 2>;
+  using Segment2D = primal::Segment<double, 2>;
+  using Point3D = primal::Point<double, 3>;
+  using Triangle3D = primal::Triangle<double, 3>;
+
+  const double abs_tol = 1e-12;
+
+  // Unit square with counterclockwise orientation
+  Point2D sq[] = {Point2D {0.0, 0.0},
+                  Point2D {1.0, 0.0},
+                  Point2D {1.0, 1.0},
+                  Point2D {0.0, 1.0}};
+  auto square_wn = [&](const Point2D& q, int numEdges) {
+    double wn = 0.;
+    for(int i = 0; i < numEdges; ++i)
+    {
+      wn += winding_number(q, Segment2D(sq[i], sq[(i + 1) % 4]));
+    }
+    return wn;
+  };
+
+  EXPECT_NEAR(square_wn(Point2D {0.5, 0.5}, 4), 1.0, abs_tol);
+  EXPECT_NEAR(square_wn(Point2D {0.2, 0.7}, 4), 1.0, abs_tol);
+  EXPECT_NEAR(square_wn(Point2D {1.5, 0.5}, 4), 0.0, abs_tol);
+  EXPECT_NEAR(square_wn(Point2D {-3., 2.0}, 4), 0.0, abs_tol);
+
+  // Open polyline: the center sees three quarters of the full turn
+  EXPECT_NEAR(square_wn(Point2D {0.5, 0.5}, 3), 0.75, abs_tol);
+
+  // Reversed segment flips the sign
+  EXPECT_NEAR(winding_number(Point2D {0.5, 0.5}, Segment2D(sq[1], sq[0])),
+              -0.25,
+              abs_tol);
+
+  // Unit tetrahedron with outward normals
+  Point3D tet[] = {Point3D {0.0, 0.0, 0.0},
+                   Point3D {1.0, 0.0, 0.0},
+                   Point3D {0.0, 1.0, 0.0},
+                   Point3D {0.0, 0.0, 1.0}};
+  Triangle3D faces[] = {Triangle3D(tet[0], tet[2], tet[1]),
+                        Triangle3D(tet[0], tet[1], tet[3]),
+                        Triangle3D(tet[0], tet[3], tet[2]),
+                        Triangle3D(tet[1], tet[2], tet[3])};
+  auto tet_wn = [&](const Point3D& q, int numFaces) {
+    double wn = 0.;
+    for(int i = 0; i < numFaces; ++i)
+    {
+      wn += winding_number(q, faces[i]);
+    }
+    return wn;
+  };
+
+  EXPECT_NEAR(tet_wn(Point3D {0.1, 0.2, 0.3}, 4), 1.0, abs_tol);
+  EXPECT_NEAR(tet_wn(Point3D {0.25, 0.25, 0.25}, 4), 1.0, abs_tol);
+  EXPECT_NEAR(tet_wn(Point3D {1.0, 1.0, 1.0}, 4), 0.0, abs_tol);
+  EXPECT_NEAR(tet_wn(Point3D {-2., 0.5, 0.1}, 4), 0.0, abs_tol);
+
+  // A single face of a cube seen from its center subtends a sixth of the
+  // full solid angle, split evenly between its two triangles
+  Point3D cube[] = {Point3D {-1.0, -1.0, 1.0},
+                    Point3D {1.0, -1.0, 1.0},
+                    Point3D {1.0, 1.0, 1.0},
+                    Point3D {-1.0, 1.0, 1.0}};
+  const Point3D center {0.0, 0.0, 0.0};
+  EXPECT_NEAR(winding_number(center, Triangle3D(cube[0], cube[1], cube[2])),
+              1. / 12.,
+              abs_tol);
+  EXPECT_NEAR(winding_number(center, Triangle3D(cube[0], cube[2], cube[1])),
+              -1. / 12.,
+              abs_tol);
+}
+
 int main(int argc, char** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
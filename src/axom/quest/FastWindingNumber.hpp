@@ -0,0 +1,714 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_QUEST_FAST_WINDING_NUMBER_HPP_
+#define AXOM_QUEST_FAST_WINDING_NUMBER_HPP_
+
+// axom includes
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/core/utilities/AnnotationMacros.hpp"
+
+#include "axom/slic/interface/slic.hpp"
+
+// primal includes
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Segment.hpp"
+#include "axom/primal/geometry/Triangle.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+#include "axom/primal/utils/ZipPoint.hpp"
+#include "axom/primal/operators/winding_number.hpp"
+
+// spin includes
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+
+// quest includes
+#include "axom/quest/SignedDistance.hpp"  // for detail::UcdMeshData
+
+// mint includes
+#include "axom/mint/mesh/Mesh.hpp"
+#include "axom/mint/mesh/CellTypes.hpp"
+
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <cmath>
+#include <type_traits>
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+/*!
+ * \brief Geometric helpers for the surface elements of FastWindingNumber,
+ *  i.e., segments in 2D and triangles in 3D.
+ */
+template <int NDIMS>
+struct WindingNumberElement;
+
+template <>
+struct WindingNumberElement<2>
+{
+  using ElementType = primal::Segment<double, 2>;
+  using PointType = primal::Point<double, 2>;
+  using VectorType = primal::Vector<double, 2>;
+
+  static constexpr int NUM_VERTS = 2;
+
+  AXOM_HOST_DEVICE static ElementType make(const PointType* pts)
+  {
+    return ElementType(pts[0], pts[1]);
+  }
+
+  AXOM_HOST_DEVICE static const PointType& vertex(const ElementType& seg,
+                                                  int i)
+  {
+    return (i == 0) ? seg.source() : seg.target();
+  }
+
+  AXOM_HOST_DEVICE static PointType centroid(const ElementType& seg)
+  {
+    return PointType::midpoint(seg.source(), seg.target());
+  }
+
+  /// Returns the outward normal for counterclockwise polygons, scaled by length
+  AXOM_HOST_DEVICE static VectorType weightedNormal(const ElementType& seg)
+  {
+    const VectorType d(seg.source(), seg.target());
+    return VectorType {d[1], -d[0]};
+  }
+
+  /*!
+   * \brief Returns the dipole approximation of the winding number of a group
+   *  of segments, i.e., n . r / (2 pi |r|^2)
+   *
+   * \param [in] dipole the sum of the weighted normals n
+   * \param [in] r the vector from the query point to the group's centroid
+   */
+  AXOM_HOST_DEVICE static double dipole(const VectorType& dipole,
+                                        const VectorType& r)
+  {
+    return 0.5 * M_1_PI * dipole.dot(r) / r.squared_norm();
+  }
+};
+
+template <>
+struct WindingNumberElement<3>
+{
+  using ElementType = primal::Triangle<double, 3>;
+  using PointType = primal::Point<double, 3>;
+  using VectorType = primal::Vector<double, 3>;
+
+  static constexpr int NUM_VERTS = 3;
+
+  AXOM_HOST_DEVICE static ElementType make(const PointType* pts)
+  {
+    return ElementType(pts[0], pts[1], pts[2]);
+  }
+
+  AXOM_HOST_DEVICE static const PointType& vertex(const ElementType& tri,
+                                                  int i)
+  {
+    return tri[i];
+  }
+
+  AXOM_HOST_DEVICE static PointType centroid(const ElementType& tri)
+  {
+    return PointType::lerp(PointType::midpoint(tri[0], tri[1]),
+                           tri[2],
+                           1. / 3.);
+  }
+
+  /// Returns the right-handed normal, scaled by area
+  AXOM_HOST_DEVICE static VectorType weightedNormal(const ElementType& tri)
+  {
+    return 0.5 *
+      VectorType::cross_product(VectorType(tri[0], tri[1]),
+                                VectorType(tri[0], tri[2]));
+  }
+
+  /*!
+   * \brief Returns the dipole approximation of the winding number of a group
+   *  of triangles, i.e., n . r / (4 pi |r|^3)
+   *
+   * \param [in] dipole the sum of the weighted normals n
+   * \param [in] r the vector from the query point to the group's centroid
+   */
+  AXOM_HOST_DEVICE static double dipole(const VectorType& dipole,
+                                        const VectorType& r)
+  {
+    const double d2 = r.squared_norm();
+    return 0.25 * M_1_PI * dipole.dot(r) / (d2 * std::sqrt(d2));
+  }
+};
+
+}  // end namespace detail
+
+/*!
+ * \class FastWindingNumber
+ *
+ * \brief Computes the generalized winding number of query points with
+ *  respect to a surface mesh, and point containment from it.
+ *
+ * The generalized winding number is the sum of the signed solid angles (in
+ * 3D) or angles (in 2D) that the surface elements subtend at the query point,
+ * normalized by the full solid angle. For a closed, consistently oriented
+ * surface, it is one inside and zero outside. Unlike the ray casting or
+ * octree based containment queries, it degrades gracefully for surfaces with
+ * gaps, overlaps or unwelded vertices, and a point is considered inside when
+ * its winding number is at least one half.
+ *
+ * The elements are sorted along a Morton curve and grouped into a complete
+ * binary tree with a fixed number of elements per leaf. Each tree node stores
+ * the area-weighted sum of the normals of its elements, i.e., its dipole
+ * moment, at their area-weighted centroid, and the radius of a ball around
+ * the centroid that contains them. The contribution of a node whose ball is
+ * far enough from the query point, as controlled by setAccuracy(), is
+ * approximated by its dipole. Otherwise, the node's children are visited, and
+ * the elements of its leaves are summed exactly.
+ *
+ * \tparam NDIMS the dimension of the surface mesh, i.e., 2 for segment meshes
+ *  and 3 for triangle meshes. Quadrilaterals are split into two triangles.
+ * \tparam ExecSpace the execution space for building and querying the tree
+ *
+ * \note Segments of a 2D mesh should be oriented counterclockwise and
+ *  triangles of a 3D mesh should have outward normals, otherwise the winding
+ *  number is negative inside the surface.
+ *
+ * \see A. Jacobson, L. Kavan and O. Sorkine-Hornung, "Robust inside-outside
+ *  segmentation using generalized winding numbers", ACM TOG 32(4), 2013
+ * \see G. Barill, N. Dickson, R. Schmidt, D. Levin and A. Jacobson, "Fast
+ *  winding numbers for soups and clouds", ACM TOG 37(4), 2018
+ */
+template <int NDIMS, typename ExecSpace = axom::SEQ_EXEC>
+class FastWindingNumber
+{
+  AXOM_STATIC_ASSERT_MSG(NDIMS == 2 || NDIMS == 3,
+                         "FastWindingNumber requires a 2D or 3D mesh");
+
+  using ElementTraits = detail::WindingNumberElement<NDIMS>;
+
+public:
+  using PointType = primal::Point<double, NDIMS>;
+  using VectorType = primal::Vector<double, NDIMS>;
+  using BoxType = primal::BoundingBox<double, NDIMS>;
+  using ElementType = typename ElementTraits::ElementType;
+  using ZipPoint = primal::ZipIndexable<PointType>;
+
+  /// Number of surface elements in the leaves of the tree
+  static constexpr int LEAF_SIZE = 8;
+
+  /// Default ratio of the distance to a tree node to its radius, above which
+  /// the node is approximated by its dipole
+  static constexpr double DEFAULT_ACCURACY = 2.0;
+
+private:
+  /// Aggregate data of the surface elements in a tree node
+  struct NodeData
+  {
+    PointType center;   /*!< area-weighted centroid of the elements */
+    VectorType dipole;  /*!< sum of the area-weighted normals       */
+    double area;        /*!< total area (length in 2D)              */
+    double radius;      /*!< bounding radius, negative when empty   */
+  };
+
+public:
+  /*!
+   * \brief Creates a FastWindingNumber instance for queries on the given
+   *  surface mesh.
+   *
+   * \param [in] surfaceMesh user-supplied surface mesh of segments (2D) or
+   *  triangles and quadrilaterals (3D)
+   * \param [in] allocatorID the allocator for the tree (optional)
+   *
+   * \note The given surface mesh must be allocated in a memory space
+   *  compatible with the execution space.
+   *
+   * \note The surface elements are copied into the tree, so the surface
+   *  mesh is not used after construction.
+   *
+   * \pre surfaceMesh != nullptr
+   */
+  FastWindingNumber(
+    const mint::Mesh* surfaceMesh,
+    int allocatorID = axom::execution_space<ExecSpace>::allocatorID());
+
+  /*!
+   * \brief Sets the accuracy of the far-field approximation.
+   *
+   * A tree node is approximated by its dipole when the distance from the
+   * query point to its centroid is larger than \a beta times its radius.
+   * Larger values are more accurate and slower.
+   *
+   * \param [in] beta the accuracy parameter
+   *
+   * \pre beta > 1
+   */
+  void setAccuracy(double beta)
+  {
+    SLIC_ASSERT(beta > 1.);
+    m_beta = beta;
+  }
+
+  /// Returns the accuracy of the far-field approximation
+  double getAccuracy() const { return m_beta; }
+
+  /// Returns the number of surface elements, after splitting quadrilaterals
+  IndexType getNumberOfElements() const { return m_elements.size(); }
+
+  /*!
+   * \brief Computes the generalized winding number of a query point.
+   *
+   * \param [in] pt the query point
+   * \return the generalized winding number at \a pt
+   */
+  double computeWindingNumber(const PointType& pt) const;
+
+  /*!
+   * \brief Computes the generalized winding numbers of a batch of query
+   *  points in parallel.
+   *
+   * \param [in] npts the number of query points
+   * \param [in] queryPts an indexable of the query points
+   * \param [out] outWindingNumbers the generalized winding numbers
+   *
+   * \note queryPts and outWindingNumbers must be accessible in the
+   *  execution space.
+   *
+   * \pre outWindingNumbers != nullptr
+   */
+  template <typename PointIndexable>
+  void computeWindingNumbers(IndexType npts,
+                             PointIndexable queryPts,
+                             double* outWindingNumbers) const;
+
+  /*!
+   * \brief Tests whether a query point is inside the surface, i.e., whether
+   *  its generalized winding number is at least one half.
+   *
+   * \param [in] pt the query point
+   * \return true if the point is inside the surface
+   */
+  bool contains(const PointType& pt) const
+  {
+    return computeWindingNumber(pt) >= 0.5;
+  }
+
+  /*!
+   * \brief Tests a batch of query points for containment in parallel.
+   *
+   * \param [in] npts the number of query points
+   * \param [in] queryPts an indexable of the query points
+   * \param [out] outContained true for the points inside the surface
+   *
+   * \note queryPts and outContained must be accessible in the execution
+   *  space.
+   *
+   * \pre outContained != nullptr
+   */
+  template <typename PointIndexable>
+  void computeContainment(IndexType npts,
+                          PointIndexable queryPts,
+                          bool* outContained) const;
+
+private:
+  /// Copies the surface elements of the mesh, sorted along a Morton curve
+  void initializeElements(const mint::Mesh* surfaceMesh, int allocatorID);
+
+  /// Computes the aggregate data of the tree nodes, bottom-up
+  void initializeTree(int allocatorID);
+
+  /*!
+   * \brief Computes the generalized winding number of a query point.
+   *
+   * \param [in] qpt the query point
+   * \param [in] nodes the tree nodes, in heap order starting at index 1
+   * \param [in] elements the surface elements, sorted by leaf
+   * \param [in] numElements the number of surface elements
+   * \param [in] numLeaves the number of leaves, a power of two
+   * \param [in] beta the accuracy parameter
+   */
+  AXOM_HOST_DEVICE static double evaluate(const PointType& qpt,
+                                          const NodeData* nodes,
+                                          const ElementType* elements,
+                                          IndexType numElements,
+                                          IndexType numLeaves,
+                                          double beta);
+
+private:
+  axom::Array<ElementType> m_elements; /*!< sorted surface elements        */
+  axom::Array<NodeData> m_nodes;       /*!< tree nodes, in heap order      */
+  IndexType m_numLeaves;               /*!< number of leaves, power of two */
+  double m_beta;                       /*!< far-field accuracy parameter   */
+
+  DISABLE_COPY_AND_ASSIGNMENT(FastWindingNumber);
+};
+
+}  // end namespace quest
+}  // end namespace axom
+
+//------------------------------------------------------------------------------
+//           FastWindingNumber Implementation
+//------------------------------------------------------------------------------
+namespace axom
+{
+namespace quest
+{
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+FastWindingNumber<NDIMS, ExecSpace>::FastWindingNumber(
+  const mint::Mesh* surfaceMesh,
+  int allocatorID)
+  : m_elements(0, 0, allocatorID)
+  , m_nodes(0, 0, allocatorID)
+  , m_numLeaves(1)
+  , m_beta(DEFAULT_ACCURACY)
+{
+  AXOM_PERF_MARK_FUNCTION("FastWindingNumber::initialize");
+  SLIC_ASSERT(surfaceMesh != nullptr);
+  SLIC_ASSERT(surfaceMesh->getDimension() == NDIMS);
+
+  initializeElements(surfaceMesh, allocatorID);
+  initializeTree(allocatorID);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+void FastWindingNumber<NDIMS, ExecSpace>::initializeElements(
+  const mint::Mesh* surfaceMesh,
+  int allocatorID)
+{
+  namespace lbvh = spin::internal::linear_bvh;
+
+  const IndexType ncells = surfaceMesh->getNumberOfCells();
+
+  const double* xs = surfaceMesh->getCoordinateArray(0);
+  const double* ys = surfaceMesh->getCoordinateArray(1);
+  const double* zs =
+    (NDIMS == 3) ? surfaceMesh->getCoordinateArray(2) : nullptr;
+  ZipPoint meshPts {{xs, ys, zs}};
+
+  detail::UcdMeshData meshData;
+  const bool mesh_valid = detail::SD_GetUcdMeshData(surfaceMesh, meshData);
+  AXOM_UNUSED_VAR(mesh_valid);
+  SLIC_CHECK_MSG(mesh_valid, "Input mesh is not an unstructured surface mesh");
+
+  // number of surface elements for each cell, i.e., 2 for quadrilaterals
+  axom::Array<IndexType> offsets(ncells, ncells, allocatorID);
+  const auto offsets_v = offsets.view();
+  for_all<ExecSpace>(
+    ncells,
+    AXOM_LAMBDA(IndexType icell) {
+      const mint::CellType cellType = meshData.getCellType(icell);
+      IndexType count = 0;
+      if(NDIMS == 2)
+      {
+        count = (cellType == mint::SEGMENT) ? 1 : 0;
+      }
+      else
+      {
+        count = (cellType == mint::TRIANGLE) ? 1 : 0;
+        count = (cellType == mint::QUAD) ? 2 : count;
+      }
+      offsets_v[icell] = count;
+    });
+
+#ifdef AXOM_USE_RAJA
+  using loop_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  using reduce_policy = typename axom::execution_space<ExecSpace>::reduce_policy;
+
+  RAJA::ReduceSum<reduce_policy, IndexType> total(0);
+  for_all<ExecSpace>(
+    ncells,
+    AXOM_LAMBDA(IndexType icell) { total += offsets_v[icell]; });
+  RAJA::exclusive_scan_inplace<loop_policy>(
+    RAJA::make_span(offsets.data(), ncells),
+    RAJA::operators::plus<IndexType> {});
+  const IndexType nelems = total.get();
+#else
+  IndexType nelems = 0;
+  for(IndexType icell = 0; icell < ncells; ++icell)
+  {
+    const IndexType count = offsets[icell];
+    offsets[icell] = nelems;
+    nelems += count;
+  }
+#endif
+
+  SLIC_WARNING_IF(nelems == 0,
+                  "FastWindingNumber: surface mesh has no "
+                    << (NDIMS == 2 ? "segments" : "triangles or quads"));
+
+  // copy the surface elements and compute their bounding boxes
+  axom::Array<ElementType> elements(nelems, nelems, allocatorID);
+  axom::Array<BoxType> boxes(nelems, nelems, allocatorID);
+  const auto elements_v = elements.view();
+  const auto boxes_v = boxes.view();
+  for_all<ExecSpace>(
+    ncells,
+    AXOM_LAMBDA(IndexType icell) {
+      const IndexType first = offsets_v[icell];
+      const IndexType last = (icell + 1 < ncells) ? offsets_v[icell + 1] : nelems;
+
+      int nnodes = 0;
+      const IndexType* cellNodes = meshData.getCellNodeIDs(icell, nnodes);
+      for(IndexType k = 0; k < last - first; ++k)
+      {
+        // quadrilateral (0,1,2,3) is split into (0,1,2) and (0,2,3)
+        PointType pts[ElementTraits::NUM_VERTS];
+        BoxType box;
+        for(int i = 0; i < ElementTraits::NUM_VERTS; ++i)
+        {
+          pts[i] = meshPts[cellNodes[(i == 0) ? 0 : i + k]];
+          box.addPoint(pts[i]);
+        }
+        elements_v[first + k] = ElementTraits::make(pts);
+        boxes_v[first + k] = box;
+      }
+    });
+
+  if(nelems == 0)
+  {
+    m_elements = std::move(elements);
+    return;
+  }
+
+  // sort the elements along a Morton curve through their box centroids
+  const int32 size = static_cast<int32>(nelems);
+  const BoxType bounds =
+    lbvh::reduce<ExecSpace, double, NDIMS>(boxes.view(), size);
+
+  axom::Array<uint32> mcodes(size, size, allocatorID);
+  axom::Array<int32> order(size, size, allocatorID);
+  lbvh::get_mcodes<ExecSpace, double, NDIMS>(boxes.view(),
+                                             size,
+                                             bounds,
+                                             mcodes.view());
+  lbvh::sort_mcodes<ExecSpace>(mcodes, size, order);
+  lbvh::reorder<ExecSpace>(order.view(), elements, size, allocatorID);
+
+  m_elements = std::move(elements);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+void FastWindingNumber<NDIMS, ExecSpace>::initializeTree(int allocatorID)
+{
+  const IndexType nelems = m_elements.size();
+  const IndexType numFilledLeaves = (nelems + LEAF_SIZE - 1) / LEAF_SIZE;
+
+  m_numLeaves = 1;
+  while(m_numLeaves < numFilledLeaves)
+  {
+    m_numLeaves *= 2;
+  }
+  const IndexType numLeaves = m_numLeaves;
+
+  // nodes are in heap order, i.e., the root is node 1, the children of node
+  // i are nodes 2i and 2i+1, and leaf j is node numLeaves + j
+  m_nodes = axom::Array<NodeData>(2 * numLeaves, 2 * numLeaves, allocatorID);
+  const auto nodes_v = m_nodes.view();
+  const ElementType* elements = m_elements.data();
+
+  for_all<ExecSpace>(
+    numLeaves,
+    AXOM_LAMBDA(IndexType leaf) {
+      NodeData node;
+      node.area = 0.;
+      node.radius = -1.;
+
+      const IndexType first = leaf * LEAF_SIZE;
+      const IndexType last = utilities::min(first + LEAF_SIZE, nelems);
+      if(first < last)
+      {
+        VectorType weightedSum;
+        VectorType sum;
+        for(IndexType e = first; e < last; ++e)
+        {
+          const VectorType centroid(ElementTraits::centroid(elements[e]));
+          const VectorType normal = ElementTraits::weightedNormal(elements[e]);
+          const double area = normal.norm();
+          node.dipole += normal;
+          node.area += area;
+          weightedSum += area * centroid;
+          sum += centroid;
+        }
+        VectorType center = (node.area > 0.) ? weightedSum : sum;
+        center /= (node.area > 0.) ? node.area
+                                   : static_cast<double>(last - first);
+        node.center = PointType(center.array());
+
+        node.radius = 0.;
+        for(IndexType e = first; e < last; ++e)
+        {
+          for(int i = 0; i < ElementTraits::NUM_VERTS; ++i)
+          {
+            const VectorType r(node.center, ElementTraits::vertex(elements[e], i));
+            node.radius = utilities::max(node.radius, r.norm());
+          }
+        }
+      }
+      nodes_v[numLeaves + leaf] = node;
+    });
+
+  // combine the children of each level, bottom-up
+  for(IndexType levelSize = numLeaves / 2; levelSize > 0; levelSize /= 2)
+  {
+    for_all<ExecSpace>(
+      levelSize,
+      2 * levelSize,
+      AXOM_LAMBDA(IndexType i) {
+        const NodeData& left = nodes_v[2 * i];
+        const NodeData& right = nodes_v[2 * i + 1];
+        if(left.radius < 0. || right.radius < 0.)
+        {
+          nodes_v[i] = (left.radius < 0.) ? right : left;
+          return;
+        }
+
+        NodeData node;
+        node.area = left.area + right.area;
+        node.dipole = left.dipole + right.dipole;
+
+        const double t = (node.area > 0.) ? right.area / node.area : 0.5;
+        node.center = left.center + t * VectorType(left.center, right.center);
+        node.radius = utilities::max(
+          VectorType(node.center, left.center).norm() + left.radius,
+          VectorType(node.center, right.center).norm() + right.radius);
+
+        nodes_v[i] = node;
+      });
+  }
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+inline double FastWindingNumber<NDIMS, ExecSpace>::computeWindingNumber(
+  const PointType& pt) const
+{
+  double wn;
+  this->computeWindingNumbers(1, &pt, &wn);
+  return wn;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+template <typename PointIndexable>
+inline void FastWindingNumber<NDIMS, ExecSpace>::computeWindingNumbers(
+  IndexType npts,
+  PointIndexable queryPts,
+  double* outWindingNumbers) const
+{
+  SLIC_ASSERT(outWindingNumbers != nullptr);
+
+  const NodeData* nodes = m_nodes.data();
+  const ElementType* elements = m_elements.data();
+  const IndexType nelems = m_elements.size();
+  const IndexType numLeaves = m_numLeaves;
+  const double beta = m_beta;
+
+  AXOM_PERF_MARK_SECTION(
+    "ComputeWindingNumbers",
+    for_all<ExecSpace>(
+      npts,
+      AXOM_LAMBDA(IndexType idx) {
+        outWindingNumbers[idx] =
+          evaluate(queryPts[idx], nodes, elements, nelems, numLeaves, beta);
+      }););
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+template <typename PointIndexable>
+inline void FastWindingNumber<NDIMS, ExecSpace>::computeContainment(
+  IndexType npts,
+  PointIndexable queryPts,
+  bool* outContained) const
+{
+  SLIC_ASSERT(outContained != nullptr);
+
+  const NodeData* nodes = m_nodes.data();
+  const ElementType* elements = m_elements.data();
+  const IndexType nelems = m_elements.size();
+  const IndexType numLeaves = m_numLeaves;
+  const double beta = m_beta;
+
+  AXOM_PERF_MARK_SECTION(
+    "ComputeContainment",
+    for_all<ExecSpace>(
+      npts,
+      AXOM_LAMBDA(IndexType idx) {
+        outContained[idx] =
+          evaluate(queryPts[idx], nodes, elements, nelems, numLeaves, beta) >=
+          0.5;
+      }););
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+AXOM_HOST_DEVICE inline double FastWindingNumber<NDIMS, ExecSpace>::evaluate(
+  const PointType& qpt,
+  const NodeData* nodes,
+  const ElementType* elements,
+  IndexType numElements,
+  IndexType numLeaves,
+  double beta)
+{
+  // the stack holds at most one pending sibling per level
+  constexpr int MAX_STACK_SIZE = 64;
+  IndexType stack[MAX_STACK_SIZE];
+  int stackSize = 0;
+  stack[stackSize++] = 1;
+
+  double wn = 0.;
+  while(stackSize > 0)
+  {
+    const IndexType current = stack[--stackSize];
+    const NodeData& node = nodes[current];
+    if(node.radius < 0.)
+    {
+      continue;
+    }
+
+    // far field: approximate the node by its dipole
+    const VectorType r(qpt, node.center);
+    const double dist = r.norm();
+    if(dist > beta * node.radius)
+    {
+      wn += ElementTraits::dipole(node.dipole, r);
+    }
+    // near field: sum the leaf's elements exactly
+    else if(current >= numLeaves)
+    {
+      const IndexType first = (current - numLeaves) * LEAF_SIZE;
+      const IndexType last = utilities::min(first + LEAF_SIZE, numElements);
+      for(IndexType e = first; e < last; ++e)
+      {
+        wn += primal::winding_number(qpt, elements[e]);
+      }
+    }
+    else
+    {
+      stack[stackSize++] = 2 * current + 1;
+      stack[stackSize++] = 2 * current;
+    }
+  }
+
+  return wn;
+}
+
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // AXOM_QUEST_FAST_WINDING_NUMBER_HPP_
@@ -21,11 +21,14 @@
 
 #include "detail/inout/BlockData.hpp"
 #include "detail/inout/MeshWrapper.hpp"
+#include "detail/inout/GrayLeafQuery.hpp"
 #include "detail/inout/InOutOctreeValidator.hpp"
 #include "detail/inout/InOutOctreeStats.hpp"
 
 #include "axom/fmt.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <iterator>
 #include <limits>
@@ -73,6 +76,9 @@ class InOutOctreeMeshDumper;
 template <int DIM, typename Derived>
 class InOutOctreeMeshDumperBase;
 
+template <int DIM>
+class PackedInOutOctree;
+
 }  // namespace detail
 
 /**
@@ -93,6 +99,7 @@ private:
   friend class detail::InOutOctreeValidator<DIM>;
   friend class detail::InOutOctreeMeshDumper<DIM>;
   friend class detail::InOutOctreeMeshDumperBase<DIM, detail::InOutOctreeMeshDumper<DIM>>;
+  friend class detail::PackedInOutOctree<DIM>;
 
 public:
   using OctreeBaseType = spin::OctreeBase<DIM, InOutBlockData>;
@@ -164,6 +171,50 @@ public:
   using GrayLeafVertexRelationLevelMap = slam::Map<GrayLeafVertexRelation>;
   using GrayLeafElementRelationLevelMap = slam::Map<GrayLeafElementRelation>;
 
+  /// Counters for the containment queries of an InOutOctree
+  struct QueryStatistics
+  {
+    std::uint64_t numQueries {0};          /** Number of within() queries */
+    std::uint64_t numOutsideBoundingBox {0}; /** Queries outside the octree */
+    std::uint64_t numGrayLeafQueries {0};  /** Queries in gray leaf blocks */
+    std::uint64_t numGrayLeafCells {0};    /** Cells indexed by those leaves */
+  };
+
+  /// Block, color and cell reference counts for a level of an InOutOctree
+  struct LevelStatistics : public spin::OctreeLevelStatistics
+  {
+    int numBlackLeaves {0};
+    int numWhiteLeaves {0};
+    int numGrayLeaves {0};
+    int numCellReferences {0};  /** Cell references in the gray leaves */
+  };
+
+  /**
+   * \brief Summary statistics for an InOutOctree
+   *
+   * \sa statistics(), enableQueryStatistics()
+   */
+  struct Statistics
+  {
+    /// Statistics for each level of the octree (up to its deepest leaves)
+    std::vector<LevelStatistics> levels;
+
+    std::size_t octreeBytes {0};          /** Octree levels and block data */
+    std::size_t grayLeafRelationBytes {0}; /** Gray leaf to cell relations */
+    std::size_t vertexBlockMapBytes {0};  /** Mesh vertex to leaf block map */
+
+    /// Leaf block queries; only collected when query statistics are enabled
+    spin::OctreeQueryStatistics leafQueries;
+    /// Containment queries; only collected when query statistics are enabled
+    QueryStatistics containmentQueries;
+
+    /// The total number of bytes allocated by the octree's index
+    std::size_t totalBytes() const
+    {
+      return octreeBytes + grayLeafRelationBytes + vertexBlockMapBytes;
+    }
+  };
+
 public:
   /**
    * \brief Construct an InOutOctree to handle containment queries on a surface mesh
@@ -204,6 +255,27 @@ public:
    */
   bool within(const SpacePt& pt) const;
 
+  /**
+   * \brief Returns statistics about the blocks, colors and memory usage
+   * of the octree along with its query statistics
+   *
+   * \note Query statistics are only collected after a call to
+   * enableQueryStatistics()
+   * \sa spin::SpatialOctree::enableQueryStatistics()
+   */
+  Statistics statistics() const;
+
+  /// \brief Resets the leaf block and containment query statistics
+  void resetQueryStatistics()
+  {
+    SpatialOctreeType::resetQueryStatistics();
+
+    m_numQueries = 0;
+    m_numOutsideBoundingBoxQueries = 0;
+    m_numGrayLeafQueries = 0;
+    m_numGrayLeafCells = 0;
+  }
+
   /**
    * \brief Sets the threshold for welding vertices during octree construction
    *
@@ -288,6 +360,22 @@ private:
    */
   bool colorLeafAndNeighbors(const BlockIndex& blk, InOutBlockData& blkData);
 
+  /**
+   * \brief Finds a color for the leaf block \a leafBlk from its
+   * same-level face neighbors
+   *
+   * \param leafBlk The block to color
+   * \return The color implied by the first colored same-level leaf neighbor
+   * of \a leafBlk, or InOutBlockData::Undetermined if there is no such neighbor
+   * \note Does not modify the octree, so it can be called concurrently
+   */
+  InOutBlockData::LeafColor leafColorFromNeighbors(
+    const BlockIndex& leafBlk) const;
+
+  /// \brief Sets a Black or White \a color on a leaf; other colors are ignored
+  static void setLeafColor(InOutBlockData& leafData,
+                           InOutBlockData::LeafColor color);
+
   /**
    * \brief Predicate to determine if the vertex is indexed by the blk
    *
@@ -326,34 +414,18 @@ private:
   }
 
   /**
-   * \brief Determines whether the specified 3D point is within the gray leaf
+   * \brief Determines whether the specified point is within the gray leaf
    *
    * \param queryPt The point we are querying
    * \param leafBlk The block of the gray leaf
    * \param data The data associated with the leaf block
    * \return True, if the point is inside the local surface associated with this
    * block, false otherwise
+   * \sa detail::withinGrayLeaf()
    */
-  template <int TDIM>
-  typename std::enable_if<TDIM == 3, bool>::type withinGrayBlock(
-    const SpacePt& queryPt,
-    const BlockIndex& leafBlk,
-    const InOutBlockData& data) const;
-
-  /**
-   * \brief Determines whether the specified 2D point is within the gray leaf
-   *
-   * \param queryPt The point we are querying
-   * \param leafBlk The block of the gray leaf
-   * \param data The data associated with the leaf block
-   * \return True, if the point is inside the local surface associated with this
-   * block, false otherwise
-   */
-  template <int TDIM = DIM>
-  typename std::enable_if<TDIM == 2, bool>::type withinGrayBlock(
-    const SpacePt& queryPt,
-    const BlockIndex& leafBlk,
-    const InOutBlockData& data) const;
+  bool withinGrayBlock(const SpacePt& queryPt,
+                       const BlockIndex& leafBlk,
+                       const InOutBlockData& data) const;
 
   /**
    * \brief Returns the index of the mesh vertex associated with the given leaf block
@@ -418,6 +490,12 @@ protected:
 
   /// Bounding box scaling factor for dealing with grazing triangles
   double m_boundingBoxScaleFactor {DEFAULT_BOUNDING_BOX_SCALE_FACTOR};
+
+  /// Containment query counters; \sa statistics()
+  mutable std::atomic<std::uint64_t> m_numQueries {0};
+  mutable std::atomic<std::uint64_t> m_numOutsideBoundingBoxQueries {0};
+  mutable std::atomic<std::uint64_t> m_numGrayLeafQueries {0};
+  mutable std::atomic<std::uint64_t> m_numGrayLeafCells {0};
 };
 
 template <int DIM>
@@ -511,6 +589,16 @@ void InOutOctree<DIM>::generateIndex()
   m_generationState = INOUTOCTREE_LEAVES_COLORED;
   SLIC_INFO("\t--Coloring octree leaves took " << timer.elapsed() << " seconds.");
 
+  // STEP 4 -- Use dense storage for the octree levels that are nearly full
+  timer.start();
+  const int numDenseLevels = this->updateLevelStorage();
+  timer.stop();
+  SLIC_INFO_IF(numDenseLevels > 0,
+               fmt::format("\t--Converting {} octree levels to dense storage "
+                           "took {} seconds.",
+                           numDenseLevels,
+                           timer.elapsed()));
+
 // -- Print some stats about the octree
 #ifdef DUMP_OCTREE_INFO
   SLIC_INFO("** Octree stats after inserting cells");
@@ -594,6 +682,23 @@ void InOutOctree<DIM>::insertMeshCells()
   currentLevelData.reserve(NUM_INIT_DATA_ENTRIES);
   nextLevelData.reserve(NUM_INIT_DATA_ENTRIES);
 
+  // Scratch data for the blocks of a level. The blocks are processed
+  // in parallel (when OpenMP is available), with each block writing to its
+  // own entries. The results are merged in block order, so the generated
+  // octree does not depend on the number of threads.
+  enum BlockAction : char
+  {
+    FINALIZE_LEAF,
+    REFINE_LEAF,
+    DISTRIBUTE_INTERNAL
+  };
+  constexpr int NUM_CHILDREN = BlockIndex::NUM_CHILDREN;
+  std::vector<GridPt> levelBlocks;
+  std::vector<int> levelDataIndices;
+  std::vector<BlockAction> blockActions;
+  std::vector<int> blockOffsets;
+  DynamicLevelData childLevelData;
+
   /// --- Initialize root level data
   BlockIndex rootBlock = this->root();
   InOutBlockData& rootData = (*this)[rootBlock];
@@ -625,23 +730,55 @@ void InOutOctree<DIM>::insertMeshCells()
     auto& geSizeRelData = m_indexRegistry.addNamelessBuffer();
     geSizeRelData.push_back(0);
 
-    int nextLevelDataBlockCounter = 0;
-
+    // Gather the blocks of this level that index some cells
     auto& levelLeafMap = this->getOctreeLevel(lev);
-    auto itEnd = levelLeafMap.end();
-    for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
+    levelBlocks.clear();
+    levelDataIndices.clear();
     {
-      InOutBlockData& blkData = *it;
-
-      if(!blkData.hasData()) continue;
+      auto itEnd = levelLeafMap.end();
+      for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
+      {
+        if(!it->hasData()) continue;
 
-      BlockIndex blk(it.pt(), lev);
+        levelBlocks.push_back(it.pt());
+        levelDataIndices.push_back(it->dataIndex());
+      }
+    }
+    const int numLevelBlocks = static_cast<int>(levelBlocks.size());
+    blockActions.resize(numLevelBlocks);
+    blockOffsets.resize(numLevelBlocks);
+
+    /// Determine which leaf blocks must be refined.
+    /// Note: allCellsIncidentInCommonVertex() only modifies the block's
+    /// own DynamicGrayBlockData, so this can be done in parallel
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for(int b = 0; b < numLevelBlocks; ++b)
+    {
+      const BlockIndex blk(levelBlocks[b], lev);
       DynamicGrayBlockData& dynamicLeafData =
-        currentLevelData[blkData.dataIndex()];
+        currentLevelData[levelDataIndices[b]];
+
+      if(!dynamicLeafData.isLeaf())
+        blockActions[b] = DISTRIBUTE_INTERNAL;
+      else if(!allCellsIncidentInCommonVertex(blk, dynamicLeafData))
+        blockActions[b] = REFINE_LEAF;
+      else
+        blockActions[b] = FINALIZE_LEAF;
+    }
 
-      bool isInternal = !dynamicLeafData.isLeaf();
-      bool isLeafThatMustRefine =
-        !isInternal && !allCellsIncidentInCommonVertex(blk, dynamicLeafData);
+    /// Update the octree structure; this modifies the octree, so it is serial.
+    /// Leaf blocks that don't refine are 'finalized' and reserve space for
+    /// their cells in the current level's relations. Other blocks reserve
+    /// space in childLevelData for the cells of their children.
+    int numDistributedBlocks = 0;
+    for(int b = 0; b < numLevelBlocks; ++b)
+    {
+      const BlockIndex blk(levelBlocks[b], lev);
+      InOutBlockData& blkData = (*this)[blk];
+      DynamicGrayBlockData& dynamicLeafData =
+        currentLevelData[levelDataIndices[b]];
 
       QUEST_OCTREE_DEBUG_LOG_IF(
         DEBUG_BLOCK_1 == blk || DEBUG_BLOCK_2 == blk,
@@ -652,12 +789,12 @@ void InOutOctree<DIM>::insertMeshCells()
                     blk,
                     dynamicLeafData,
                     blkData,
-                    (!isInternal && !isLeafThatMustRefine ? " yes" : "no")));
+                    (blockActions[b] == FINALIZE_LEAF ? " yes" : "no")));
 
-      // Leaf blocks that don't refine are 'finalized'
-      // -- add  them to the current level's relations
-      if(!isInternal && !isLeafThatMustRefine)
+      switch(blockActions[b])
       {
+      case FINALIZE_LEAF:
+        blockOffsets[b] = geSizeRelData.back();
         if(dynamicLeafData.hasCells())
         {
           // Set the leaf data in the octree
@@ -666,152 +803,167 @@ void InOutOctree<DIM>::insertMeshCells()
           // Add the vertex index to the gray blocks vertex relation
           gvRelData.push_back(dynamicLeafData.vertexIndex());
 
-          // Add the cells to the gray block's element relations
-          std::copy(dynamicLeafData.cells().begin(),
-                    dynamicLeafData.cells().end(),
-                    std::back_inserter(geIndRelData));
-          geSizeRelData.push_back(static_cast<int>(geIndRelData.size()));
-
-          QUEST_OCTREE_DEBUG_LOG_IF(
-            DEBUG_BLOCK_1 == blk || DEBUG_BLOCK_2 == blk,
-            fmt::format("[Added block {} into tree as a gray leaf]."
-                        "\n\tDynamic data: {}"
-                        "\n\tBlock data: {}",
-                        blk,
-                        dynamicLeafData,
-                        blkData));
+          // Reserve space for the cells in the gray block's element relation
+          geSizeRelData.push_back(blockOffsets[b] + dynamicLeafData.numCells());
         }
-      }
-      else
+        break;
+      case REFINE_LEAF:
       {
-        /// Otherwise, we must distribute the block data among the children
+        const VertexIndex vIdx = dynamicLeafData.vertexIndex();
 
-        // Refine the leaf if necessary
-        if(isLeafThatMustRefine)
-        {
-          const VertexIndex vIdx = dynamicLeafData.vertexIndex();
+        this->refineLeaf(blk);
+        dynamicLeafData.setLeafFlag(false);
 
-          this->refineLeaf(blk);
-          dynamicLeafData.setLeafFlag(false);
+        // Reinsert the vertex into the tree, if vIdx was indexed by blk
+        if(blockIndexesVertex(vIdx, blk)) insertVertex(vIdx, blk.childLevel());
 
-          // Reinsert the vertex into the tree, if vIdx was indexed by blk
-          if(blockIndexesVertex(vIdx, blk))
-            insertVertex(vIdx, blk.childLevel());
-        }
-        else if(isInternal)
-        {
-          // Need to mark the leaf as internal since we were using its data
-          // as an index into the DynamicGrayBlockData array
-          blkData.setInternal();
-        }
+        blockOffsets[b] = NUM_CHILDREN * numDistributedBlocks++;
+      }
+      break;
+      case DISTRIBUTE_INTERNAL:
+        // Need to mark the leaf as internal since we were using its data
+        // as an index into the DynamicGrayBlockData array
+        blkData.setInternal();
 
-        SLIC_ASSERT_MSG(
-          this->isInternal(blk),
-          fmt::format(
-            "Block {} was refined, so it should be marked as internal.",
-            blk));
+        blockOffsets[b] = NUM_CHILDREN * numDistributedBlocks++;
+        break;
+      }
 
-        /// Setup caches for data associated with children
-        BlockIndex childBlk[BlockIndex::NUM_CHILDREN];
-        GeometricBoundingBox childBB[BlockIndex::NUM_CHILDREN];
-        DynamicGrayBlockData childData[BlockIndex::NUM_CHILDREN];
-        DynamicGrayBlockData* childDataPtr[BlockIndex::NUM_CHILDREN];
+      SLIC_ASSERT_MSG(
+        blockActions[b] == FINALIZE_LEAF || this->isInternal(blk),
+        fmt::format("Block {} was refined, so it should be marked as internal.",
+                    blk));
+    }
 
-        const typename LeavesLevelMap::BroodData& broodData =
-          this->getOctreeLevel(lev + 1).getBroodData(blk.pt());
+    geIndRelData.resize(geSizeRelData.back());
+    childLevelData.clear();
+    childLevelData.resize(NUM_CHILDREN * numDistributedBlocks);
 
-        for(int j = 0; j < BlockIndex::NUM_CHILDREN; ++j)
-        {
-          childBlk[j] = blk.child(j);
-          childBB[j] = this->blockBoundingBox(childBlk[j]);
+    /// Copy the cells of the finalized gray leaves into the element relation
+    /// and distribute the cells of the other blocks among their children.
+    /// The octree is not modified here, so this can be done in parallel
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 4)
+#endif
+    for(int b = 0; b < numLevelBlocks; ++b)
+    {
+      const BlockIndex blk(levelBlocks[b], lev);
+      DynamicGrayBlockData::CellList& parentCells =
+        currentLevelData[levelDataIndices[b]].cells();
 
-          // expand bounding box slightly to deal with grazing cells
-          childBB[j].scale(m_boundingBoxScaleFactor);
+      if(blockActions[b] == FINALIZE_LEAF)
+      {
+        std::copy(parentCells.begin(),
+                  parentCells.end(),
+                  geIndRelData.begin() + blockOffsets[b]);
 
-          const InOutBlockData& childBlockData = broodData[j];
-          if(!childBlockData.hasData())
-          {
-            childData[j] = DynamicGrayBlockData();
-            childData[j].setLeafFlag(childBlockData.isLeaf());
-          }
-          else
-          {
-            childData[j] = DynamicGrayBlockData(childBlockData.dataIndex(),
-                                                childBlockData.isLeaf());
-          }
+        QUEST_OCTREE_DEBUG_LOG_IF(
+          !parentCells.empty() &&
+            (DEBUG_BLOCK_1 == blk || DEBUG_BLOCK_2 == blk),
+          fmt::format("[Added block {} into tree as a gray leaf]."
+                      "\n\tDynamic data: {}"
+                      "\n\tBlock data: {}",
+                      blk,
+                      currentLevelData[levelDataIndices[b]],
+                      (*this)[blk]));
+        continue;
+      }
 
-          childDataPtr[j] = &childData[j];
-        }
+      /// Setup caches for data associated with children
+      BlockIndex childBlk[NUM_CHILDREN];
+      GeometricBoundingBox childBB[NUM_CHILDREN];
+      DynamicGrayBlockData* childData = &childLevelData[blockOffsets[b]];
+
+      const typename LeavesLevelMap::BroodData& broodData =
+        this->getOctreeLevel(lev + 1).getBroodData(blk.pt());
+
+      for(int j = 0; j < NUM_CHILDREN; ++j)
+      {
+        childBlk[j] = blk.child(j);
+        childBB[j] = this->blockBoundingBox(childBlk[j]);
 
-        // Check that the vector has enough capacity for all children
-        // This ensures that our child data pointers will not be invalidated
-        if(nextLevelData.capacity() <
-           (nextLevelData.size() + BlockIndex::NUM_CHILDREN))
-          nextLevelData.reserve(nextLevelData.size() * 4);
+        // expand bounding box slightly to deal with grazing cells
+        childBB[j].scale(m_boundingBoxScaleFactor);
 
-        // Add all cells to intersecting children blocks
-        DynamicGrayBlockData::CellList& parentCells = dynamicLeafData.cells();
-        int numCells = static_cast<int>(parentCells.size());
-        for(int i = 0; i < numCells; ++i)
+        const InOutBlockData& childBlockData = broodData[j];
+        if(childBlockData.hasData())
+          childData[j].setVertex(childBlockData.dataIndex());
+        childData[j].setLeafFlag(childBlockData.isLeaf());
+      }
+
+      // Add all cells to intersecting children blocks
+      int numCells = static_cast<int>(parentCells.size());
+      for(int i = 0; i < numCells; ++i)
+      {
+        CellIndex tIdx = parentCells[i];
+        SpaceCell spaceTri = m_meshWrapper.cellPositions(tIdx);
+        GeometricBoundingBox tBB = m_meshWrapper.cellBoundingBox(tIdx);
+
+        for(int j = 0; j < NUM_CHILDREN; ++j)
         {
-          CellIndex tIdx = parentCells[i];
-          SpaceCell spaceTri = m_meshWrapper.cellPositions(tIdx);
-          GeometricBoundingBox tBB = m_meshWrapper.cellBoundingBox(tIdx);
+          bool shouldAddCell = blockIndexesElementVertex(tIdx, childBlk[j]) ||
+            (childData[j].isLeaf() ? intersect(spaceTri, childBB[j])
+                                   : intersect(tBB, childBB[j]));
 
-          for(int j = 0; j < BlockIndex::numChildren(); ++j)
+          QUEST_OCTREE_DEBUG_LOG_IF(
+            DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
+            //&& tIdx == DEBUG_TRI_IDX
+            fmt::format("Attempting to insert cell {} @ {} w/ BB {}"
+                        "\n\t into block {} w/ BB {} and data {} "
+                        "\n\tShould add? {}",
+                        tIdx,
+                        spaceTri,
+                        tBB,
+                        childBlk[j],
+                        childBB[j],
+                        childData[j],
+                        (shouldAddCell ? " yes" : "no")));
+
+          if(shouldAddCell)
           {
-            bool shouldAddCell = blockIndexesElementVertex(tIdx, childBlk[j]) ||
-              (childDataPtr[j]->isLeaf() ? intersect(spaceTri, childBB[j])
-                                         : intersect(tBB, childBB[j]));
-
-            QUEST_OCTREE_DEBUG_LOG_IF(
-              DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
-              //&& tIdx == DEBUG_TRI_IDX
-              fmt::format("Attempting to insert cell {} @ {} w/ BB {}"
-                          "\n\t into block {} w/ BB {} and data {} "
-                          "\n\tShould add? {}",
-                          tIdx,
-                          spaceTri,
-                          tBB,
-                          childBlk[j],
-                          childBB[j],
-                          *childDataPtr[j],
-                          (shouldAddCell ? " yes" : "no")));
-
-            if(shouldAddCell)
-            {
-              // Place the DynamicGrayBlockData in the array before adding its data
-              if(!childDataPtr[j]->hasCells())
-              {
-                // Copy the DynamicGrayBlockData into the array
-                nextLevelData.push_back(childData[j]);
-
-                // Update the child data pointer
-                childDataPtr[j] = &nextLevelData[nextLevelDataBlockCounter];
-
-                // Set the data in the octree to this index and update the index
-                (*this)[childBlk[j]].setData(nextLevelDataBlockCounter++);
-              }
-
-              childDataPtr[j]->addCell(tIdx);
-
-              QUEST_OCTREE_DEBUG_LOG_IF(
-                DEBUG_BLOCK_1 == childBlk[j] || DEBUG_BLOCK_2 == childBlk[j],
-                //&& tIdx == DEBUG_TRI_IDX
-                fmt::format(
-                  "Added cell {} @ {} with verts [{}]"
-                  "\n\tinto block {} with data {}.",
-                  tIdx,
-                  spaceTri,
-                  fmt::join(m_meshWrapper.cellVertexIndices(tIdx), ", "),
-                  childBlk[j],
-                  *(childDataPtr[j])));
-            }
+            childData[j].addCell(tIdx);
           }
         }
       }
     }
 
+    /// Merge the children with cells into the next level's data (serially)
+    {
+      int numChildrenWithCells = 0;
+      for(const auto& childData : childLevelData)
+      {
+        if(childData.hasCells()) ++numChildrenWithCells;
+      }
+      nextLevelData.reserve(nextLevelData.size() + numChildrenWithCells);
+    }
+    for(int b = 0; b < numLevelBlocks; ++b)
+    {
+      if(blockActions[b] == FINALIZE_LEAF) continue;
+
+      const BlockIndex blk(levelBlocks[b], lev);
+      for(int j = 0; j < NUM_CHILDREN; ++j)
+      {
+        DynamicGrayBlockData& childData = childLevelData[blockOffsets[b] + j];
+        if(!childData.hasCells()) continue;
+
+        // Set the data in the octree to the child's index in nextLevelData
+        const BlockIndex childBlk = blk.child(j);
+        (*this)[childBlk].setData(static_cast<int>(nextLevelData.size()));
+
+        // Move the child's data into nextLevelData without copying its cells
+        nextLevelData.push_back(
+          DynamicGrayBlockData(childData.vertexIndex(), childData.isLeaf()));
+        nextLevelData.back().cells().swap(childData.cells());
+
+        QUEST_OCTREE_DEBUG_LOG_IF(
+          DEBUG_BLOCK_1 == childBlk || DEBUG_BLOCK_2 == childBlk,
+          fmt::format("Added cells [{}] into block {} with data {}.",
+                      fmt::join(nextLevelData.back().cells(), ", "),
+                      childBlk,
+                      nextLevelData.back()));
+      }
+    }
+
     if(!levelLeafMap.empty())
     {
       // Create the relations from gray leaves to mesh vertices and elements
@@ -853,11 +1005,15 @@ void InOutOctree<DIM>::colorOctreeLeaves()
 
   using Timer = axom::utilities::Timer;
   using GridPtVec = std::vector<GridPt>;
+  using LeafColor = InOutBlockData::LeafColor;
+  GridPtVec levelLeaves;
   GridPtVec uncoloredBlocks;
+  std::vector<LeafColor> neighborColors;
 
   // Bottom-up traversal of octree
   for(int lev = this->maxLeafLevel() - 1; lev >= 0; --lev)
   {
+    levelLeaves.clear();
     uncoloredBlocks.clear();
     Timer levelTimer(true);
 
@@ -867,10 +1023,36 @@ void InOutOctree<DIM>::colorOctreeLeaves()
     {
       if(!it->isLeaf()) continue;
 
-      BlockIndex leafBlk(it.pt(), lev);
-      InOutBlockData& blockData = *it;
-      if(!colorLeafAndNeighbors(leafBlk, blockData))
-        uncoloredBlocks.push_back(leafBlk.pt());
+      levelLeaves.push_back(it.pt());
+      if(!it->isColored()) uncoloredBlocks.push_back(it.pt());
+    }
+
+    // Find colors for the uncolored leaves from their same-level neighbors.
+    // The colors are only applied after all have been found, so the octree
+    // is not modified while this is done in parallel
+    const int numUncolored = static_cast<int>(uncoloredBlocks.size());
+    neighborColors.resize(numUncolored);
+#ifdef AXOM_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for(int i = 0; i < numUncolored; ++i)
+    {
+      neighborColors[i] =
+        leafColorFromNeighbors(BlockIndex(uncoloredBlocks[i], lev));
+    }
+    for(int i = 0; i < numUncolored; ++i)
+    {
+      setLeafColor((*this)[BlockIndex(uncoloredBlocks[i], lev)],
+                   neighborColors[i]);
+    }
+
+    // Propagate the colors to coarser neighbors and color the remaining leaves
+    uncoloredBlocks.clear();
+    for(const auto& pt : levelLeaves)
+    {
+      BlockIndex leafBlk(pt, lev);
+      if(!colorLeafAndNeighbors(leafBlk, (*this)[leafBlk]))
+        uncoloredBlocks.push_back(pt);
     }
 
     // Iterate through the uncolored blocks until all have a color
@@ -924,62 +1106,8 @@ bool InOutOctree<DIM>::colorLeafAndNeighbors(const BlockIndex& leafBlk,
   if(!isColored)
   {
     // Leaf does not yet have a color... try to find its color from same-level face neighbors
-    for(int i = 0; !isColored && i < leafBlk.numFaceNeighbors(); ++i)
-    {
-      BlockIndex neighborBlk = leafBlk.faceNeighbor(i);
-      if(this->isLeaf(neighborBlk))
-      {
-        const InOutBlockData& neighborData = (*this)[neighborBlk];
-
-        QUEST_OCTREE_DEBUG_LOG_IF(
-          DEBUG_BLOCK_1 == neighborBlk || DEBUG_BLOCK_2 == neighborBlk ||
-            DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-          fmt::format("Spreading color to block {} with data {}, "
-                      "bounding box {} w/ midpoint {}"
-                      "\n\t\t from block {} with data {}, "
-                      "bounding box {} w/ midpoint {}.",
-                      leafBlk,
-                      leafData,
-                      this->blockBoundingBox(leafBlk),
-                      this->blockBoundingBox(leafBlk).getCentroid(),
-                      neighborBlk,
-                      neighborData,
-                      this->blockBoundingBox(neighborBlk),
-                      this->blockBoundingBox(neighborBlk).getCentroid()));
-
-        switch(neighborData.color())
-        {
-        case InOutBlockData::Black:
-          leafData.setBlack();
-          break;
-        case InOutBlockData::White:
-          leafData.setWhite();
-          break;
-        case InOutBlockData::Gray:
-        {
-          SpacePt faceCenter =
-            SpacePt::midpoint(this->blockBoundingBox(leafBlk).getCentroid(),
-                              this->blockBoundingBox(neighborBlk).getCentroid());
-          if(withinGrayBlock<DIM>(faceCenter, neighborBlk, neighborData))
-            leafData.setBlack();
-          else
-            leafData.setWhite();
-        }
-        break;
-        case InOutBlockData::Undetermined:
-          break;
-        }
-
-        isColored = leafData.isColored();
-
-        QUEST_OCTREE_DEBUG_LOG_IF(
-          isColored &&
-            (DEBUG_BLOCK_1 == neighborBlk || DEBUG_BLOCK_2 == neighborBlk),
-          fmt::format("Leaf block was colored -- {} now has data {}",
-                      leafBlk,
-                      leafData));
-      }
-    }
+    setLeafColor(leafData, leafColorFromNeighbors(leafBlk));
+    isColored = leafData.isColored();
   }
 
   // If the block has a color, try to color its face neighbors at the same or coarser resolution
@@ -1024,7 +1152,7 @@ bool InOutOctree<DIM>::colorLeafAndNeighbors(const BlockIndex& leafBlk,
               this->blockBoundingBox(leafBlk).getCentroid(),
               this->blockBoundingBox(leafBlk.faceNeighbor(i)).getCentroid());
 
-            if(withinGrayBlock<DIM>(faceCenter, leafBlk, leafData))
+            if(withinGrayBlock(faceCenter, leafBlk, leafData))
               neighborData.setBlack();
             else
               neighborData.setWhite();
@@ -1048,6 +1176,74 @@ bool InOutOctree<DIM>::colorLeafAndNeighbors(const BlockIndex& leafBlk,
   return isColored;
 }
 
+template <int DIM>
+InOutBlockData::LeafColor
+InOutOctree<DIM>::leafColorFromNeighbors(const BlockIndex& leafBlk) const
+{
+  for(int i = 0; i < leafBlk.numFaceNeighbors(); ++i)
+  {
+    BlockIndex neighborBlk = leafBlk.faceNeighbor(i);
+    if(!this->isLeaf(neighborBlk)) continue;
+
+    const InOutBlockData& neighborData = (*this)[neighborBlk];
+
+    QUEST_OCTREE_DEBUG_LOG_IF(
+      DEBUG_BLOCK_1 == neighborBlk || DEBUG_BLOCK_2 == neighborBlk ||
+        DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
+      fmt::format("Spreading color to block {} with data {}, "
+                  "bounding box {} w/ midpoint {}"
+                  "\n\t\t from block {} with data {}, "
+                  "bounding box {} w/ midpoint {}.",
+                  leafBlk,
+                  (*this)[leafBlk],
+                  this->blockBoundingBox(leafBlk),
+                  this->blockBoundingBox(leafBlk).getCentroid(),
+                  neighborBlk,
+                  neighborData,
+                  this->blockBoundingBox(neighborBlk),
+                  this->blockBoundingBox(neighborBlk).getCentroid()));
+
+    switch(neighborData.color())
+    {
+    case InOutBlockData::Black:
+      return InOutBlockData::Black;
+    case InOutBlockData::White:
+      return InOutBlockData::White;
+    case InOutBlockData::Gray:
+    {
+      SpacePt faceCenter =
+        SpacePt::midpoint(this->blockBoundingBox(leafBlk).getCentroid(),
+                          this->blockBoundingBox(neighborBlk).getCentroid());
+      return withinGrayBlock(faceCenter, neighborBlk, neighborData)
+        ? InOutBlockData::Black
+        : InOutBlockData::White;
+    }
+    case InOutBlockData::Undetermined:
+      break;
+    }
+  }
+
+  return InOutBlockData::Undetermined;
+}
+
+template <int DIM>
+void InOutOctree<DIM>::setLeafColor(InOutBlockData& leafData,
+                                    InOutBlockData::LeafColor color)
+{
+  switch(color)
+  {
+  case InOutBlockData::Black:
+    leafData.setBlack();
+    break;
+  case InOutBlockData::White:
+    leafData.setWhite();
+    break;
+  case InOutBlockData::Gray:  // gray leaves are colored when cells are inserted
+  case InOutBlockData::Undetermined:
+    break;
+  }
+}
+
 template <int DIM>
 typename InOutOctree<DIM>::VertexIndex InOutOctree<DIM>::leafVertex(
   const BlockIndex& leafBlk,
@@ -1077,256 +1273,25 @@ typename InOutOctree<DIM>::CellIndexSet InOutOctree<DIM>::leafCells(
 }
 
 template <int DIM>
-template <int TDIM>
-typename std::enable_if<TDIM == 3, bool>::type InOutOctree<DIM>::withinGrayBlock(
-  const SpacePt& queryPt,
-  const BlockIndex& leafBlk,
-  const InOutBlockData& leafData) const
+bool InOutOctree<DIM>::withinGrayBlock(const SpacePt& queryPt,
+                                       const BlockIndex& leafBlk,
+                                       const InOutBlockData& leafData) const
 {
-  /// Finds a ray from queryPt to a point of a triangle within leafBlk.
-  /// Then find the first triangle along this ray. The orientation of the ray
-  /// against this triangle's normal indicates queryPt's containment.
-  /// It is inside when the dot product is positive.
-
   SLIC_ASSERT(leafData.color() == InOutBlockData::Gray);
   SLIC_ASSERT(leafData.hasData());
 
-  GeometricBoundingBox blockBB = this->blockBoundingBox(leafBlk);
-
-  SpacePt triPt;
-
-  CellIndexSet triSet = leafCells(leafBlk, leafData);
-  const int numTris = triSet.size();
-  for(int i = 0; i < numTris; ++i)
-  {
-    /// Get the triangle
-    CellIndex idx = triSet[i];
-    SpaceCell tri = m_meshWrapper.cellPositions(idx);
-
-    /// Find a point from this triangle within the bounding box of the mesh
-    primal::Polygon<double, DIM> poly = primal::clip(tri, blockBB);
-    if(poly.numVertices() == 0)
-    {
-      // Account for cases where the triangle only grazes the bounding box.
-      // Here, intersect(tri,blockBB) is true, but the clipping algorithm
-      // produces an empty polygon.  To resolve this, clip against a
-      // slightly expanded bounding box
-      GeometricBoundingBox expandedBB = blockBB;
-      expandedBB.scale(10 * m_boundingBoxScaleFactor);
-
-      poly = primal::clip(tri, expandedBB);
-
-      // If that still doesn't work, move on to the next triangle
-      if(poly.numVertices() == 0)
-      {
-        continue;
-      }
-    }
-
-    triPt = poly.vertexMean();
-
-    /// Use a ray from the query point to the triangle point to find an
-    /// intersection. Note: We have to check all triangles to ensure that
-    /// there is not a closer triangle than tri along this direction.
-    CellIndex tIdx = MeshWrapper<DIM>::NO_CELL;
-    double minRayParam = std::numeric_limits<double>::infinity();
-    SpaceRay ray(queryPt, SpaceVector(queryPt, triPt));
-
-    QUEST_OCTREE_DEBUG_LOG_IF(
-      DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-      fmt::format("Checking if pt {} is within block {} with data {}, "
-                  "ray is {}, triangle point is {} on triangle with index {}.",
-                  queryPt,
-                  leafBlk,
-                  leafData,
-                  ray,
-                  triPt,
-                  idx));
-
-    double rayParam = 0;
-    if(primal::intersect(tri, ray, rayParam))
-    {
-      minRayParam = rayParam;
-      tIdx = idx;
-
-      QUEST_OCTREE_DEBUG_LOG_IF(
-        DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-        fmt::format("... intersection for triangle w/ index {} at ray "
-                    "parameter {} at point {}",
-                    tIdx,
-                    minRayParam,
-                    ray.at(minRayParam)));
-    }
-
-    for(int j = 0; j < numTris; ++j)
-    {
-      CellIndex localIdx = triSet[j];
-      if(localIdx == idx) continue;
-
-      if(primal::intersect(m_meshWrapper.cellPositions(localIdx), ray, rayParam))
-      {
-        if(rayParam < minRayParam)
-        {
-          minRayParam = rayParam;
-          tIdx = localIdx;
-
-          QUEST_OCTREE_DEBUG_LOG_IF(
-            DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-            fmt::format("... intersection for triangle w/ index {} at ray "
-                        "parameter {} at point {}",
-                        tIdx,
-                        minRayParam,
-                        ray.at(minRayParam)));
-        }
-      }
-    }
-
-    if(tIdx == MeshWrapper<DIM>::NO_CELL)
-    {
-      continue;
-    }
-
-    // Inside when the dot product of the normal with this triangle is positive
-    SpaceVector normal =
-      (tIdx == idx) ? tri.normal() : m_meshWrapper.cellPositions(tIdx).normal();
-
-    return normal.dot(ray.direction()) > 0.;
-  }
-
-  SLIC_DEBUG("Could not determine inside/outside for point "
-             << queryPt << " on block " << leafBlk);
-
-  return false;  // query points on boundary might get here -- revisit this.
-}
-
-template <int DIM>
-template <int TDIM>
-typename std::enable_if<TDIM == 2, bool>::type InOutOctree<DIM>::withinGrayBlock(
-  const SpacePt& queryPt,
-  const BlockIndex& leafBlk,
-  const InOutBlockData& leafData) const
-{
-  /// Finds a ray from queryPt to a point of a segment within leafBlk.
-  /// Then finds the first segment along this ray. The orientation of the ray
-  /// against this segment's normal indicates queryPt's containment.
-  /// It is inside when the dot product is positive.
-
-  SLIC_ASSERT(leafData.color() == InOutBlockData::Gray);
-  SLIC_ASSERT(leafData.hasData());
-
-  GeometricBoundingBox blockBB = this->blockBoundingBox(leafBlk);
-  GeometricBoundingBox expandedBB = blockBB;
-  expandedBB.scale(m_boundingBoxScaleFactor);
-
-  SpacePt segmentPt;
-
-  CellIndexSet segmentSet = leafCells(leafBlk, leafData);
-  const int numSegments = segmentSet.size();
-  for(int i = 0; i < numSegments; ++i)
-  {
-    /// Get the segment
-    CellIndex idx = segmentSet[i];
-    SpaceCell seg = m_meshWrapper.cellPositions(idx);
-
-    /// Find a point from this segment within the expanded bounding box of the mesh
-    // We'll use the midpoint of the segment after clipping it against the bounding box
-    double pMin, pMax;
-    const bool intersects = primal::intersect(seg, expandedBB, pMin, pMax);
-    if(!intersects)
-    {
-      continue;
-    }
-    segmentPt = seg.at(0.5 * (pMin + pMax));
-
-    // Using a ray from query pt to point on this segment
-    // Find closest intersection to surface within cell inside this bounding box
-    CellIndex tIdx = MeshWrapper<DIM>::NO_CELL;
-    double minRayParam = std::numeric_limits<double>::infinity();
-    double minSegParam = std::numeric_limits<double>::infinity();
-    SpaceRay ray(queryPt, SpaceVector(queryPt, segmentPt));
-
-    QUEST_OCTREE_DEBUG_LOG_IF(
-      DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-      fmt::format("Checking if pt {} is within block {} with data {}, "
-                  "ray is {}, segment point is {} on segment with index {}.",
-                  queryPt,
-                  leafBlk,
-                  leafData,
-                  ray,
-                  segmentPt,
-                  idx));
-
-    double rayParam = 0;
-    double segParam = 0;
-    if(primal::intersect(ray, seg, rayParam, segParam))
-    {
-      minRayParam = rayParam;
-      minSegParam = segParam;
-      tIdx = idx;
-
-      QUEST_OCTREE_DEBUG_LOG_IF(
-        DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-        fmt::format("... intersection for segment w/ index {} "
-                    "at ray parameter {} and segment parameter {} "
-                    "is at point {}",
-                    tIdx,
-                    minRayParam,
-                    minSegParam,
-                    ray.at(minRayParam)));
-    }
-
-    for(int j = 0; j < numSegments; ++j)
-    {
-      CellIndex localIdx = segmentSet[j];
-      if(localIdx == idx) continue;
-
-      if(primal::intersect(ray,
-                           m_meshWrapper.cellPositions(localIdx),
-                           rayParam,
-                           segParam))
-      {
-        if(rayParam < minRayParam)
-        {
-          minRayParam = rayParam;
-          minSegParam = segParam;
-          tIdx = localIdx;
-
-          QUEST_OCTREE_DEBUG_LOG_IF(
-            DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-            fmt::format("... intersection for segment w/ index {} "
-                        "at ray parameter {} and segment parameter {} "
-                        "is at point {}",
-                        tIdx,
-                        minRayParam,
-                        minSegParam,
-                        ray.at(minRayParam)));
-        }
-      }
-    }
-    if(tIdx == MeshWrapper<DIM>::NO_CELL)
-    {
-      continue;
-    }
-
-    // Get the surface normal at the intersection point
-    // If the latter is a vertex, the normal is the average of its two incident segments
-    SpaceVector normal =
-      m_meshWrapper.surfaceNormal(tIdx, minSegParam, segmentSet);
-
-    QUEST_OCTREE_DEBUG_LOG_IF(DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
-                              fmt::format("... normal {}, ray {}, dot {}",
-                                          normal,
-                                          ray,
-                                          normal.dot(ray.direction())));
-
-    // Query point is inside when the dot product of the normal with ray is positive
-    return normal.dot(ray.direction()) > 0.;
-  }
-
-  SLIC_DEBUG("Could not determine inside/outside for point "
-             << queryPt << " on block " << leafBlk);
-
-  return false;  // query points on boundary might get here -- revisit this.
+  QUEST_OCTREE_DEBUG_LOG_IF(
+    DEBUG_BLOCK_1 == leafBlk || DEBUG_BLOCK_2 == leafBlk,
+    fmt::format("Checking if pt {} is within block {} with data {}",
+                queryPt,
+                leafBlk,
+                leafData));
+
+  return detail::withinGrayLeaf(queryPt,
+                                this->blockBoundingBox(leafBlk),
+                                leafCells(leafBlk, leafData),
+                                m_meshWrapper,
+                                m_boundingBoxScaleFactor);
 }
 
 template <int DIM>
@@ -1441,6 +1406,9 @@ bool InOutOctree<DIM>::allCellsIncidentInCommonVertex(
 template <int DIM>
 bool InOutOctree<DIM>::within(const SpacePt& pt) const
 {
+  const bool collectStats = this->queryStatisticsEnabled();
+  if(collectStats) m_numQueries.fetch_add(1, std::memory_order_relaxed);
+
   if(this->boundingBox().contains(pt))
   {
     const BlockIndex block = this->findLeafBlock(pt);
@@ -1453,7 +1421,13 @@ bool InOutOctree<DIM>::within(const SpacePt& pt) const
     case InOutBlockData::White:
       return false;
     case InOutBlockData::Gray:
-      return withinGrayBlock<DIM>(pt, block, data);
+      if(collectStats)
+      {
+        m_numGrayLeafQueries.fetch_add(1, std::memory_order_relaxed);
+        m_numGrayLeafCells.fetch_add(leafCells(block, data).size(),
+                                     std::memory_order_relaxed);
+      }
+      return withinGrayBlock(pt, block, data);
     case InOutBlockData::Undetermined:
       SLIC_ASSERT_MSG(
         false,
@@ -1464,10 +1438,30 @@ bool InOutOctree<DIM>::within(const SpacePt& pt) const
       break;
     }
   }
+  else if(collectStats)
+  {
+    m_numOutsideBoundingBoxQueries.fetch_add(1, std::memory_order_relaxed);
+  }
 
   return false;
 }
 
+template <int DIM>
+typename InOutOctree<DIM>::Statistics InOutOctree<DIM>::statistics() const
+{
+  detail::InOutOctreeStats<DIM> octreeStats(*this);
+  Statistics stats = octreeStats.statistics();
+
+  stats.leafQueries = this->queryStatistics();
+  stats.containmentQueries.numQueries = m_numQueries.load();
+  stats.containmentQueries.numOutsideBoundingBox =
+    m_numOutsideBoundingBoxQueries.load();
+  stats.containmentQueries.numGrayLeafQueries = m_numGrayLeafQueries.load();
+  stats.containmentQueries.numGrayLeafCells = m_numGrayLeafCells.load();
+
+  return stats;
+}
+
 template <int DIM>
 void InOutOctree<DIM>::printOctreeStats() const
 {
@@ -1572,7 +1566,8 @@ void InOutOctree<DIM>::dumpDifferentColoredNeighborsMeshVTK(
 }  // end namespace quest
 }  // end namespace axom
 
-// Note: The following needs to be included after InOutOctree is defined
+// Note: The following need to be included after InOutOctree is defined
 #include "detail/inout/InOutOctreeMeshDumper.hpp"
+#include "detail/inout/PackedInOutOctree.hpp"
 
 #endif  // AXOM_QUEST_INOUT_OCTREE__HPP_
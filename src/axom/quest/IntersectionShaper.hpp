@@ -30,6 +30,7 @@
 #include "axom/quest/interface/internal/mpicomm_wrapper.hpp"
 #include "axom/quest/interface/internal/QuestHelpers.hpp"
 #include "axom/quest/detail/shaping/shaping_helpers.hpp"
+#include "axom/quest/detail/shaping/hex_oct_classification.hpp"
 
 #include "mfem.hpp"
 
@@ -79,6 +80,7 @@ public:
   using OctahedronType = primal::Octahedron<double, 3>;
   using Point2D = primal::Point<double, 2>;
   using Point3D = primal::Point<double, 3>;
+  using Vector3D = primal::Vector<double, 3>;
   using TetrahedronType = primal::Tetrahedron<double, 3>;
 
   /// Choose runtime policy for RAJA
@@ -656,6 +658,67 @@ public:
     int* newTotalCandidates = axom::allocate<int>(1);
     axom::copy(newTotalCandidates, ZERO, sizeof(int));
 
+    SLIC_INFO(axom::fmt::format(
+      "{:-^80}",
+      " Classifying each hexahedral element as inside, outside or boundary "));
+
+    // Only the tet-oct pairs of boundary hexahedra need to be clipped.
+    // A hexahedron is inside if it lies within one of its candidate
+    // octahedra, which do not overlap, and outside if it is separated from
+    // all of them.
+    const auto offsets_v = offsets.view();
+    const auto candidates_v = candidates.view();
+
+    axom::Array<int> hexClasses(NE);
+    axom::Array<int> candidateClasses(candidates.size());
+    const auto hexClasses_v = hexClasses.view();
+    const auto candidateClasses_v = candidateClasses.view();
+
+    RAJA::ReduceSum<REDUCE_POL, int> totalValidCandidates(0);
+    RAJA::ReduceSum<REDUCE_POL, int> numInsideHexes(0);
+    RAJA::ReduceSum<REDUCE_POL, int> numBoundaryHexes(0);
+
+    AXOM_PERF_MARK_SECTION(
+      "classify_hexes",
+      axom::for_all<ExecSpace>(
+        NE,
+        AXOM_LAMBDA(axom::IndexType i) {
+          int hexClass = shaping::HEX_OUTSIDE;
+          for(int j = 0; j < counts_v[i]; j++)
+          {
+            const int candIdx = offsets_v[i] + j;
+            const int octIdx = candidates_v[candIdx];
+            if(oct_has_duplicate_verts(local_octs[octIdx]))
+            {
+              candidateClasses_v[candIdx] = shaping::HEX_OUTSIDE;
+              continue;
+            }
+
+            totalValidCandidates += 1;
+            const int candClass =
+              shaping::classifyHexInOct(local_hexes[i], local_octs[octIdx]);
+            candidateClasses_v[candIdx] = candClass;
+            if(candClass == shaping::HEX_INSIDE ||
+               hexClass == shaping::HEX_INSIDE)
+            {
+              hexClass = shaping::HEX_INSIDE;
+            }
+            else if(candClass == shaping::HEX_BOUNDARY)
+            {
+              hexClass = shaping::HEX_BOUNDARY;
+            }
+          }
+          hexClasses_v[i] = hexClass;
+          numInsideHexes += (hexClass == shaping::HEX_INSIDE) ? 1 : 0;
+          numBoundaryHexes += (hexClass == shaping::HEX_BOUNDARY) ? 1 : 0;
+        }););
+
+    SLIC_INFO(axom::fmt::format(
+      "Classified hexahedral elements: {} inside, {} outside, {} boundary",
+      numInsideHexes.get(),
+      NE - numInsideHexes.get() - numBoundaryHexes.get(),
+      numBoundaryHexes.get()));
+
     SLIC_INFO(axom::fmt::format(
       "{:-^80}",
       " Decomposing each hexahedron element into 24 tetrahedrons "));
@@ -677,17 +740,19 @@ public:
       "{:-^80}",
       " Linearizing each tetrahedron, octahedron candidate pair "));
 
-    const auto offsets_v = offsets.view();
-    const auto candidates_v = candidates.view();
     AXOM_PERF_MARK_SECTION(
       "init_candidates",
       axom::for_all<ExecSpace>(
         NE,
         AXOM_LAMBDA(axom::IndexType i) {
+          if(hexClasses_v[i] != shaping::HEX_BOUNDARY)
+          {
+            return;
+          }
           for(int j = 0; j < counts_v[i]; j++)
           {
             int octIdx = candidates_v[offsets_v[i] + j];
-            if(!oct_has_duplicate_verts(local_octs[octIdx]))
+            if(candidateClasses_v[offsets_v[i] + j] == shaping::HEX_BOUNDARY)
             {
               for(int k = 0; k < NUM_TETS_PER_HEX; k++)
               {
@@ -731,6 +796,27 @@ public:
                                  tet_volume);
                              }););
 
+    // Inside hexahedra are fully overlapped by the shape. This assumes that
+    // the candidate octahedra do not overlap, as is the case for the
+    // octahedra that discretize a revolved shape: a hexahedron inside one of
+    // them then has no overlap with the others, whose clips are skipped.
+    // With overlapping octahedra, the clipped volumes would be summed over
+    // all of them and could exceed the hexahedron volume.
+    axom::for_all<ExecSpace>(
+      NE,
+      AXOM_LAMBDA(axom::IndexType i) {
+        if(hexClasses_v[i] == shaping::HEX_INSIDE)
+        {
+          local_overlap_volumes[i] = local_hex_volumes[i];
+        }
+      });
+
+    const int numTotalClips = totalValidCandidates.get() * NUM_TETS_PER_HEX;
+    SLIC_INFO(axom::fmt::format(
+      "Skipped {} of {} tet-octahedron clips after classification",
+      numTotalClips - newTotalCandidates[0],
+      numTotalClips));
+
     SLIC_INFO(axom::fmt::format(
       "{:-^80}",
       " Calculating element overlap volume from each tet-oct pair "));
@@ -55,90 +55,12 @@ void findTriMeshIntersections(detail::UMesh* surface_mesh,
                               int spatialIndexResolution,
                               double intersectionThreshold)
 {
-  detail::Triangle3 t1 {};
-  detail::Triangle3 t2 {};
-  SLIC_INFO("Running mesh_tester with UniformGrid index");
-
-  const int ncells = surface_mesh->getNumberOfCells();
-
-  // find the specified resolution.  If we're passed a number less than one,
-  // use the cube root of the number of triangles.
-  if(spatialIndexResolution < 1)
-  {
-    spatialIndexResolution = (int)(1 + std::pow(ncells, 1 / 3.));
-  }
-  primal::NumericArray<int, 3> resolutions(spatialIndexResolution);
-
-  SLIC_INFO("Building UniformGrid index...");
-  std::vector<int> nondegenerateIndices;
-  nondegenerateIndices.reserve(ncells);
-
-  axom::Array<int> triIdxs(ncells);
-  axom::Array<detail::SpatialBoundingBox> triBboxes(ncells);
-  for(int i = 0; i < ncells; i++)
-  {
-    t1 = detail::getMeshTriangle(i, surface_mesh);
-
-    if(t1.degenerate())
-    {
-      degenerateIndices.push_back(i);
-    }
-    else
-    {
-      nondegenerateIndices.push_back(i);
-
-      triIdxs[i] = i;
-      triBboxes[i] = compute_bounding_box(t1);
-    }
-  }
-  detail::UniformGrid3 ugrid(resolutions, triBboxes, triIdxs);
-
-  // Iterate through triangle indices *idx.
-  // Check against each other triangle with index greater than the index *idx
-  // that also shares a UniformGrid bin.
-  SLIC_INFO("Checking mesh with a total of " << ncells << " cells.");
-
-  std::vector<int>::iterator idx = nondegenerateIndices.begin(),
-                             ndgend = nondegenerateIndices.end();
-  for(; idx != ndgend; ++idx)
-  {
-    // Retrieve the triangle at *idx and construct a bounding box around it
-    t1 = detail::getMeshTriangle(*idx, surface_mesh);
-    detail::SpatialBoundingBox triBB2 = compute_bounding_box(t1);
-
-    // Get a list of all triangles in bins this triangle will touch,
-    // whose indices are greater than this triangle's index
-    std::vector<int> neighborTriangles;
-    const std::vector<int> binsToCheck = ugrid.getBinsForBbox(triBB2);
-    size_t checkcount = binsToCheck.size();
-    for(size_t curbin = 0; curbin < checkcount; ++curbin)
-    {
-      axom::ArrayView<int> ntlist = ugrid.getBinContents(binsToCheck[curbin]);
-      for(const int nbr : ntlist)
-      {
-        if(nbr > *idx)
-        {
-          neighborTriangles.push_back(nbr);
-        }
-      }
-    }
-
-    std::sort(neighborTriangles.begin(), neighborTriangles.end());
-    std::vector<int>::iterator nend =
-      std::unique(neighborTriangles.begin(), neighborTriangles.end());
-    std::vector<int>::iterator nit = neighborTriangles.begin();
-
-    // test any remaining neighbor tris for intersection
-    while(nit != nend)
-    {
-      t2 = detail::getMeshTriangle(*nit, surface_mesh);
-      if(primal::intersect(t1, t2, false, intersectionThreshold))
-      {
-        intersections.push_back(std::make_pair(*idx, *nit));
-      }
-      ++nit;
-    }
-  }
+  findTriMeshIntersectionsUniformGrid<axom::SEQ_EXEC, double>(
+    surface_mesh,
+    intersections,
+    degenerateIndices,
+    spatialIndexResolution,
+    intersectionThreshold);
 }
 
 /* Check a surface mesh for holes using its face relation. */
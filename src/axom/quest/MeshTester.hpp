@@ -166,6 +166,10 @@ void findTriMeshIntersectionsImplicitGrid(
  * spatialIndexResolution specifies the bin size for the UniformGrid.  The
  * default value of 0 causes this routine to calculate a heuristic bin size
  * based on the cube root of the number of cells in the mesh.
+ *
+ * The candidate pairs are generated, deduplicated and tested in parallel
+ * in \a ExecSpace.  The intersecting pairs are sorted by their first and
+ * then by their second index, regardless of the execution space.
  */
 template <typename ExecSpace, typename FloatType>
 void findTriMeshIntersectionsUniformGrid(
@@ -220,6 +224,8 @@ void findTriMeshIntersectionsUniformGrid(
  * spatialIndexResolution specifies the bin size for the UniformGrid.  The
  * default value of 0 causes this routine to calculate a heuristic bin size
  * based on the cube root of the number of cells in the mesh.
+ *
+ * \note This runs findTriMeshIntersectionsUniformGrid() in serial.
  */
 void findTriMeshIntersections(mint::UnstructuredMesh<mint::SINGLE_SHAPE>* surface_mesh,
                               std::vector<std::pair<int, int>>& intersections,
@@ -281,6 +287,120 @@ WatertightStatus isSurfaceMeshWatertight(
 void weldTriMeshVertices(mint::UnstructuredMesh<mint::SINGLE_SHAPE>** surface_mesh,
                          double eps);
 
+/*!
+ * \brief Summary of the changes made to a mesh by weldMeshVertices()
+ */
+struct WeldStatistics
+{
+  IndexType numInputNodes {0};     ///< Number of mesh nodes before welding
+  IndexType numOutputNodes {0};    ///< Number of mesh nodes after welding
+  IndexType numInputCells {0};     ///< Number of mesh cells before welding
+  IndexType numOutputCells {0};    ///< Number of mesh cells after welding
+  IndexType numWeldedGroups {0};   ///< Number of output nodes that merged
+                                   ///< two or more input nodes
+  IndexType numDegradedCells {0};  ///< Number of removed cells that still had
+                                   ///< three or more distinct nodes, e.g.,
+                                   ///< quads that collapsed to a triangle
+
+  /// Largest distance (max norm) between a merged node and its welded node
+  double maxDisplacement {0.};
+
+  /// Returns the number of nodes that were merged into other nodes
+  IndexType numMergedNodes() const { return numInputNodes - numOutputNodes; }
+
+  /// Returns the number of cells that were removed as degenerate, including
+  /// the degraded cells
+  IndexType numRemovedCells() const { return numInputCells - numOutputCells; }
+};
+
+/*!
+ * \brief Mesh repair function to weld the nodes of an unstructured mesh
+ *  that are closer than \a eps, using the execution space \a ExecSpace
+ *
+ * \param [in,out] mesh A single-shape unstructured mesh, e.g. a segment,
+ *  triangle or quadrilateral mesh, in one, two or three dimensions
+ * \param [in] eps Distance threshold for welding nodes (using the max norm)
+ * \return The numbers of nodes and cells before and after the welding
+ *
+ * \pre \a eps must be greater than zero
+ * \pre \a mesh is not null
+ * \post The cells of \a mesh are reindexed using the welded nodes, and cells
+ *  that do not have distinct nodes after the welding are removed.
+ *  Since the mesh has a single cell type, cells that only lost some of their
+ *  nodes, e.g., quads with two welded nodes, are removed rather than
+ *  converted to a lower order cell type; they are counted in
+ *  WeldStatistics::numDegradedCells.
+ *
+ * Two nodes are welded when they are within \a eps of each other, or when
+ * they are connected through a chain of such pairs of nodes.  Each group of
+ * welded nodes is replaced by the node with the lowest index in the group,
+ * which keeps its coordinates.  The welded nodes and the remaining cells
+ * keep their relative order.  Unlike weldTriMeshVertices(), the nodes are
+ * matched against the nodes in neighboring lattice cells, so the result does
+ * not depend on the position of the nodes relative to the lattice.
+ *
+ * The nodes are quantized, sorted and matched in parallel, and the mesh is
+ * compacted in place.
+ *
+ * \note This function is destructive.  It modifies the input mesh in place.
+ *  The node-centered and cell-centered fields are compacted along with the
+ *  nodes and cells, i.e. each welded node keeps the field values of the node
+ *  with the lowest index in its group.  Meshes with face-centered or
+ *  edge-centered fields are not supported.
+ * \note The mesh data must be accessible in \a ExecSpace.
+ */
+template <typename ExecSpace>
+WeldStatistics weldMeshVertices(
+  mint::UnstructuredMesh<mint::SINGLE_SHAPE>* mesh,
+  double eps)
+{
+  AXOM_PERF_MARK_FUNCTION("weldMeshVertices");
+
+  SLIC_ASSERT_MSG(eps > 0.,
+                  "Epsilon must be greater than 0. Passed in value was " << eps);
+  SLIC_ASSERT(mesh != nullptr);
+
+  WeldStatistics stats;
+  stats.numInputNodes = mesh->getNumberOfNodes();
+  stats.numInputCells = mesh->getNumberOfCells();
+
+  switch(mesh->getDimension())
+  {
+  case 1:
+  {
+    detail::VertexWelder<1, ExecSpace> welder(mesh, eps);
+    welder.weld();
+    stats.numWeldedGroups = welder.getNumWeldedGroups();
+    stats.maxDisplacement = welder.getMaxDisplacement();
+    stats.numDegradedCells = welder.getNumDegradedCells();
+  }
+  break;
+  case 2:
+  {
+    detail::VertexWelder<2, ExecSpace> welder(mesh, eps);
+    welder.weld();
+    stats.numWeldedGroups = welder.getNumWeldedGroups();
+    stats.maxDisplacement = welder.getMaxDisplacement();
+    stats.numDegradedCells = welder.getNumDegradedCells();
+  }
+  break;
+  default:
+  {
+    detail::VertexWelder<3, ExecSpace> welder(mesh, eps);
+    welder.weld();
+    stats.numWeldedGroups = welder.getNumWeldedGroups();
+    stats.maxDisplacement = welder.getMaxDisplacement();
+    stats.numDegradedCells = welder.getNumDegradedCells();
+  }
+  break;
+  }
+
+  stats.numOutputNodes = mesh->getNumberOfNodes();
+  stats.numOutputCells = mesh->getNumberOfCells();
+
+  return stats;
+}
+
 /// @}
 
 }  // namespace quest
@@ -16,9 +16,14 @@
 #include "axom/spin/BVH.hpp"
 #include "axom/primal/geometry/BoundingBox.hpp"
 #include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Ray.hpp"
 #include "axom/primal/geometry/Triangle.hpp"
 #include "axom/primal/geometry/Vector.hpp"
 #include "axom/primal/utils/ZipPoint.hpp"
+#include "axom/primal/operators/intersect.hpp"
+
+// quest includes
+#include "axom/quest/detail/FastSweeping.hpp"
 
 // mint includes
 #include "axom/mint/config.hpp"
@@ -26,6 +31,8 @@
 #include "axom/mint/mesh/FieldData.hpp"
 #include "axom/mint/mesh/FieldVariable.hpp"
 #include "axom/mint/mesh/UnstructuredMesh.hpp"
+#include "axom/mint/mesh/UniformMesh.hpp"
+#include "axom/mint/mesh/RectilinearMesh.hpp"
 #include "axom/mint/mesh/Mesh.hpp"
 
 // C/C++ includes
@@ -142,6 +149,94 @@ AXOM_HOST_DEVICE inline bool isClosestPointTypeShared(ClosestPointLocType cpt)
   return cpt == ClosestPointLocType::edge || cpt == ClosestPointLocType::vertex;
 }
 
+/*!
+ * \brief Determines if a point is inside a closed surface mesh by counting
+ *  the crossings of a ray from the point with the surface.
+ *
+ * \param [in] qpt the query point
+ * \param [in] traverser the traverser of the BVH over the surface cells
+ * \param [in] mesh the surface mesh data
+ * \param [in] meshPts the surface mesh point coordinate data
+ * \param [in] tol the amount by which the BVH bins are expanded for the
+ *  ray-box tests, to account for roundoff on flat bins
+ *
+ * \return -1.0 if the point is inside, 1.0 if it is outside, and 0.0 when the
+ *  ray hits an edge or vertex of the surface, in which case the count of the
+ *  crossings is not reliable.
+ */
+template <typename TraverserType, typename ZipPoint>
+AXOM_HOST_DEVICE inline double ray_parity_sign(const primal::Point<double, 3>& qpt,
+                                               const TraverserType& traverser,
+                                               const UcdMeshData& mesh,
+                                               ZipPoint meshPts,
+                                               double tol)
+{
+  using VectorType = primal::Vector<double, 3>;
+  using RayType = primal::Ray<double, 3>;
+  using TriangleType = primal::Triangle<double, 3>;
+  using BoxType = primal::BoundingBox<double, 3>;
+
+  // a direction that is not aligned with the coordinate axes
+  const RayType ray(qpt, VectorType {0.2873, 0.5194, 0.8049});
+
+  int crossings = 0;
+  bool ambiguous = false;
+
+  auto countCrossings = [&](int32 current_node, const int32* leaf_nodes) {
+    int nnodes;
+    const IndexType* nodes =
+      mesh.getCellNodeIDs(leaf_nodes[current_node], nnodes);
+
+    // quads are split into two triangles along their diagonal
+    for(int i = 2; i < nnodes; ++i)
+    {
+      const TriangleType tri {meshPts[nodes[0]],
+                              meshPts[nodes[i - 1]],
+                              meshPts[nodes[i]]};
+      double t;
+      primal::Point<double, 3> bary;
+      if(primal::intersect(tri, ray, t, bary))
+      {
+        ++crossings;
+        ambiguous =
+          ambiguous || bary[0] == 0. || bary[1] == 0. || bary[2] == 0.;
+      }
+    }
+  };
+
+  auto traversePredicate = [&](const primal::Point<double, 3>&,
+                               const BoxType& bb) -> bool {
+    BoxType expanded = bb;
+    expanded.expand(tol);
+    primal::Point<double, 3> ip;
+    return !ambiguous && primal::intersect(ray, expanded, ip);
+  };
+
+  traverser.traverse_tree(qpt, countCrossings, traversePredicate);
+
+  if(ambiguous)
+  {
+    return 0.;
+  }
+  return (crossings % 2 == 1) ? -1. : 1.;
+}
+
+/*!
+ * \brief Overload of ray_parity_sign() for 2D, where the containment query is
+ *  not available.
+ *
+ * \return 0.0, i.e., the sign must be computed from the closest point.
+ */
+template <typename TraverserType, typename ZipPoint>
+AXOM_HOST_DEVICE inline double ray_parity_sign(const primal::Point<double, 2>&,
+                                               const TraverserType&,
+                                               const UcdMeshData&,
+                                               ZipPoint,
+                                               double)
+{
+  return 0.;
+}
+
 }  // end namespace detail
 
 template <int NDIMS, typename ExecSpace = axom::SEQ_EXEC>
@@ -220,6 +315,68 @@ public:
   bool setMesh(const mint::Mesh* surfaceMesh,
                int allocatorID = axom::execution_space<ExecSpace>::allocatorID());
 
+  /*!
+   * \brief Updates the SignedDistance instance after the nodes of its surface
+   *  mesh have moved, e.g., for a deforming surface.
+   *
+   * The bounding boxes in the BVH are refit to the new node positions, which
+   * is much cheaper than rebuilding the BVH in setMesh(). The BVH is rebuilt
+   * instead when refitting has degraded its quality, i.e., when its surface
+   * area cost exceeds \a maxCostRatio times its cost when last built.
+   *
+   * \param [in] maxCostRatio the ratio of the BVH's surface area cost to its
+   *  cost when built, above which the BVH is rebuilt (optional).
+   *
+   * \return status true if the update was successful.
+   *
+   * \pre The connectivity of the surface mesh is unchanged since the last
+   *  call to setMesh(); only its node coordinates may change.
+   *
+   * \sa spin::BVH::refit(), spin::BVH::getSurfaceAreaCostRatio()
+   */
+  bool updateMesh(double maxCostRatio = 1.5);
+
+  /*!
+   * \brief Limits the distance queries to a band around the surface.
+   *
+   * The search for the closest point only considers the surface cells within
+   * \a bandWidth of a query point and terminates once none are left. Points
+   * within the band get the same distances as without a band. Points outside
+   * the band get a distance of \a bandWidth, with the sign of the point.
+   * When the surface mesh is watertight, this sign comes from a containment
+   * query, which casts a ray from the point and counts its crossings with the
+   * surface. This is much cheaper than finding the closest point of a point
+   * far from the surface.
+   *
+   * \param [in] bandWidth the width of the band.
+   *
+   * \note The closest points and normals are not set for points outside the
+   *  band.
+   *
+   * \note For 2D and non-watertight meshes, as well as when the ray hits an
+   *  edge or vertex of the surface, the sign of points outside the band is
+   *  computed from their closest point.
+   *
+   * \pre bandWidth >= 0
+   */
+  void setBandWidth(double bandWidth)
+  {
+    SLIC_ASSERT(bandWidth >= 0.);
+    m_bandWidth = bandWidth;
+  }
+
+  /*!
+   * \brief Returns the width of the band around the surface for the distance
+   *  queries, the maximum double value when queries are not band-limited.
+   */
+  double getBandWidth() const { return m_bandWidth; }
+
+  /// Removes the band limit set by setBandWidth()
+  void clearBandWidth()
+  {
+    m_bandWidth = numerics::floating_point_limits<double>::max();
+  }
+
   /*!
    * \brief Computes the distance of the given point to the input surface mesh.
    *
@@ -331,6 +488,44 @@ public:
                         PointType* outClosestPts = nullptr,
                         VectorType* outNormals = nullptr) const;
 
+  /*!
+   * \brief Computes the signed distance field on the nodes of a uniform or
+   *  rectilinear grid.
+   *
+   * Instead of a full query per grid node, the distances are computed in
+   * three steps:
+   *  1. The nodes within \a bandWidth of the bounding box of a surface cell
+   *     form a narrow band around the surface.
+   *  2. The distances of the band nodes are computed exactly, as in
+   *     computeDistances().
+   *  3. The distances are propagated to the other nodes with a parallel fast
+   *     sweeping solver of the eikonal equation. Each node takes the sign of
+   *     its upwind neighbor, which flood-fills the signs of the band into the
+   *     regions on either side of the surface.
+   *
+   * Outside the band, the distances are first-order approximations, which are
+   * accurate to a few grid spacings.
+   *
+   * \param [in] grid the uniform or rectilinear grid
+   * \param [out] outSgnDist array of the signed distances at the grid nodes
+   * \param [in] bandWidth the width of the band of exact distances. It is
+   *  increased to the largest grid spacing if it is smaller, so that the band
+   *  separates the grid nodes on either side of the surface (optional).
+   * \param [in] numSweepRounds the number of rounds of 2^NDIMS sweeps of the
+   *  fast sweeping solver (optional). A single round is usually enough.
+   *
+   * \note outSgnDist must be allocated in a memory space compatible with the
+   *  execution space and hold grid->getNumberOfNodes() values.
+   *
+   * \pre grid != nullptr
+   * \pre grid is a mint::UniformMesh or mint::RectilinearMesh of dimension
+   *  NDIMS
+   */
+  void computeDistanceField(const mint::Mesh* grid,
+                            double* outSgnDist,
+                            double bandWidth = 0.,
+                            int numSweepRounds = 1) const;
+
   /*!
    * \brief Returns a const reference to the underlying bucket tree.
    * \return ptr pointer to the underlying bucket tree
@@ -338,6 +533,27 @@ public:
   const BVHTreeType& getBVHTree() const { return m_bvh; }
 
 private:
+  /*!
+   * \brief Implements computeDistances() for the given band width.
+   */
+  template <typename PointIndexable>
+  void computeDistancesImpl(int npts,
+                            PointIndexable queryPts,
+                            double* outSgnDist,
+                            PointType* outClosestPts,
+                            VectorType* outNormals,
+                            double bandWidth) const;
+
+  /*!
+   * \brief Computes the bounding box of the surface mesh and of each of its
+   *  cells.
+   *
+   * \param [in] allocatorID the allocator for the cell bounding boxes
+   * \return boxes the cell bounding boxes, which must be deallocated by the
+   *  caller.
+   */
+  BoxType* computeBoundingBoxes(int allocatorID);
+
   /*!
    * \brief Computes the bounding box of the given cell on the surface mesh.
    * \param [in] icell the index of the cell on the surface mesh.
@@ -393,6 +609,7 @@ private:
   bool m_computeSign;              /*!< indicates if queries compute sign    */
   const mint::Mesh* m_surfaceMesh; /*!< User-supplied surface mesh.          */
   BoxType m_boxDomain;             /*!< bounding box containing surface mesh */
+  double m_bandWidth;              /*!< width of band for distance queries   */
   BVHTreeType m_bvh;               /*!< Spatial acceleration data-structure. */
 
   DISABLE_COPY_AND_ASSIGNMENT(SignedDistance);
@@ -416,6 +633,7 @@ SignedDistance<NDIMS, ExecSpace>::SignedDistance(const mint::Mesh* surfaceMesh,
                                                  int allocatorID)
   : m_isInputWatertight(isWatertight)
   , m_computeSign(computeSign)
+  , m_bandWidth(numerics::floating_point_limits<double>::max())
 {
   // Sanity checks
   SLIC_ASSERT(surfaceMesh != nullptr);
@@ -435,6 +653,45 @@ bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
 
   m_surfaceMesh = surfaceMesh;
   const axom::IndexType ncells = m_surfaceMesh->getNumberOfCells();
+
+  BoxType* boxes = computeBoundingBoxes(allocatorID);
+
+  // Build bounding volume hierarchy
+  m_bvh.setAllocatorID(allocatorID);
+  int result = m_bvh.initialize(boxes, ncells);
+
+  axom::deallocate(boxes);
+  return (result == spin::BVH_BUILD_OK);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+bool SignedDistance<NDIMS, ExecSpace>::updateMesh(double maxCostRatio)
+{
+  AXOM_PERF_MARK_FUNCTION("SignedDistance::updateMesh");
+  SLIC_ASSERT(m_surfaceMesh != nullptr);
+
+  const axom::IndexType ncells = m_surfaceMesh->getNumberOfCells();
+
+  BoxType* boxes = computeBoundingBoxes(m_bvh.getAllocatorID());
+
+  int result = m_bvh.refit(boxes, ncells);
+  if(result != spin::BVH_BUILD_OK ||
+     m_bvh.getSurfaceAreaCostRatio() > maxCostRatio)
+  {
+    result = m_bvh.initialize(boxes, ncells);
+  }
+
+  axom::deallocate(boxes);
+  return (result == spin::BVH_BUILD_OK);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+typename SignedDistance<NDIMS, ExecSpace>::BoxType*
+SignedDistance<NDIMS, ExecSpace>::computeBoundingBoxes(int allocatorID)
+{
+  const axom::IndexType ncells = m_surfaceMesh->getNumberOfCells();
   const axom::IndexType nnodes = m_surfaceMesh->getNumberOfNodes();
 
   // Get device-usable mesh data
@@ -485,14 +742,14 @@ bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
   PointType boxMax {xmax.get(), ymax.get(), zmax.get()};
   m_boxDomain = BoxType {boxMin, boxMax};
 #else
+  m_boxDomain.clear();
   for(axom::IndexType inode = 0; inode < nnodes; ++inode)
   {
     m_boxDomain.addPoint(surfPts[inode]);
   }
 #endif
 
-  // Initialize BVH with the surface elements.
-
+  // Compute the bounding boxes of the surface elements.
   BoxType* boxes = axom::allocate<BoxType>(ncells, allocatorID);
   for_all<ExecSpace>(
     ncells,
@@ -500,12 +757,7 @@ bool SignedDistance<NDIMS, ExecSpace>::setMesh(const mint::Mesh* surfaceMesh,
       boxes[icell] = getCellBoundingBox(icell, surfaceData, surfPts);
     });
 
-  // Build bounding volume hierarchy
-  m_bvh.setAllocatorID(allocatorID);
-  int result = m_bvh.initialize(boxes, ncells);
-
-  axom::deallocate(boxes);
-  return (result == spin::BVH_BUILD_OK);
+  return boxes;
 }
 
 //------------------------------------------------------------------------------
@@ -539,6 +791,191 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
   double* outSgnDist,
   PointType* outClosestPts,
   VectorType* outNormals) const
+{
+  computeDistancesImpl(npts,
+                       queryPts,
+                       outSgnDist,
+                       outClosestPts,
+                       outNormals,
+                       m_bandWidth);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+inline void SignedDistance<NDIMS, ExecSpace>::computeDistanceField(
+  const mint::Mesh* grid,
+  double* outSgnDist,
+  double bandWidth,
+  int numSweepRounds) const
+{
+  AXOM_PERF_MARK_FUNCTION("SignedDistance::computeDistanceField");
+  SLIC_ASSERT(grid != nullptr);
+  SLIC_ASSERT(outSgnDist != nullptr);
+  SLIC_ASSERT(m_surfaceMesh != nullptr);
+  SLIC_ERROR_IF(grid->getDimension() != NDIMS,
+                "Grid dimension must match the surface mesh dimension");
+  SLIC_ERROR_IF(grid->getMeshType() != mint::STRUCTURED_UNIFORM_MESH &&
+                  grid->getMeshType() != mint::STRUCTURED_RECTILINEAR_MESH,
+                "Grid must be a uniform or rectilinear mesh");
+
+  constexpr double MAX_DIST = numerics::floating_point_limits<double>::max();
+  const int allocatorID = m_bvh.getAllocatorID();
+  const auto* sgrid = static_cast<const mint::StructuredMesh*>(grid);
+  const IndexType nnodes = sgrid->getNumberOfNodes();
+
+  // STEP 0: copy the node coordinates along each axis
+  axom::Array<double> coords[NDIMS];
+  detail::StructuredGridData gridData {{nullptr, nullptr, nullptr},
+                                       {1, 1, 1},
+                                       {1, sgrid->nodeJp(), 0}};
+  if(NDIMS == 3)
+  {
+    gridData.strides[2] = sgrid->nodeKp();
+  }
+
+  double maxSpacing = 0.;
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    const IndexType res = sgrid->getNodeResolution(d);
+    axom::Array<double> hostCoords(res, res);
+    if(grid->getMeshType() == mint::STRUCTURED_UNIFORM_MESH)
+    {
+      const auto* ugrid = static_cast<const mint::UniformMesh*>(grid);
+      for(IndexType i = 0; i < res; ++i)
+      {
+        hostCoords[i] = ugrid->getOrigin()[d] + i * ugrid->getSpacing()[d];
+      }
+    }
+    else
+    {
+      const double* gridCoords = sgrid->getCoordinateArray(d);
+      for(IndexType i = 0; i < res; ++i)
+      {
+        hostCoords[i] = gridCoords[i];
+      }
+    }
+
+    for(IndexType i = 1; i < res; ++i)
+    {
+      maxSpacing =
+        utilities::max(maxSpacing, hostCoords[i] - hostCoords[i - 1]);
+    }
+
+    coords[d] = axom::Array<double>(hostCoords, allocatorID);
+    gridData.coords[d] = coords[d].data();
+    gridData.res[d] = res;
+  }
+
+  // Get mesh data
+  const double* xs = m_surfaceMesh->getCoordinateArray(0);
+  const double* ys = m_surfaceMesh->getCoordinateArray(1);
+  const double* zs = nullptr;
+  if(NDIMS == 3)
+  {
+    zs = m_surfaceMesh->getCoordinateArray(2);
+  }
+
+  ZipPoint surf_pts {{xs, ys, zs}};
+
+  detail::UcdMeshData surfaceData;
+  bool result = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
+  AXOM_UNUSED_VAR(result);
+  SLIC_CHECK_MSG(result, "Input mesh is not an unstructured surface mesh");
+
+  // STEP 1: flag the nodes within the band around the surface cells' boxes
+  const double band = utilities::max(bandWidth, maxSpacing);
+  axom::Array<int8> frozen(nnodes, nnodes, allocatorID);
+  const auto frozen_v = frozen.view();
+  for_all<ExecSpace>(
+    nnodes,
+    AXOM_LAMBDA(IndexType inode) { frozen_v[inode] = 0; });
+
+  AXOM_PERF_MARK_SECTION(
+    "FlagBandNodes",
+    for_all<ExecSpace>(
+      m_surfaceMesh->getNumberOfCells(),
+      AXOM_LAMBDA(IndexType icell) {
+        BoxType box = getCellBoundingBox(icell, surfaceData, surf_pts);
+        box.expand(band);
+
+        IndexType first[3] = {0, 0, 0};
+        IndexType last[3] = {0, 0, 0};
+        for(int d = 0; d < NDIMS; ++d)
+        {
+          gridData.nodeRange(d,
+                             box.getMin()[d],
+                             box.getMax()[d],
+                             first[d],
+                             last[d]);
+        }
+
+        // all writes store the same value, so overlapping boxes do not race
+        IndexType ijk[3];
+        for(ijk[2] = first[2]; ijk[2] <= last[2]; ++ijk[2])
+        {
+          for(ijk[1] = first[1]; ijk[1] <= last[1]; ++ijk[1])
+          {
+            for(ijk[0] = first[0]; ijk[0] <= last[0]; ++ijk[0])
+            {
+              frozen_v[gridData.nodeIndex(ijk)] = 1;
+            }
+          }
+        }
+      }););
+
+  const auto bandNodes =
+    detail::flagged_indices<ExecSpace>(frozen.view(), allocatorID);
+  const IndexType nband = bandNodes.size();
+
+  // The surface is far from the grid, so no distances can be propagated
+  if(nband == 0)
+  {
+    computeDistancesImpl(
+      static_cast<int>(nnodes),
+      detail::StructuredGridPoints<NDIMS> {gridData, nullptr},
+      outSgnDist,
+      nullptr,
+      nullptr,
+      MAX_DIST);
+    return;
+  }
+
+  // STEP 2: compute the exact distances at the band nodes
+  axom::Array<double> bandDist(nband, nband, allocatorID);
+  computeDistancesImpl(
+    static_cast<int>(nband),
+    detail::StructuredGridPoints<NDIMS> {gridData, bandNodes.data()},
+    bandDist.data(),
+    nullptr,
+    nullptr,
+    MAX_DIST);
+
+  const auto bandNodes_v = bandNodes.view();
+  const auto bandDist_v = bandDist.view();
+  for_all<ExecSpace>(
+    nnodes,
+    AXOM_LAMBDA(IndexType inode) { outSgnDist[inode] = MAX_DIST; });
+  for_all<ExecSpace>(
+    nband,
+    AXOM_LAMBDA(IndexType i) { outSgnDist[bandNodes_v[i]] = bandDist_v[i]; });
+
+  // STEP 3: propagate the distances and signs to the remaining nodes
+  detail::fast_sweeping<NDIMS, ExecSpace>(gridData,
+                                          outSgnDist,
+                                          frozen.data(),
+                                          numSweepRounds);
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace>
+template <typename PointIndexable>
+inline void SignedDistance<NDIMS, ExecSpace>::computeDistancesImpl(
+  int npts,
+  PointIndexable queryPts,
+  double* outSgnDist,
+  PointType* outClosestPts,
+  VectorType* outNormals,
+  double bandWidth) const
 {
   SLIC_ASSERT(npts > 0);
   SLIC_ASSERT(m_surfaceMesh != nullptr);
@@ -562,6 +999,14 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
   const BoxType boxDomain = m_boxDomain;
   const bool computeSigns = m_computeSign;
 
+  // In band-limited mode, the search starts from the band's squared width
+  const bool isBandLimited =
+    bandWidth < numerics::floating_point_limits<double>::max();
+  const double initSqDist = isBandLimited
+    ? bandWidth * bandWidth
+    : numerics::floating_point_limits<double>::max();
+  const double rayTol = 1e-10 * m_boxDomain.range().norm();
+
   detail::UcdMeshData surfaceData;
   bool result = detail::SD_GetUcdMeshData(m_surfaceMesh, surfaceData);
   AXOM_UNUSED_VAR(result);
@@ -575,6 +1020,7 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
         PointType qpt = queryPts[idx];
 
         MinCandidate curr_min {};
+        curr_min.minSqDist = initSqDist;
 
         auto searchMinDist = [&](int32 current_node, const int32* leaf_nodes) {
           int candidate_idx = leaf_nodes[current_node];
@@ -595,8 +1041,32 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
         // Traverse the tree, searching for the point with minimum distance.
         it.traverse_tree(qpt, searchMinDist, traversePredicate);
 
+        // No candidate is closer than the initial distance iff the point is
+        // outside the band
+        const bool inBand = !isBandLimited ||
+          curr_min.minType != detail::ClosestPointLocType::uninitialized;
+
         double sgn = 1.0;
-        if(computeSigns)
+        if(computeSigns && !inBand)
+        {
+          // STEP 0: for a closed surface, use a containment query, unless the
+          // point is outside the bounding box of the surface mesh
+          if(watertightInput)
+          {
+            sgn = boxDomain.contains(qpt)
+              ? detail::ray_parity_sign(qpt, it, surfaceData, surf_pts, rayTol)
+              : 1.0;
+          }
+
+          // STEP 1: otherwise, fall back to the sign at the closest point
+          if(!watertightInput || sgn == 0.)
+          {
+            curr_min = MinCandidate {};
+            it.traverse_tree(qpt, searchMinDist, traversePredicate);
+            sgn = computeSign(qpt, curr_min);
+          }
+        }
+        else if(computeSigns)
         {
           // STEP 0: if point is outside the bounding box of the surface mesh, then
           // it is outside, just return 1.0
@@ -606,6 +1076,12 @@ inline void SignedDistance<NDIMS, ExecSpace>::computeDistances(
           }
         }
 
+        if(!inBand)
+        {
+          outSgnDist[idx] = bandWidth * sgn;
+          return;
+        }
+
         outSgnDist[idx] = sqrt(curr_min.minSqDist) * sgn;
         if(outClosestPts)
         {
@@ -0,0 +1,350 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_QUEST_FAST_SWEEPING_HPP_
+#define AXOM_QUEST_FAST_SWEEPING_HPP_
+
+// axom includes
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+#include "axom/core/Types.hpp"
+#include "axom/core/Array.hpp"
+#include "axom/core/execution/for_all.hpp"
+#include "axom/core/numerics/floating_point_limits.hpp"
+#include "axom/core/utilities/Utilities.hpp"
+#include "axom/core/utilities/AnnotationMacros.hpp"
+
+#include "axom/slic/interface/slic.hpp"
+
+#include "axom/primal/geometry/Point.hpp"
+
+#ifdef AXOM_USE_RAJA
+  #include "RAJA/RAJA.hpp"
+#endif
+
+// C/C++ includes
+#include <cmath>
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+/*!
+ * \brief Holds the node coordinates of a structured grid with axis-aligned
+ *  cells, i.e., a uniform or rectilinear mesh, in device-usable form.
+ *
+ * Node (i,j,k) has coordinates (coords[0][i], coords[1][j], coords[2][k])
+ * and index i * strides[0] + j * strides[1] + k * strides[2]. For 2D grids,
+ * res[2] is 1.
+ */
+struct StructuredGridData
+{
+  const double* coords[3];
+  IndexType res[3];
+  IndexType strides[3];
+
+  /// Returns the index of the node at the given logical coordinates
+  AXOM_HOST_DEVICE IndexType nodeIndex(const IndexType (&ijk)[3]) const
+  {
+    return ijk[0] * strides[0] + ijk[1] * strides[1] + ijk[2] * strides[2];
+  }
+
+  /*!
+   * \brief Returns the range of node indices along \a dim with coordinates
+   *  in [lo, hi], which is empty when first > last.
+   */
+  AXOM_HOST_DEVICE void nodeRange(int dim,
+                                  double lo,
+                                  double hi,
+                                  IndexType& first,
+                                  IndexType& last) const
+  {
+    first = lowerBound(dim, lo);
+    last = lowerBound(dim, hi);
+    if(last == res[dim] || coords[dim][last] > hi)
+    {
+      --last;
+    }
+  }
+
+private:
+  /// Returns the first node index along \a dim whose coordinate is >= x
+  AXOM_HOST_DEVICE IndexType lowerBound(int dim, double x) const
+  {
+    IndexType first = 0;
+    IndexType count = res[dim];
+    while(count > 0)
+    {
+      const IndexType step = count / 2;
+      if(coords[dim][first + step] < x)
+      {
+        first += step + 1;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+    return first;
+  }
+};
+
+/*!
+ * \brief Point indexable for the nodes of a structured grid, for use with
+ *  SignedDistance::computeDistances().
+ *
+ * The i-th point is the node with index nodes[i], or with index i when
+ * \a nodes is null.
+ */
+template <int NDIMS>
+struct StructuredGridPoints
+{
+  StructuredGridData grid;
+  const IndexType* nodes;
+
+  AXOM_HOST_DEVICE primal::Point<double, NDIMS> operator[](IndexType i) const
+  {
+    IndexType node = (nodes == nullptr) ? i : nodes[i];
+
+    primal::Point<double, NDIMS> pt;
+    for(int d = NDIMS - 1; d >= 0; --d)
+    {
+      const IndexType idx = node / grid.strides[d];
+      node -= idx * grid.strides[d];
+      pt[d] = grid.coords[d][idx];
+    }
+    return pt;
+  }
+};
+
+/*!
+ * \brief Updates the distance at a grid node from its neighbors with the
+ *  first-order Godunov upwind discretization of the eikonal equation
+ *  \f$ |\nabla \phi| = 1 \f$.
+ *
+ * The distance only decreases. The node takes the sign of its closest
+ * neighbor, so the signs of the initial values are flood-filled along with
+ * the distances.
+ *
+ * \param [in] grid the structured grid
+ * \param [in,out] phi the signed distances at the grid nodes
+ * \param [in] ijk the logical coordinates of the node to update
+ */
+template <int NDIMS>
+AXOM_HOST_DEVICE inline void fast_sweeping_update(const StructuredGridData& grid,
+                                                  double* phi,
+                                                  const IndexType (&ijk)[3])
+{
+  constexpr double MAX_DIST = numerics::floating_point_limits<double>::max();
+
+  const IndexType node = grid.nodeIndex(ijk);
+
+  // find the closest neighbor and its spacing along each axis
+  double a[NDIMS];
+  double h[NDIMS];
+  double sign = 1.;
+  double minDist = MAX_DIST;
+  for(int d = 0; d < NDIMS; ++d)
+  {
+    a[d] = MAX_DIST;
+    h[d] = 1.;
+    for(int side = -1; side <= 1; side += 2)
+    {
+      const IndexType idx = ijk[d] + side;
+      if(idx < 0 || idx >= grid.res[d])
+      {
+        continue;
+      }
+
+      const double value = phi[node + side * grid.strides[d]];
+      const double dist = utilities::abs(value);
+      if(dist < a[d])
+      {
+        a[d] = dist;
+        h[d] = utilities::abs(grid.coords[d][idx] - grid.coords[d][ijk[d]]);
+      }
+      if(dist < minDist)
+      {
+        minDist = dist;
+        sign = (value < 0.) ? -1. : 1.;
+      }
+    }
+  }
+
+  if(minDist == MAX_DIST)
+  {
+    return;
+  }
+
+  // sort the axes by increasing neighbor distance
+  for(int d = 1; d < NDIMS; ++d)
+  {
+    for(int m = d; m > 0 && a[m] < a[m - 1]; --m)
+    {
+      utilities::swap(a[m], a[m - 1]);
+      utilities::swap(h[m], h[m - 1]);
+    }
+  }
+
+  // solve sum_d ((u - a_d) / h_d)^2 = 1, adding axes while u exceeds a_d
+  double u = MAX_DIST;
+  double sumW = 0.;
+  double sumWA = 0.;
+  double sumWA2 = 0.;
+  for(int d = 0; d < NDIMS && u > a[d]; ++d)
+  {
+    const double w = 1. / (h[d] * h[d]);
+    sumW += w;
+    sumWA += w * a[d];
+    sumWA2 += w * a[d] * a[d];
+
+    const double disc = sumWA * sumWA - sumW * (sumWA2 - 1.);
+    if(disc < 0.)
+    {
+      break;
+    }
+    u = (sumWA + std::sqrt(disc)) / sumW;
+  }
+
+  if(u < utilities::abs(phi[node]))
+  {
+    phi[node] = sign * u;
+  }
+}
+
+/*!
+ * \brief Propagates the distances from the frozen nodes of a structured grid
+ *  to all other nodes with a parallel fast sweeping method.
+ *
+ * Each round sweeps the grid along all 2^NDIMS diagonal directions. Within a
+ * sweep, the nodes on a hyperplane i + j + k = const only depend on nodes on
+ * previous hyperplanes, so each hyperplane is updated in parallel.
+ *
+ * \param [in] grid the structured grid
+ * \param [in,out] phi the signed distances at the grid nodes. The nodes that
+ *  are not frozen must be initialized to the maximum double value.
+ * \param [in] frozen flags for the nodes whose distances are not updated
+ * \param [in] numRounds the number of rounds of sweeps
+ *
+ * \note A round of sweeps propagates the distances along all characteristic
+ *  directions of the eikonal equation, so one or two rounds usually suffice.
+ */
+template <int NDIMS, typename ExecSpace>
+void fast_sweeping(const StructuredGridData& grid,
+                   double* phi,
+                   const int8* frozen,
+                   int numRounds)
+{
+  AXOM_PERF_MARK_FUNCTION("fast_sweeping");
+
+  const IndexType res0 = grid.res[0];
+  const IndexType res1 = grid.res[1];
+  const IndexType res2 = grid.res[2];
+  const IndexType numLevels = res0 + res1 + res2 - 2;
+
+  for(int round = 0; round < numRounds; ++round)
+  {
+    for(int dirs = 0; dirs < (1 << NDIMS); ++dirs)
+    {
+      const bool flip0 = (dirs & 1) != 0;
+      const bool flip1 = (dirs & 2) != 0;
+      const bool flip2 = (dirs & 4) != 0;
+
+      for(IndexType level = 0; level < numLevels; ++level)
+      {
+        // range of the first logical coordinate on the hyperplane
+        const IndexType first =
+          utilities::max<IndexType>(0, level - (res1 - 1) - (res2 - 1));
+        const IndexType last = utilities::min<IndexType>(res0 - 1, level);
+
+        for_all<ExecSpace>(
+          first,
+          last + 1,
+          AXOM_LAMBDA(IndexType t0) {
+            const IndexType lo =
+              utilities::max<IndexType>(0, level - t0 - (res2 - 1));
+            const IndexType hi =
+              utilities::min<IndexType>(res1 - 1, level - t0);
+            for(IndexType t1 = lo; t1 <= hi; ++t1)
+            {
+              const IndexType t2 = level - t0 - t1;
+              const IndexType ijk[3] = {flip0 ? res0 - 1 - t0 : t0,
+                                        flip1 ? res1 - 1 - t1 : t1,
+                                        flip2 ? res2 - 1 - t2 : t2};
+              if(!frozen[grid.nodeIndex(ijk)])
+              {
+                fast_sweeping_update<NDIMS>(grid, phi, ijk);
+              }
+            }
+          });
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Returns the indices of the flagged entries of an array.
+ *
+ * \param [in] flags the array of flags
+ * \param [in] allocatorID the allocator for the returned array
+ */
+template <typename ExecSpace>
+axom::Array<IndexType> flagged_indices(axom::ArrayView<const int8> flags,
+                                       int allocatorID)
+{
+  const IndexType n = flags.size();
+
+#ifdef AXOM_USE_RAJA
+  using loop_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  using reduce_policy = typename axom::execution_space<ExecSpace>::reduce_policy;
+
+  axom::Array<IndexType> offsets(n, n, allocatorID);
+  const auto offsets_v = offsets.view();
+  RAJA::ReduceSum<reduce_policy, IndexType> total(0);
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType i) {
+      offsets_v[i] = flags[i] ? 1 : 0;
+      total += offsets_v[i];
+    });
+  RAJA::exclusive_scan_inplace<loop_policy>(
+    RAJA::make_span(offsets.data(), n),
+    RAJA::operators::plus<IndexType> {});
+
+  const IndexType count = total.get();
+  axom::Array<IndexType> indices(count, count, allocatorID);
+  const auto indices_v = indices.view();
+  for_all<ExecSpace>(
+    n,
+    AXOM_LAMBDA(IndexType i) {
+      if(flags[i])
+      {
+        indices_v[offsets_v[i]] = i;
+      }
+    });
+  return indices;
+#else
+  AXOM_UNUSED_VAR(allocatorID);
+
+  axom::Array<IndexType> indices;
+  for(IndexType i = 0; i < n; ++i)
+  {
+    if(flags[i])
+    {
+      indices.push_back(i);
+    }
+  }
+  return indices;
+#endif
+}
+
+}  // end namespace detail
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // AXOM_QUEST_FAST_SWEEPING_HPP_
@@ -19,6 +19,11 @@
   #include "axom/mint/execution/internal/structured_exec.hpp"
 #endif
 
+// C/C++ includes
+#include <algorithm>
+#include <limits>
+#include <utility>
+
 // Acceleration data structure includes
 #include "axom/spin/BVH.hpp"
 #include "axom/spin/ImplicitGrid.hpp"
@@ -65,6 +70,46 @@ inline detail::Triangle3 getMeshTriangle(axom::IndexType i,
 
   return tri;
 }
+
+/*!
+ * \brief Computes the exclusive prefix sum of \a counts in \a offsets
+ *  using the execution space \a ExecSpace
+ *
+ * \return The sum of all entries in \a counts
+ * \pre offsets.size() == counts.size()
+ */
+template <typename ExecSpace, MemorySpace SPACE>
+IndexType exclusiveScan(axom::ArrayView<IndexType, 1, SPACE> counts,
+                        axom::ArrayView<IndexType, 1, SPACE> offsets)
+{
+  SLIC_ASSERT(offsets.size() == counts.size());
+
+  const IndexType n = counts.size();
+  if(n == 0)
+  {
+    return 0;
+  }
+
+#ifdef AXOM_USE_RAJA
+  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), n),
+                                    RAJA::make_span(offsets.data(), n),
+                                    RAJA::operators::plus<IndexType> {});
+#else
+  IndexType sum = 0;
+  for(IndexType i = 0; i < n; ++i)
+  {
+    offsets[i] = sum;
+    sum += counts[i];
+  }
+#endif
+
+  IndexType lastOffset, lastCount;
+  axom::copy(&lastOffset, offsets.data() + n - 1, sizeof(IndexType));
+  axom::copy(&lastCount, counts.data() + n - 1, sizeof(IndexType));
+  return lastOffset + lastCount;
+}
+
 enum class AccelType
 {
   UniformGrid,
@@ -445,6 +490,10 @@ struct CandidateFinder<AccelType::ImplicitGrid, ExecSpace, FloatType>
 /*!
  * \brief Specialization of CandidateFinder using a Uniform Grid data
  *  structure to perform broad-phase collision detection.
+ *
+ * Unlike the other CandidateFinders, only the nondegenerate triangles are
+ * indexed and tested, and the candidate pairs are sorted and deduplicated,
+ * so the intersecting pairs are reported in order of their indices.
  */
 template <typename ExecSpace, typename FloatType>
 struct CandidateFinder<AccelType::UniformGrid, ExecSpace, FloatType>
@@ -457,6 +506,9 @@ struct CandidateFinder<AccelType::UniformGrid, ExecSpace, FloatType>
   using typename BaseClass::BoxType;
   using typename BaseClass::PointType;
 
+  using IndexArray = axom::Array<IndexType, 1, Space>;
+  using HostIndexArray = axom::Array<IndexType, 1, HostSpace>;
+
   void initialize(int spatialIndexResolution)
   {
     BaseClass::initialize();
@@ -471,36 +523,906 @@ struct CandidateFinder<AccelType::UniformGrid, ExecSpace, FloatType>
     m_resolutions = axom::primal::NumericArray<int, 3>(spatialIndexResolution);
   }
 
+  /*!
+   * \brief Returns the candidate pairs (i, j), with i < j, of nondegenerate
+   *  triangles that share a bin of the uniform grid.
+   *
+   * The pairs are generated in two phases: each triangle first counts, and
+   * then emits, the higher-indexed triangles in its bins.  Triangles that
+   * share several bins are emitted several times, so the pairs are then
+   * sorted and deduplicated in parallel.  The candidates of each triangle
+   * are in ascending order.
+   */
   virtual axom::ArrayView<IndexType, 1, Space> getCandidates(
     axom::Array<IndexType, 1, Space>& offsets,
     axom::Array<IndexType, 1, Space>& counts) override
   {
-    int allocatorId = axom::detail::getAllocatorID<Space>();
+    const int allocatorId = axom::detail::getAllocatorID<Space>();
+    const IndexType ncells = this->m_aabbs.size();
 
-    axom::Array<IndexType, 1, Space> indices(this->m_aabbs.size());
-    const auto indices_v = indices.view();
+#ifdef AXOM_USE_RAJA
+    using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+    using atomic_pol = typename axom::execution_space<ExecSpace>::atomic_policy;
+#endif
+
+    const auto v_aabbs = this->m_aabbs.view();
+    const auto v_degenerate = this->m_degenerate.view();
+
+    // Index the nondegenerate triangles
+    IndexArray isValid(ncells, ncells, allocatorId);
+    IndexArray validOffsets(ncells, ncells, allocatorId);
+    const auto v_isValid = isValid.view();
     for_all<ExecSpace>(
-      this->m_aabbs.size(),
-      AXOM_LAMBDA(IndexType idx) { indices_v[idx] = idx; });
+      ncells,
+      AXOM_LAMBDA(IndexType i) { v_isValid[i] = 1 - v_degenerate[i]; });
+    const IndexType nvalid =
+      exclusiveScan<ExecSpace>(isValid.view(), validOffsets.view());
 
-    using FlatStorage = spin::policy::FlatGridStorage<IndexType>;
+    axom::Array<BoxType, 1, Space> validBoxes(nvalid, nvalid, allocatorId);
+    IndexArray validIndices(nvalid, nvalid, allocatorId);
+    {
+      const auto v_validOffsets = validOffsets.view();
+      const auto v_validBoxes = validBoxes.view();
+      const auto v_validIndices = validIndices.view();
+      for_all<ExecSpace>(
+        ncells,
+        AXOM_LAMBDA(IndexType i) {
+          if(v_isValid[i] == 1)
+          {
+            v_validBoxes[v_validOffsets[i]] = v_aabbs[i];
+            v_validIndices[v_validOffsets[i]] = i;
+          }
+        });
+    }
 
+    using FlatStorage = spin::policy::FlatGridStorage<IndexType>;
     spin::UniformGrid<IndexType, 3, ExecSpace, FlatStorage> gridIndex(
       m_resolutions,
-      this->m_aabbs.view(),
-      indices.view(),
+      validBoxes.view(),
+      validIndices.view(),
       allocatorId);
+    const auto gridQuery = gridIndex.getQueryObject();
 
-    offsets.resize(this->m_aabbs.size());
-    counts.resize(this->m_aabbs.size());
+    offsets.resize(ncells);
+    counts.resize(ncells);
+    const auto v_offsets = offsets.view();
+    const auto v_counts = counts.view();
+
+    // Phase 1: count the candidates of each triangle, including duplicates
+    for_all<ExecSpace>(
+      ncells,
+      AXOM_LAMBDA(IndexType i) {
+        IndexType count = 0;
+        if(v_isValid[i] == 1)
+        {
+          gridQuery.visitCandidates(v_aabbs[i], [&](IndexType j) {
+            if(j > i)
+            {
+              ++count;
+            }
+          });
+        }
+        v_counts[i] = count;
+      });
+    const IndexType numPairs =
+      exclusiveScan<ExecSpace>(counts.view(), offsets.view());
+
+    // Phase 2: emit the candidate pairs, encoded as i * ncells + j
+    axom::Array<axom::int64, 1, Space> pairs(numPairs, numPairs, allocatorId);
+    const auto v_pairs = pairs.view();
+    for_all<ExecSpace>(
+      ncells,
+      AXOM_LAMBDA(IndexType i) {
+        if(v_isValid[i] == 1)
+        {
+          IndexType idx = v_offsets[i];
+          const axom::int64 pairOffset = static_cast<axom::int64>(i) * ncells;
+          gridQuery.visitCandidates(v_aabbs[i], [&](IndexType j) {
+            if(j > i)
+            {
+              v_pairs[idx++] = pairOffset + j;
+            }
+          });
+        }
+      });
+
+    // Sort the pairs to bring duplicates together
+#ifdef AXOM_USE_RAJA
+    RAJA::sort<exec_policy>(RAJA::make_span(pairs.data(), numPairs));
+#else
+    std::sort(pairs.begin(), pairs.end());
+#endif
+
+    // Flag the unique pairs and compute their index in the candidates array
+    IndexArray isUnique(numPairs, numPairs, allocatorId);
+    IndexArray uniqueOffsets(numPairs, numPairs, allocatorId);
+    const auto v_isUnique = isUnique.view();
+    for_all<ExecSpace>(
+      numPairs,
+      AXOM_LAMBDA(IndexType k) {
+        v_isUnique[k] = (k == 0 || v_pairs[k] != v_pairs[k - 1]) ? 1 : 0;
+      });
+    const IndexType numUnique =
+      exclusiveScan<ExecSpace>(isUnique.view(), uniqueOffsets.view());
+
+    // Fill the deduplicated candidates and count them for each triangle
+    m_currCandidates = IndexArray(numUnique, numUnique, allocatorId);
+    const auto v_candidates = m_currCandidates.view();
+    const auto v_uniqueOffsets = uniqueOffsets.view();
+    for_all<ExecSpace>(
+      ncells,
+      AXOM_LAMBDA(IndexType i) { v_counts[i] = 0; });
+    for_all<ExecSpace>(
+      numPairs,
+      AXOM_LAMBDA(IndexType k) {
+        if(v_isUnique[k] == 1)
+        {
+          const IndexType i = static_cast<IndexType>(v_pairs[k] / ncells);
+          v_candidates[v_uniqueOffsets[k]] =
+            static_cast<IndexType>(v_pairs[k] % ncells);
+#ifdef AXOM_USE_RAJA
+          RAJA::atomicAdd<atomic_pol>(&v_counts[i], IndexType {1});
+#else
+          v_counts[i]++;
+#endif
+        }
+      });
+    exclusiveScan<ExecSpace>(counts.view(), offsets.view());
 
-    gridIndex.getCandidatesAsArray(this->m_aabbs, offsets, counts, m_currCandidates);
     return m_currCandidates;
   }
 
+  /*!
+   * \brief Runs a query to find pairs of triangle cell indices intersecting
+   *  in the surface mesh, as well as degenerate triangles in the mesh.
+   *
+   * \param [out] firstIndex The first indices of intersecting pairs
+   * \param [out] secondIndex The second indices of intersecting pairs
+   * \param [out] degenerateIndices Indices of degenerate mesh triangles
+   *
+   * \note The pairs are sorted by their first, and then by their second index
+   */
+  void findTriMeshIntersections(axom::Array<IndexType>& firstIndex,
+                                axom::Array<IndexType>& secondIndex,
+                                axom::Array<IndexType>& degenerateIndices)
+  {
+    const int allocatorId = axom::detail::getAllocatorID<Space>();
+    const IndexType ncells = this->m_aabbs.size();
+
+    IndexArray offsets, counts;
+    const auto candidates = getCandidates(offsets, counts);
+    const IndexType numPairs = candidates.size();
+
+    // Expand the first index of each candidate pair
+    IndexArray pairFirst(numPairs, numPairs, allocatorId);
+    const auto v_pairFirst = pairFirst.view();
+    const auto v_offsets = offsets.view();
+    const auto v_counts = counts.view();
+    for_all<ExecSpace>(
+      ncells,
+      AXOM_LAMBDA(IndexType i) {
+        for(IndexType k = 0; k < v_counts[i]; ++k)
+        {
+          v_pairFirst[v_offsets[i] + k] = i;
+        }
+      });
+
+    // Test the candidate pairs for intersection
+    IndexArray isIsect(numPairs, numPairs, allocatorId);
+    IndexArray isectOffsets(numPairs, numPairs, allocatorId);
+    const auto v_isIsect = isIsect.view();
+    const auto v_tris = this->m_tris.view();
+    const double intersectionThreshold = this->m_intersectionThreshold;
+    for_all<ExecSpace>(
+      numPairs,
+      AXOM_LAMBDA(IndexType k) {
+        const bool isect = primal::intersect(v_tris[v_pairFirst[k]],
+                                             v_tris[candidates[k]],
+                                             false,
+                                             intersectionThreshold);
+        v_isIsect[k] = isect ? 1 : 0;
+      });
+    const IndexType numIsect =
+      exclusiveScan<ExecSpace>(isIsect.view(), isectOffsets.view());
+
+    // Compact the intersecting pairs, preserving their order
+    IndexArray firstIsectPair(numIsect, numIsect, allocatorId);
+    IndexArray secondIsectPair(numIsect, numIsect, allocatorId);
+    {
+      const auto v_isectOffsets = isectOffsets.view();
+      const auto v_firstIsectPair = firstIsectPair.view();
+      const auto v_secondIsectPair = secondIsectPair.view();
+      for_all<ExecSpace>(
+        numPairs,
+        AXOM_LAMBDA(IndexType k) {
+          if(v_isIsect[k] == 1)
+          {
+            v_firstIsectPair[v_isectOffsets[k]] = v_pairFirst[k];
+            v_secondIsectPair[v_isectOffsets[k]] = candidates[k];
+          }
+        });
+    }
+
+    // copy results to output on host
+    firstIndex = HostIndexArray(firstIsectPair);
+    secondIndex = HostIndexArray(secondIsectPair);
+    HostIndexArray host_degenerate = this->m_degenerate;
+    for(int i = 0; i < host_degenerate.size(); i++)
+    {
+      if(host_degenerate[i] == 1)
+      {
+        degenerateIndices.push_back(i);
+      }
+    }
+  }
+
   BoxType m_globalBox;
   primal::NumericArray<int, 3> m_resolutions;
-  axom::Array<IndexType> m_currCandidates;
+  IndexArray m_currCandidates;
+};
+
+/*!
+ * \class VertexWelder
+ *
+ * \brief Welds the nodes of an unstructured mesh that are within a given
+ *  distance of each other, using the execution space \a ExecSpace.
+ *
+ * The nodes are quantized to a lattice with spacing \a eps and sorted by
+ * a hash of their lattice cell.  Since nodes that are within \a eps of each
+ * other (under the max norm) are in the same or in adjacent lattice cells,
+ * each node only checks the nodes in the 3^NDIMS cells around its own cell.
+ * Each group of nodes that are connected through such close pairs is then
+ * labeled by its lowest node index, by iteratively propagating the minimum
+ * label over the pairs.  Finally, the mesh is compacted in place.
+ *
+ * \see quest::weldMeshVertices()
+ */
+template <int NDIMS, typename ExecSpace>
+class VertexWelder
+{
+  AXOM_STATIC_ASSERT_MSG(NDIMS >= 1 && NDIMS <= 3,
+                         "VertexWelder requires a 1D, 2D or 3D mesh");
+
+  using IndexArray = axom::Array<IndexType>;
+  using IndexView = axom::ArrayView<IndexType>;
+  using CellCoord = axom::int64;
+  using HashKey = axom::uint64;
+
+  static constexpr int NUM_NEIGHBOR_CELLS =
+    (NDIMS == 1) ? 3 : ((NDIMS == 2) ? 9 : 27);
+
+  /*!
+   * \brief Lightweight, copyable view of the sorted, quantized nodes
+   *  that can be captured in kernels
+   */
+  struct NodeGrid
+  {
+    IndexType numNodes;
+    double eps;
+    const double* coords[NDIMS];
+    axom::ArrayView<CellCoord> cells;
+    axom::ArrayView<HashKey> sortedKeys;
+    IndexView order;
+
+    /*!
+     * \brief Calls \a func(j) for each node j other than \a i that is within
+     *  \a eps of node \a i (under the max norm)
+     */
+    template <typename Func>
+    AXOM_HOST_DEVICE void visitCloseNodes(IndexType i, Func&& func) const
+    {
+      const CellCoord* cell = &cells[i * NDIMS];
+      CellCoord nbr[NDIMS];
+      for(int n = 0; n < NUM_NEIGHBOR_CELLS; ++n)
+      {
+        for(int d = 0, code = n; d < NDIMS; ++d, code /= 3)
+        {
+          nbr[d] = cell[d] + (code % 3) - 1;
+        }
+
+        const HashKey key = hashCell(nbr);
+        for(IndexType k = lowerBound(key);
+            k < numNodes && sortedKeys[k] == key;
+            ++k)
+        {
+          const IndexType j = order[k];
+          if(j != i && sameCell(&cells[j * NDIMS], nbr) &&
+             distance(i, j) <= eps)
+          {
+            func(j);
+          }
+        }
+      }
+    }
+
+    /// Returns the max norm distance between nodes \a i and \a j
+    AXOM_HOST_DEVICE double distance(IndexType i, IndexType j) const
+    {
+      double dist = 0.;
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        const double delta = coords[d][i] - coords[d][j];
+        dist = axom::utilities::max(dist, axom::utilities::abs(delta));
+      }
+      return dist;
+    }
+
+    /// Returns the index of the first sorted key that is not less than \a key
+    AXOM_HOST_DEVICE IndexType lowerBound(HashKey key) const
+    {
+      IndexType lo = 0;
+      IndexType hi = numNodes;
+      while(lo < hi)
+      {
+        const IndexType mid = lo + (hi - lo) / 2;
+        if(sortedKeys[mid] < key)
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+      return lo;
+    }
+
+    AXOM_HOST_DEVICE static bool sameCell(const CellCoord* a,
+                                          const CellCoord* b)
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        if(a[d] != b[d])
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+
+public:
+  /*!
+   * \brief Constructor
+   *
+   * \param [in] mesh The mesh whose nodes will be welded
+   * \param [in] eps Distance threshold for welding nodes (using the max norm)
+   */
+  VertexWelder(UMesh* mesh, double eps)
+    : m_mesh(mesh)
+    , m_eps(eps)
+    , m_allocatorID(axom::execution_space<ExecSpace>::allocatorID())
+  { }
+
+  /*!
+   * \brief Welds the nodes of the mesh, and removes the cells that do not
+   *  have distinct nodes after the welding
+   */
+  void weld()
+  {
+    SLIC_ERROR_IF(
+      m_mesh->getFieldData(mint::FACE_CENTERED)->getNumFields() > 0 ||
+        m_mesh->getFieldData(mint::EDGE_CENTERED)->getNumFields() > 0,
+      "Cannot weld the vertices of a mesh with face or edge-centered fields");
+
+    m_numNodes = m_mesh->getNumberOfNodes();
+    if(m_numNodes == 0)
+    {
+      return;
+    }
+
+    quantizeNodes();
+    sortNodes();
+    findCloseNodes();
+    labelNodes();
+    compactNodes();
+    compactCells();
+  }
+
+  /// Returns the number of welded nodes that merged two or more input nodes
+  IndexType getNumWeldedGroups() const { return m_numWeldedGroups; }
+
+  /// Returns the largest distance between a merged node and its welded node
+  double getMaxDisplacement() const { return m_maxDisplacement; }
+
+  /*!
+   * \brief Returns the number of removed cells that still had three or more
+   *  distinct nodes, e.g., the quads that collapsed to a triangle
+   */
+  IndexType getNumDegradedCells() const { return m_numDegradedCells; }
+
+private:
+  /// Combines the coordinates of a lattice cell into a hash key
+  AXOM_HOST_DEVICE static HashKey hashCell(const CellCoord* cell)
+  {
+    // hash combiner from boost's hash_combine(), followed by the
+    // splitmix64 finalizer to spread similar cells across the key range
+    HashKey seed = 0;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      seed ^= static_cast<HashKey>(cell[d]) + 0x9e3779b97f4a7c15ULL +
+        (seed << 6) + (seed >> 2);
+    }
+    seed ^= seed >> 30;
+    seed *= 0xbf58476d1ce4e5b9ULL;
+    seed ^= seed >> 27;
+    seed *= 0x94d049bb133111ebULL;
+    seed ^= seed >> 31;
+    return seed;
+  }
+
+  template <typename T>
+  AXOM_HOST_DEVICE static T atomicAdd(T* address, T value)
+  {
+#ifdef AXOM_USE_RAJA
+    using atomic_pol = typename axom::execution_space<ExecSpace>::atomic_policy;
+    return RAJA::atomicAdd<atomic_pol>(address, value);
+#else
+    const T old = *address;
+    *address += value;
+    return old;
+#endif
+  }
+
+  template <typename T>
+  AXOM_HOST_DEVICE static void atomicMax(T* address, T value)
+  {
+#ifdef AXOM_USE_RAJA
+    using atomic_pol = typename axom::execution_space<ExecSpace>::atomic_policy;
+    RAJA::atomicMax<atomic_pol>(address, value);
+#else
+    *address = axom::utilities::max(*address, value);
+#endif
+  }
+
+  /// Returns the value of the single entry array \a arr on the host
+  template <typename T>
+  static T hostValue(const axom::Array<T>& arr)
+  {
+    T value;
+    axom::copy(&value, arr.data(), sizeof(T));
+    return value;
+  }
+
+  /// Allocates \a offsets and fills it with the prefix sum of \a counts
+  IndexType computeOffsets(IndexArray& counts, IndexArray& offsets) const
+  {
+    offsets = IndexArray(counts.size(), counts.size(), m_allocatorID);
+    return exclusiveScan<ExecSpace>(counts.view(), offsets.view());
+  }
+
+  /*!
+   * \brief Allocates \a gather and fills it with the index of each of the
+   *  \a numKept entries flagged in \a keep, in order
+   */
+  void computeGatherMap(const IndexArray& keep,
+                        const IndexArray& newIndex,
+                        IndexType numKept,
+                        IndexArray& gather) const
+  {
+    gather = IndexArray(numKept, numKept, m_allocatorID);
+    const auto v_keep = keep.view();
+    const auto v_newIndex = newIndex.view();
+    const auto v_gather = gather.view();
+    for_all<ExecSpace>(
+      keep.size(),
+      AXOM_LAMBDA(IndexType i) {
+        if(v_keep[i] == 1)
+        {
+          v_gather[v_newIndex[i]] = i;
+        }
+      });
+  }
+
+  /*!
+   * \brief Moves the tuples \a gather[i] of every field with the given
+   *  \a association to position i, for the first \a numTuples tuples
+   */
+  void gatherFields(int association,
+                    IndexType numTuples,
+                    const IndexArray& gather)
+  {
+    const mint::FieldData* fields = m_mesh->getFieldData(association);
+    for(int i = 0; i < fields->getNumFields(); ++i)
+    {
+      const mint::Field* field = fields->getField(i);
+      const std::string& name = field->getName();
+      const IndexType numComponents = field->getNumComponents();
+      const IndexType* p = gather.data();
+
+      switch(field->getType())
+      {
+      case mint::FLOAT_FIELD_TYPE:
+        mint::internal::permuteTuples<ExecSpace>(
+          numTuples,
+          numComponents,
+          p,
+          m_mesh->getFieldPtr<float>(name, association));
+        break;
+      case mint::DOUBLE_FIELD_TYPE:
+        mint::internal::permuteTuples<ExecSpace>(
+          numTuples,
+          numComponents,
+          p,
+          m_mesh->getFieldPtr<double>(name, association));
+        break;
+      case mint::INT32_FIELD_TYPE:
+        mint::internal::permuteTuples<ExecSpace>(
+          numTuples,
+          numComponents,
+          p,
+          m_mesh->getFieldPtr<axom::int32>(name, association));
+        break;
+      case mint::INT64_FIELD_TYPE:
+        mint::internal::permuteTuples<ExecSpace>(
+          numTuples,
+          numComponents,
+          p,
+          m_mesh->getFieldPtr<axom::int64>(name, association));
+        break;
+      default:
+        SLIC_ERROR("Field [" << name << "] has an unsupported type");
+      }  // END switch
+    }
+  }
+
+  /// Returns a NodeGrid over the current data
+  NodeGrid nodeGrid()
+  {
+    NodeGrid grid;
+    grid.numNodes = m_numNodes;
+    grid.eps = m_eps;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      grid.coords[d] = m_mesh->getCoordinateArray(d);
+    }
+    grid.cells = m_cells.view();
+    grid.sortedKeys = m_sortedKeys.view();
+    grid.order = m_order.view();
+    return grid;
+  }
+
+  /// Quantizes the nodes to a lattice with spacing eps and hashes their cells
+  void quantizeNodes()
+  {
+    AXOM_PERF_MARK_FUNCTION("VertexWelder::quantizeNodes");
+
+    const IndexType numNodes = m_numNodes;
+    const double invEps = 1. / m_eps;
+
+    m_cells = axom::Array<CellCoord>(numNodes * NDIMS,
+                                     numNodes * NDIMS,
+                                     m_allocatorID);
+    m_keys = axom::Array<HashKey>(numNodes, numNodes, m_allocatorID);
+    const auto v_cells = m_cells.view();
+    const auto v_keys = m_keys.view();
+
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const double* x = m_mesh->getCoordinateArray(d);
+
+      // Find the extent of the nodes along this dimension
+      double lo, hi;
+#ifdef AXOM_USE_RAJA
+      using reduce_pol =
+        typename axom::execution_space<ExecSpace>::reduce_policy;
+      RAJA::ReduceMin<reduce_pol, double> xmin(
+        std::numeric_limits<double>::max());
+      RAJA::ReduceMax<reduce_pol, double> xmax(
+        std::numeric_limits<double>::lowest());
+      for_all<ExecSpace>(
+        numNodes,
+        AXOM_LAMBDA(IndexType i) {
+          xmin.min(x[i]);
+          xmax.max(x[i]);
+        });
+      lo = xmin.get();
+      hi = xmax.get();
+#else
+      lo = std::numeric_limits<double>::max();
+      hi = std::numeric_limits<double>::lowest();
+      for(IndexType i = 0; i < numNodes; ++i)
+      {
+        lo = axom::utilities::min(lo, x[i]);
+        hi = axom::utilities::max(hi, x[i]);
+      }
+#endif
+
+      SLIC_ASSERT_MSG((hi - lo) * invEps < static_cast<double>(1LL << 62),
+                      "Welding threshold " << m_eps
+                                           << " is too small for mesh extent "
+                                           << (hi - lo));
+
+      for_all<ExecSpace>(
+        numNodes,
+        AXOM_LAMBDA(IndexType i) {
+          v_cells[i * NDIMS + d] = static_cast<CellCoord>((x[i] - lo) * invEps);
+        });
+    }
+
+    for_all<ExecSpace>(
+      numNodes,
+      AXOM_LAMBDA(IndexType i) { v_keys[i] = hashCell(&v_cells[i * NDIMS]); });
+  }
+
+  /// Sorts the node indices by the hash keys of their lattice cells
+  void sortNodes()
+  {
+    AXOM_PERF_MARK_FUNCTION("VertexWelder::sortNodes");
+
+    const IndexType numNodes = m_numNodes;
+
+    m_sortedKeys = m_keys;
+    m_order = IndexArray(numNodes, numNodes, m_allocatorID);
+    const auto v_order = m_order.view();
+    for_all<ExecSpace>(
+      numNodes,
+      AXOM_LAMBDA(IndexType i) { v_order[i] = i; });
+
+#ifdef AXOM_USE_RAJA
+    using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+    RAJA::sort_pairs<exec_policy>(
+      RAJA::make_span(m_sortedKeys.data(), numNodes),
+      RAJA::make_span(m_order.data(), numNodes));
+#else
+    const auto& keys = m_keys;
+    std::sort(m_order.begin(), m_order.end(), [&](IndexType a, IndexType b) {
+      return keys[a] < keys[b];
+    });
+    for(IndexType i = 0; i < numNodes; ++i)
+    {
+      m_sortedKeys[i] = keys[m_order[i]];
+    }
+#endif
+  }
+
+  /// Builds the (CSR) list of close nodes for each node
+  void findCloseNodes()
+  {
+    AXOM_PERF_MARK_FUNCTION("VertexWelder::findCloseNodes");
+
+    const IndexType numNodes = m_numNodes;
+    const NodeGrid grid = nodeGrid();
+
+    IndexArray counts(numNodes, numNodes, m_allocatorID);
+    const auto v_counts = counts.view();
+    for_all<ExecSpace>(
+      numNodes,
+      AXOM_LAMBDA(IndexType i) {
+        IndexType count = 0;
+        grid.visitCloseNodes(i, [&](IndexType) { ++count; });
+        v_counts[i] = count;
+      });
+
+    const IndexType totalCount = computeOffsets(counts, m_closeOffsets);
+    m_closeCounts = std::move(counts);
+
+    m_closeNodes = IndexArray(totalCount, totalCount, m_allocatorID);
+    const auto v_offsets = m_closeOffsets.view();
+    const auto v_closeNodes = m_closeNodes.view();
+    for_all<ExecSpace>(
+      numNodes,
+      AXOM_LAMBDA(IndexType i) {
+        IndexType idx = v_offsets[i];
+        grid.visitCloseNodes(i, [&](IndexType j) { v_closeNodes[idx++] = j; });
+      });
+  }
+
+  /// Labels each node with the lowest index of the nodes it is welded to
+  void labelNodes()
+  {
+    AXOM_PERF_MARK_FUNCTION("VertexWelder::labelNodes");
+
+    const IndexType numNodes = m_numNodes;
+
+    m_labels = IndexArray(numNodes, numNodes, m_allocatorID);
+    IndexArray nextLabels(numNodes, numNodes, m_allocatorID);
+    IndexArray numChanged(1, 1, m_allocatorID);
+
+    {
+      const auto v_labels = m_labels.view();
+      for_all<ExecSpace>(
+        numNodes,
+        AXOM_LAMBDA(IndexType i) { v_labels[i] = i; });
+    }
+
+    const auto v_offsets = m_closeOffsets.view();
+    const auto v_counts = m_closeCounts.view();
+    const auto v_closeNodes = m_closeNodes.view();
+    const auto v_numChanged = numChanged.view();
+
+    // Each sweep propagates the minimum label over the close node pairs
+    // and shortcuts the labels of the nodes' current labels
+    IndexType changed = 0;
+    do
+    {
+      const auto v_labels = m_labels.view();
+      const auto v_nextLabels = nextLabels.view();
+
+      for_all<ExecSpace>(
+        1,
+        AXOM_LAMBDA(IndexType) { v_numChanged[0] = 0; });
+
+      for_all<ExecSpace>(
+        numNodes,
+        AXOM_LAMBDA(IndexType i) {
+          const IndexType label = v_labels[i];
+          IndexType minLabel = axom::utilities::min(label, v_labels[label]);
+          const IndexType end = v_offsets[i] + v_counts[i];
+          for(IndexType k = v_offsets[i]; k < end; ++k)
+          {
+            const IndexType otherLabel = v_labels[v_closeNodes[k]];
+            minLabel = axom::utilities::min(minLabel, otherLabel);
+          }
+          v_nextLabels[i] = minLabel;
+
+          if(minLabel != label)
+          {
+            atomicAdd(&v_numChanged[0], IndexType {1});
+          }
+        });
+
+      std::swap(m_labels, nextLabels);
+      changed = hostValue(numChanged);
+    } while(changed > 0);
+  }
+
+  /// Removes the merged nodes and computes the new index of every node
+  void compactNodes()
+  {
+    AXOM_PERF_MARK_FUNCTION("VertexWelder::compactNodes");
+
+    const IndexType numNodes = m_numNodes;
+    const NodeGrid grid = nodeGrid();
+    const auto v_labels = m_labels.view();
+
+    // Mark the welded nodes, i.e. the nodes with the lowest index in a group,
+    // and the welded nodes that merged several nodes
+    IndexArray isWelded(numNodes, numNodes, m_allocatorID);
+    IndexArray hasMerged(numNodes, numNodes, m_allocatorID);
+    axom::Array<double> maxDisplacement(1, 1, m_allocatorID);
+    const auto v_isWelded = isWelded.view();
+    const auto v_hasMerged = hasMerged.view();
+    const auto v_maxDisplacement = maxDisplacement.view();
+
+    for_all<ExecSpace>(
+      numNodes,
+      AXOM_LAMBDA(IndexType i) {
+        const IndexType label = v_labels[i];
+        if(label == i)
+        {
+          v_isWelded[i] = 1;
+        }
+        else
+        {
+          v_hasMerged[label] = 1;
+          atomicMax(&v_maxDisplacement[0], grid.distance(i, label));
+        }
+      });
+
+    IndexArray newIndex;
+    m_numWeldedNodes = computeOffsets(isWelded, newIndex);
+    m_maxDisplacement = hostValue(maxDisplacement);
+
+    IndexArray numWeldedGroups(1, 1, m_allocatorID);
+    const auto v_numWeldedGroups = numWeldedGroups.view();
+    for_all<ExecSpace>(
+      numNodes,
+      AXOM_LAMBDA(IndexType i) {
+        if(v_hasMerged[i] == 1)
+        {
+          atomicAdd(&v_numWeldedGroups[0], IndexType {1});
+        }
+      });
+    m_numWeldedGroups = hostValue(numWeldedGroups);
+
+    // Map every node to the new index of its welded node
+    m_remap = IndexArray(numNodes, numNodes, m_allocatorID);
+    const auto v_remap = m_remap.view();
+    const auto v_newIndex = newIndex.view();
+    for_all<ExecSpace>(
+      numNodes,
+      AXOM_LAMBDA(IndexType i) { v_remap[i] = v_newIndex[v_labels[i]]; });
+
+    // Move the coordinates and field values of the welded nodes to the front
+    // of their arrays
+    const IndexType numWelded = m_numWeldedNodes;
+    IndexArray gather;
+    computeGatherMap(isWelded, newIndex, numWelded, gather);
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      mint::internal::permuteTuples<ExecSpace>(numWelded,
+                                               1,
+                                               gather.data(),
+                                               m_mesh->getCoordinateArray(d));
+    }
+    gatherFields(mint::NODE_CENTERED, numWelded, gather);
+
+    m_mesh->resizeNodes(numWelded);
+  }
+
+  /// Reindexes the cells and removes the cells without distinct nodes
+  void compactCells()
+  {
+    AXOM_PERF_MARK_FUNCTION("VertexWelder::compactCells");
+
+    const IndexType numCells = m_mesh->getNumberOfCells();
+    const IndexType numCellNodes = m_mesh->getNumberOfCellNodes();
+    IndexType* connec = m_mesh->getCellNodesArray();
+    const auto v_remap = m_remap.view();
+
+    IndexArray keep(numCells, numCells, m_allocatorID);
+    IndexArray numDegraded(1, 1, m_allocatorID);
+    const auto v_keep = keep.view();
+    const auto v_numDegraded = numDegraded.view();
+    for_all<ExecSpace>(
+      numCells,
+      AXOM_LAMBDA(IndexType c) {
+        IndexType* nodes = connec + c * numCellNodes;
+        IndexType numDistinct = 0;
+        for(IndexType k = 0; k < numCellNodes; ++k)
+        {
+          nodes[k] = v_remap[nodes[k]];
+          bool distinct = true;
+          for(IndexType m = 0; m < k; ++m)
+          {
+            distinct = distinct && (nodes[m] != nodes[k]);
+          }
+          numDistinct += distinct ? 1 : 0;
+        }
+        v_keep[c] = (numDistinct == numCellNodes) ? 1 : 0;
+        if(numDistinct < numCellNodes && numDistinct >= 3)
+        {
+          atomicAdd(&v_numDegraded[0], IndexType {1});
+        }
+      });
+
+    m_numDegradedCells = hostValue(numDegraded);
+
+    IndexArray newIndex;
+    const IndexType numKept = computeOffsets(keep, newIndex);
+
+    // Move the connectivity and field values of the remaining cells to the
+    // front of their arrays
+    IndexArray gather;
+    computeGatherMap(keep, newIndex, numKept, gather);
+    mint::internal::permuteTuples<ExecSpace>(numKept,
+                                             numCellNodes,
+                                             gather.data(),
+                                             connec);
+    gatherFields(mint::CELL_CENTERED, numKept, gather);
+
+    m_mesh->resizeCells(numKept);
+
+    // Regenerate the face relations if they were in use
+    if(m_mesh->getNumberOfFaces() > 0)
+    {
+      m_mesh->initializeFaceConnectivity(true);
+    }
+  }
+
+private:
+  UMesh* m_mesh;
+  double m_eps;
+  int m_allocatorID;
+  IndexType m_numNodes {0};
+
+  axom::Array<CellCoord> m_cells;
+  axom::Array<HashKey> m_keys;
+  axom::Array<HashKey> m_sortedKeys;
+  IndexArray m_order;
+
+  IndexArray m_closeOffsets;
+  IndexArray m_closeCounts;
+  IndexArray m_closeNodes;
+
+  IndexArray m_labels;
+  IndexArray m_remap;
+
+  IndexType m_numWeldedNodes {0};
+  IndexType m_numWeldedGroups {0};
+  IndexType m_numDegradedCells {0};
+  double m_maxDisplacement {0.};
 };
 
 }  // namespace detail
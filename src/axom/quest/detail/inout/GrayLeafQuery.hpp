@@ -0,0 +1,253 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file GrayLeafQuery.hpp
+ *
+ * \brief Defines the containment test for points in gray leaf blocks
+ * of an InOutOctree.
+ */
+
+#ifndef AXOM_QUEST_INOUT_OCTREE_GRAY_LEAF_QUERY__HPP_
+#define AXOM_QUEST_INOUT_OCTREE_GRAY_LEAF_QUERY__HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+
+#include <limits>
+
+namespace axom
+{
+namespace quest
+{
+namespace detail
+{
+/**
+ * \brief Determines whether the specified 3D point is within the local
+ * surface of a gray leaf block
+ *
+ * Finds a ray from \a queryPt to a point of a triangle within the block.
+ * Then finds the first triangle along this ray. The orientation of the ray
+ * against this triangle's normal indicates queryPt's containment.
+ * It is inside when the dot product is positive.
+ *
+ * \param queryPt The point we are querying
+ * \param blockBB The bounding box of the gray leaf block
+ * \param cells The indices of the cells indexed by the gray leaf block
+ * \param mesh The surface mesh; must provide a \a cellPositions(idx) function
+ * \param bbScaleFactor Scale factor for expanding \a blockBB when a triangle
+ * only grazes the block
+ * \return True, if the point is inside the local surface associated with this
+ * block, false otherwise
+ *
+ * \note Shared by the InOutOctree and its read-only packed representation
+ */
+template <typename MeshType, typename CellIndexSet>
+bool withinGrayLeaf(const primal::Point<double, 3>& queryPt,
+                    const primal::BoundingBox<double, 3>& blockBB,
+                    const CellIndexSet& cells,
+                    const MeshType& mesh,
+                    double bbScaleFactor)
+{
+  using SpacePt = primal::Point<double, 3>;
+  using SpaceVector = primal::Vector<double, 3>;
+  using SpaceRay = primal::Ray<double, 3>;
+  using GeometricBoundingBox = primal::BoundingBox<double, 3>;
+  using CellIndex = axom::IndexType;
+  constexpr CellIndex NO_CELL = -1;
+
+  SpacePt triPt;
+
+  const int numTris = cells.size();
+  for(int i = 0; i < numTris; ++i)
+  {
+    /// Get the triangle
+    const CellIndex idx = cells[i];
+    const auto tri = mesh.cellPositions(idx);
+
+    /// Find a point from this triangle within the bounding box of the mesh
+    primal::Polygon<double, 3> poly = primal::clip(tri, blockBB);
+    if(poly.numVertices() == 0)
+    {
+      // Account for cases where the triangle only grazes the bounding box.
+      // Here, intersect(tri,blockBB) is true, but the clipping algorithm
+      // produces an empty polygon.  To resolve this, clip against a
+      // slightly expanded bounding box
+      GeometricBoundingBox expandedBB = blockBB;
+      expandedBB.scale(10 * bbScaleFactor);
+
+      poly = primal::clip(tri, expandedBB);
+
+      // If that still doesn't work, move on to the next triangle
+      if(poly.numVertices() == 0)
+      {
+        continue;
+      }
+    }
+
+    triPt = poly.vertexMean();
+
+    /// Use a ray from the query point to the triangle point to find an
+    /// intersection. Note: We have to check all triangles to ensure that
+    /// there is not a closer triangle than tri along this direction.
+    CellIndex tIdx = NO_CELL;
+    double minRayParam = std::numeric_limits<double>::infinity();
+    SpaceRay ray(queryPt, SpaceVector(queryPt, triPt));
+
+    double rayParam = 0;
+    if(primal::intersect(tri, ray, rayParam))
+    {
+      minRayParam = rayParam;
+      tIdx = idx;
+    }
+
+    for(int j = 0; j < numTris; ++j)
+    {
+      const CellIndex localIdx = cells[j];
+      if(localIdx == idx) continue;
+
+      if(primal::intersect(mesh.cellPositions(localIdx), ray, rayParam))
+      {
+        if(rayParam < minRayParam)
+        {
+          minRayParam = rayParam;
+          tIdx = localIdx;
+        }
+      }
+    }
+
+    if(tIdx == NO_CELL)
+    {
+      continue;
+    }
+
+    // Inside when the dot product of the normal with this triangle is positive
+    SpaceVector normal =
+      (tIdx == idx) ? tri.normal() : mesh.cellPositions(tIdx).normal();
+
+    return normal.dot(ray.direction()) > 0.;
+  }
+
+  SLIC_DEBUG("Could not determine inside/outside for point "
+             << queryPt << " on block with bounding box " << blockBB);
+
+  return false;  // query points on boundary might get here -- revisit this.
+}
+
+/**
+ * \brief Determines whether the specified 2D point is within the local
+ * surface of a gray leaf block
+ *
+ * Finds a ray from \a queryPt to a point of a segment within the block.
+ * Then finds the first segment along this ray. The orientation of the ray
+ * against this segment's normal indicates queryPt's containment.
+ * It is inside when the dot product is positive.
+ *
+ * \param queryPt The point we are querying
+ * \param blockBB The bounding box of the gray leaf block
+ * \param cells The indices of the cells indexed by the gray leaf block
+ * \param mesh The surface mesh; must provide \a cellPositions(idx) and
+ * \a surfaceNormal(idx, segmentParameter, cells) functions
+ * \param bbScaleFactor Scale factor for expanding \a blockBB
+ * \return True, if the point is inside the local surface associated with this
+ * block, false otherwise
+ *
+ * \note Shared by the InOutOctree and its read-only packed representation
+ */
+template <typename MeshType, typename CellIndexSet>
+bool withinGrayLeaf(const primal::Point<double, 2>& queryPt,
+                    const primal::BoundingBox<double, 2>& blockBB,
+                    const CellIndexSet& cells,
+                    const MeshType& mesh,
+                    double bbScaleFactor)
+{
+  using SpacePt = primal::Point<double, 2>;
+  using SpaceVector = primal::Vector<double, 2>;
+  using SpaceRay = primal::Ray<double, 2>;
+  using GeometricBoundingBox = primal::BoundingBox<double, 2>;
+  using CellIndex = axom::IndexType;
+  constexpr CellIndex NO_CELL = -1;
+
+  GeometricBoundingBox expandedBB = blockBB;
+  expandedBB.scale(bbScaleFactor);
+
+  SpacePt segmentPt;
+
+  const int numSegments = cells.size();
+  for(int i = 0; i < numSegments; ++i)
+  {
+    /// Get the segment
+    const CellIndex idx = cells[i];
+    const auto seg = mesh.cellPositions(idx);
+
+    /// Find a point from this segment within the expanded bounding box of the mesh
+    // We'll use the midpoint of the segment after clipping it against the bounding box
+    double pMin, pMax;
+    const bool intersects = primal::intersect(seg, expandedBB, pMin, pMax);
+    if(!intersects)
+    {
+      continue;
+    }
+    segmentPt = seg.at(0.5 * (pMin + pMax));
+
+    // Using a ray from query pt to point on this segment
+    // Find closest intersection to surface within cell inside this bounding box
+    CellIndex tIdx = NO_CELL;
+    double minRayParam = std::numeric_limits<double>::infinity();
+    double minSegParam = std::numeric_limits<double>::infinity();
+    SpaceRay ray(queryPt, SpaceVector(queryPt, segmentPt));
+
+    double rayParam = 0;
+    double segParam = 0;
+    if(primal::intersect(ray, seg, rayParam, segParam))
+    {
+      minRayParam = rayParam;
+      minSegParam = segParam;
+      tIdx = idx;
+    }
+
+    for(int j = 0; j < numSegments; ++j)
+    {
+      const CellIndex localIdx = cells[j];
+      if(localIdx == idx) continue;
+
+      if(primal::intersect(ray,
+                           mesh.cellPositions(localIdx),
+                           rayParam,
+                           segParam))
+      {
+        if(rayParam < minRayParam)
+        {
+          minRayParam = rayParam;
+          minSegParam = segParam;
+          tIdx = localIdx;
+        }
+      }
+    }
+    if(tIdx == NO_CELL)
+    {
+      continue;
+    }
+
+    // Get the surface normal at the intersection point
+    // If the latter is a vertex, the normal is the average of its two incident segments
+    SpaceVector normal = mesh.surfaceNormal(tIdx, minSegParam, cells);
+
+    // Query point is inside when the dot product of the normal with ray is positive
+    return normal.dot(ray.direction()) > 0.;
+  }
+
+  SLIC_DEBUG("Could not determine inside/outside for point "
+             << queryPt << " on block with bounding box " << blockBB);
+
+  return false;  // query points on boundary might get here -- revisit this.
+}
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_INOUT_OCTREE_GRAY_LEAF_QUERY__HPP_
@@ -176,10 +176,10 @@ public:
             m_levelGrayBlockCount[lev],
             m_levelCellRefCount[lev]);
         }
-        //sstr <<"Hash load factor: "
-        //     << this->m_leavesLevelMap[ lev ].load_factor()
-        //     << " -- max lf: " << this->m_leavesLevelMap[ lev
-        // ].max_load_factor();
+        const auto& octLevel = m_octree.getOctreeLevel(lev);
+        sstr << fmt::format(" Load factor: {:.3f}; {} bytes.",
+                            octLevel.loadFactor(),
+                            octLevel.numBytes());
         sstr << "\n";
       }
     }
@@ -187,6 +187,55 @@ public:
     return sstr.str();
   }
 
+  /// Returns the statistics of the octree's blocks and their memory usage
+  typename InOutOctreeType::Statistics statistics() const
+  {
+    using VertexIndex = typename InOutOctreeType::VertexIndex;
+
+    typename InOutOctreeType::Statistics stats;
+
+    // Only include levels up to the deepest level with blocks
+    int numLevels = m_octree.m_levels.size();
+    while(numLevels > 1 && m_levelBlocks[numLevels - 1] == 0)
+    {
+      --numLevels;
+    }
+
+    stats.levels.resize(numLevels);
+    for(int lev = 0; lev < numLevels; ++lev)
+    {
+      auto& levelStats = stats.levels[lev];
+      static_cast<spin::OctreeLevelStatistics&>(levelStats) =
+        m_octree.levelStatistics(lev);
+
+      levelStats.numBlackLeaves = m_levelBlackBlockCount[lev];
+      levelStats.numWhiteLeaves = m_levelWhiteBlockCount[lev];
+      levelStats.numGrayLeaves = m_levelGrayBlockCount[lev];
+      levelStats.numCellReferences = m_levelCellRefCount[lev];
+    }
+
+    stats.octreeBytes = m_octree.numBytes();
+
+    // Each level's gray leaves have a vertex, a range of cells and an offset
+    if(m_generationState >= InOutOctreeType::INOUTOCTREE_ELEMENTS_INSERTED)
+    {
+      for(int lev = 0; lev < m_octree.m_levels.size(); ++lev)
+      {
+        const int numGrayLeaves = m_octree.m_grayLeafsMap[lev].size();
+        if(numGrayLeaves > 0)
+        {
+          stats.grayLeafRelationBytes += sizeof(VertexIndex) *
+            (2 * numGrayLeaves + 1 + m_levelCellRefCount[lev]);
+        }
+      }
+    }
+
+    stats.vertexBlockMapBytes = sizeof(BlockIndex) *
+      static_cast<std::size_t>(m_octree.m_vertexToBlockMap.size());
+
+    return stats;
+  }
+
   /// Generates a string summarizing information about the mesh elements indexed by the octree
   std::string meshDataStats() const
   {
@@ -0,0 +1,694 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file PackedInOutOctree.hpp
+ *
+ * \brief Defines a read-only, pointer-free representation of an InOutOctree
+ * that can be placed in a single contiguous buffer, e.g. an MPI shared
+ * memory window.
+ */
+
+#ifndef AXOM_QUEST_INOUT_OCTREE_PACKED__HPP_
+#define AXOM_QUEST_INOUT_OCTREE_PACKED__HPP_
+
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+
+#include "BlockData.hpp"
+#include "GrayLeafQuery.hpp"
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+namespace axom
+{
+namespace quest
+{
+// Predeclare InOutOctree class
+template <int DIM>
+class InOutOctree;
+
+namespace detail
+{
+/**
+ * \class PackedInOutOctree
+ * \brief A read-only view of an InOutOctree that has been packed into
+ * a contiguous buffer
+ *
+ * The packed buffer holds everything needed for containment queries:
+ * the octree's blocks (sorted by grid point within each level), the colors
+ * of its leaf blocks, the cells indexed by its gray leaf blocks and the
+ * (welded) surface mesh. The buffer contains no pointers, so it can be
+ * written by one process and queried by other processes that map the same
+ * memory, e.g. the ranks on a compute node that share an MPI-3 window.
+ *
+ * Containment queries on a PackedInOutOctree return the same results as
+ * InOutOctree::within() on the octree that was packed.
+ *
+ * Usage:
+ * \code
+ *   std::vector<std::uint64_t> buffer(
+ *     PackedInOutOctree<3>::packedSize(octree) / sizeof(std::uint64_t));
+ *   PackedInOutOctree<3>::pack(octree, buffer.data());
+ *
+ *   PackedInOutOctree<3> packed(buffer.data());
+ *   bool inside = packed.within(pt);
+ * \endcode
+ *
+ * \note The buffer must be aligned to (at least) 8 bytes and must outlive
+ * the PackedInOutOctree instance.
+ */
+template <int DIM>
+class PackedInOutOctree
+{
+public:
+  using InOutOctreeType = InOutOctree<DIM>;
+  using GeometricBoundingBox = primal::BoundingBox<double, DIM>;
+  using SpacePt = primal::Point<double, DIM>;
+  using SpaceVector = primal::Vector<double, DIM>;
+  using SpaceCell = typename InOutOctreeType::SpaceCell;
+  using CoordType = axom::IndexType;
+  using GridPt = primal::Point<CoordType, DIM>;
+  using CellIndex = axom::IndexType;
+  using VertexIndex = axom::IndexType;
+
+  /// Number of vertices per surface cell (segments in 2D, triangles in 3D)
+  static constexpr int NUM_CELL_VERTS = DIM;
+
+  /**
+   * \brief A lightweight view of the cell indices of a gray leaf block
+   *
+   * Satisfies the requirements of the \a cells parameter of
+   * detail::withinGrayLeaf()
+   */
+  class CellIndexSpan
+  {
+  public:
+    CellIndexSpan(const CellIndex* data, IndexType size)
+      : m_data(data)
+      , m_size(size)
+    { }
+
+    IndexType size() const { return m_size; }
+    CellIndex operator[](IndexType idx) const { return m_data[idx]; }
+
+    const CellIndex* begin() const { return m_data; }
+    const CellIndex* end() const { return m_data + m_size; }
+
+  private:
+    const CellIndex* m_data;
+    IndexType m_size;
+  };
+
+private:
+  /// Encodings for the data of non-gray blocks; gray blocks hold their index
+  enum : std::int32_t
+  {
+    WHITE_LEAF = -1,
+    BLACK_LEAF = -2,
+    INTERNAL_BLOCK = -3
+  };
+
+  static constexpr std::int64_t NO_BLOCK = -1;
+
+  /// Fixed-size preamble of a packed buffer
+  struct Header
+  {
+    std::int64_t dimension;
+    std::int64_t numLevels;
+    std::int64_t numBlocks;
+    std::int64_t numGrayLeaves;
+    std::int64_t numCellRefs;
+    std::int64_t numVertices;
+    std::int64_t numCells;
+    double boundingBoxScaleFactor;
+    double bbMin[DIM];
+    double bbMax[DIM];
+  };
+
+  /// Byte offsets of the arrays that follow the header in a packed buffer
+  struct Layout
+  {
+    explicit Layout(const Header& h)
+    {
+      std::size_t offset = alignedSize(sizeof(Header));
+      levelOffsets = advance(offset, (h.numLevels + 1) * sizeof(std::int64_t));
+      deltas = advance(offset, h.numLevels * DIM * sizeof(double));
+      invDeltas = advance(offset, h.numLevels * DIM * sizeof(double));
+      blockPts = advance(offset, h.numBlocks * DIM * sizeof(CoordType));
+      blockData = advance(offset, h.numBlocks * sizeof(std::int32_t));
+      grayOffsets =
+        advance(offset, (h.numGrayLeaves + 1) * sizeof(std::int64_t));
+      grayCells = advance(offset, h.numCellRefs * sizeof(CellIndex));
+      vertices = advance(offset, h.numVertices * DIM * sizeof(double));
+      cellVertices =
+        advance(offset, h.numCells * NUM_CELL_VERTS * sizeof(VertexIndex));
+      totalSize = offset;
+    }
+
+    static std::size_t alignedSize(std::size_t bytes)
+    {
+      constexpr std::size_t ALIGNMENT = 8;
+      return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    static std::size_t advance(std::size_t& offset, std::size_t bytes)
+    {
+      const std::size_t start = offset;
+      offset += alignedSize(bytes);
+      return start;
+    }
+
+    std::size_t levelOffsets;
+    std::size_t deltas;
+    std::size_t invDeltas;
+    std::size_t blockPts;
+    std::size_t blockData;
+    std::size_t grayOffsets;
+    std::size_t grayCells;
+    std::size_t vertices;
+    std::size_t cellVertices;
+    std::size_t totalSize;
+  };
+
+public:
+  /**
+   * \brief Returns the number of bytes required to pack \a octree
+   *
+   * \pre The octree's index has been generated
+   */
+  static std::size_t packedSize(const InOutOctreeType& octree)
+  {
+    return Layout(makeHeader(octree)).totalSize;
+  }
+
+  /**
+   * \brief Packs \a octree into \a buffer
+   *
+   * \param [in] octree The InOutOctree to pack
+   * \param [out] buffer Destination buffer of at least packedSize(octree) bytes
+   * \return The number of bytes written to \a buffer
+   *
+   * \pre The octree's index has been generated
+   * \pre buffer is aligned to 8 bytes
+   */
+  static std::size_t pack(const InOutOctreeType& octree, void* buffer);
+
+  /**
+   * \brief Constructs a read-only view of a buffer that was filled by pack()
+   *
+   * \note Does not copy or take ownership of the buffer
+   */
+  explicit PackedInOutOctree(const void* buffer);
+
+  /// \brief Returns the bounding box of the packed octree
+  const GeometricBoundingBox& boundingBox() const { return m_boundingBox; }
+
+  /// \brief Returns the number of levels in the packed octree
+  int numLevels() const { return static_cast<int>(m_header->numLevels); }
+
+  /// \brief Returns the number of internal and leaf blocks in the packed octree
+  IndexType numBlocks() const { return m_header->numBlocks; }
+
+  /// \brief Returns the number of vertices in the packed surface mesh
+  IndexType numMeshVertices() const { return m_header->numVertices; }
+
+  /// \brief Returns the number of cells in the packed surface mesh
+  IndexType numMeshCells() const { return m_header->numCells; }
+
+  /// \brief Returns the size of the packed buffer in bytes
+  std::size_t size() const { return Layout(*m_header).totalSize; }
+
+  /**
+   * \brief The point containment query.
+   *
+   * \param pt The point at which we are checking for containment
+   * \return True if the point is within (or on) the surface, false otherwise
+   * \note Points outside the octree bounding box are considered outside
+   * \sa InOutOctree::within()
+   */
+  bool within(const SpacePt& pt) const;
+
+  /// \name Surface mesh accessors used by detail::withinGrayLeaf()
+  /// @{
+
+  /// \brief Returns the position of the vertex with index \a idx
+  SpacePt vertexPosition(VertexIndex idx) const
+  {
+    return SpacePt(m_vertices + DIM * idx, DIM);
+  }
+
+  /// \brief Returns the vertex indices of the cell with index \a idx
+  const VertexIndex* cellVertexIndices(CellIndex idx) const
+  {
+    return m_cellVertices + NUM_CELL_VERTS * idx;
+  }
+
+  /// \brief Returns the SpaceCell (Segment or Triangle) with index \a idx
+  SpaceCell cellPositions(CellIndex idx) const;
+
+  /**
+   * \brief Returns the normal vector of the surface for the segment
+   * with index \a cidx at parameter \a segmentParameter
+   *
+   * \sa MeshWrapper<2>::surfaceNormal()
+   */
+  SpaceVector surfaceNormal(CellIndex cidx,
+                            double segmentParameter,
+                            const CellIndexSpan& otherCells) const;
+
+  /// @}
+
+private:
+  static Header makeHeader(const InOutOctreeType& octree);
+
+  /// Lexicographic ordering of grid points within a level
+  static bool lessThan(const CoordType* a, const GridPt& b)
+  {
+    for(int i = 0; i < DIM; ++i)
+    {
+      if(a[i] != b[i])
+      {
+        return a[i] < b[i];
+      }
+    }
+    return false;
+  }
+
+  /// Finds the quantized grid cell at level \a lev for point \a pt
+  /// \sa SpatialOctree::findGridCellAtLevel()
+  GridPt findGridCellAtLevel(const SpacePt& pt, int lev) const
+  {
+    GridPt quantizedPt;
+
+    const SpacePt& bbMin = m_boundingBox.getMin();
+    const double* invDelta = m_invDeltas + DIM * lev;
+    const CoordType highestCell = (CoordType(1) << lev) - CoordType(1);
+
+    for(int i = 0; i < DIM; ++i)
+    {
+      const CoordType quantCell =
+        static_cast<CoordType>((pt[i] - bbMin[i]) * invDelta[i]);
+      quantizedPt[i] = std::min(quantCell, highestCell);
+    }
+
+    return quantizedPt;
+  }
+
+  /// Returns the index of the block at grid point \a gridPt on level \a lev,
+  /// or NO_BLOCK if the level does not contain this block
+  std::int64_t findBlock(const GridPt& gridPt, int lev) const
+  {
+    std::int64_t lo = m_levelOffsets[lev];
+    std::int64_t hi = m_levelOffsets[lev + 1];
+    while(lo < hi)
+    {
+      const std::int64_t mid = lo + ((hi - lo) >> 1);
+      if(lessThan(m_blockPts + DIM * mid, gridPt))
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    const bool found = lo < m_levelOffsets[lev + 1] &&
+      std::equal(gridPt.data(), gridPt.data() + DIM, m_blockPts + DIM * lo);
+
+    return found ? lo : NO_BLOCK;
+  }
+
+  /// Returns the spatial bounding box of a block
+  /// \sa SpatialOctree::blockBoundingBox()
+  GeometricBoundingBox blockBoundingBox(const GridPt& gridPt, int lev) const
+  {
+    const double* deltaVec = m_deltas + DIM * lev;
+
+    SpacePt lower(m_boundingBox.getMin());
+    SpacePt upper(m_boundingBox.getMin());
+    for(int i = 0; i < DIM; ++i)
+    {
+      lower[i] += gridPt[i] * deltaVec[i];
+      upper[i] += (gridPt[i] + 1) * deltaVec[i];
+    }
+
+    return GeometricBoundingBox(lower, upper);
+  }
+
+private:
+  const Header* m_header;
+  GeometricBoundingBox m_boundingBox;
+
+  const std::int64_t* m_levelOffsets;
+  const double* m_deltas;
+  const double* m_invDeltas;
+  const CoordType* m_blockPts;
+  const std::int32_t* m_blockData;
+  const std::int64_t* m_grayOffsets;
+  const CellIndex* m_grayCells;
+  const double* m_vertices;
+  const VertexIndex* m_cellVertices;
+};
+
+template <int DIM>
+typename PackedInOutOctree<DIM>::Header PackedInOutOctree<DIM>::makeHeader(
+  const InOutOctreeType& octree)
+{
+  SLIC_ASSERT_MSG(
+    octree.m_generationState == InOutOctreeType::INOUTOCTREE_LEAVES_COLORED,
+    "Can only pack an InOutOctree after its index has been generated");
+
+  Header h;
+  h.dimension = DIM;
+  h.numLevels = 0;
+  h.numBlocks = 0;
+  h.numGrayLeaves = 0;
+  h.numCellRefs = 0;
+
+  for(int lev = 0; lev < octree.m_levels.size(); ++lev)
+  {
+    const auto& levelLeafMap = octree.getOctreeLevel(lev);
+    if(levelLeafMap.empty())
+    {
+      continue;
+    }
+
+    h.numLevels = lev + 1;
+    h.numBlocks += levelLeafMap.numBlocks();
+
+    auto itEnd = levelLeafMap.end();
+    for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
+    {
+      const InOutBlockData& blockData = *it;
+      if(blockData.isLeaf() && blockData.hasData())
+      {
+        ++h.numGrayLeaves;
+        h.numCellRefs +=
+          octree.leafCells(typename InOutOctreeType::BlockIndex(it.pt(), lev),
+                           blockData)
+            .size();
+      }
+    }
+  }
+
+  h.numVertices = octree.m_meshWrapper.numMeshVertices();
+  h.numCells = octree.m_meshWrapper.numMeshCells();
+  h.boundingBoxScaleFactor = octree.m_boundingBoxScaleFactor;
+
+  const GeometricBoundingBox& bb = octree.boundingBox();
+  for(int i = 0; i < DIM; ++i)
+  {
+    h.bbMin[i] = bb.getMin()[i];
+    h.bbMax[i] = bb.getMax()[i];
+  }
+
+  return h;
+}
+
+template <int DIM>
+std::size_t PackedInOutOctree<DIM>::pack(const InOutOctreeType& octree,
+                                         void* buffer)
+{
+  using BlockIndex = typename InOutOctreeType::BlockIndex;
+
+  SLIC_ASSERT(buffer != nullptr);
+  SLIC_ASSERT(reinterpret_cast<std::uintptr_t>(buffer) % 8 == 0);
+
+  const Header header = makeHeader(octree);
+  const Layout layout(header);
+
+  char* base = static_cast<char*>(buffer);
+  *reinterpret_cast<Header*>(base) = header;
+
+  auto* levelOffsets =
+    reinterpret_cast<std::int64_t*>(base + layout.levelOffsets);
+  auto* deltas = reinterpret_cast<double*>(base + layout.deltas);
+  auto* invDeltas = reinterpret_cast<double*>(base + layout.invDeltas);
+  auto* blockPts = reinterpret_cast<CoordType*>(base + layout.blockPts);
+  auto* blockData = reinterpret_cast<std::int32_t*>(base + layout.blockData);
+  auto* grayOffsets =
+    reinterpret_cast<std::int64_t*>(base + layout.grayOffsets);
+  auto* grayCells = reinterpret_cast<CellIndex*>(base + layout.grayCells);
+  auto* vertices = reinterpret_cast<double*>(base + layout.vertices);
+  auto* cellVertices =
+    reinterpret_cast<VertexIndex*>(base + layout.cellVertices);
+
+  // Copy the blocks of each level, sorted by grid point, and the cells
+  // of the gray leaf blocks in a single CSR relation over all levels
+  std::vector<std::pair<GridPt, InOutBlockData>> levelBlocks;
+
+  std::int64_t blockIdx = 0;
+  std::int64_t grayIdx = 0;
+  std::int64_t cellRefIdx = 0;
+  grayOffsets[0] = 0;
+
+  for(int lev = 0; lev < header.numLevels; ++lev)
+  {
+    levelOffsets[lev] = blockIdx;
+
+    const auto& spacing = octree.spacingAtLevel(lev);
+    for(int i = 0; i < DIM; ++i)
+    {
+      deltas[DIM * lev + i] = spacing[i];
+      invDeltas[DIM * lev + i] = octree.m_invDeltaLevelMap[lev][i];
+    }
+
+    const auto& levelLeafMap = octree.getOctreeLevel(lev);
+    levelBlocks.clear();
+    auto itEnd = levelLeafMap.end();
+    for(auto it = levelLeafMap.begin(); it != itEnd; ++it)
+    {
+      levelBlocks.emplace_back(it.pt(), *it);
+    }
+
+    std::sort(levelBlocks.begin(),
+              levelBlocks.end(),
+              [](const std::pair<GridPt, InOutBlockData>& lhs,
+                 const std::pair<GridPt, InOutBlockData>& rhs) {
+                return lessThan(lhs.first.data(), rhs.first);
+              });
+
+    for(const auto& blk : levelBlocks)
+    {
+      const GridPt& pt = blk.first;
+      const InOutBlockData& data = blk.second;
+
+      std::copy(pt.data(), pt.data() + DIM, blockPts + DIM * blockIdx);
+
+      if(!data.isLeaf())
+      {
+        blockData[blockIdx] = INTERNAL_BLOCK;
+      }
+      else
+      {
+        switch(data.color())
+        {
+        case InOutBlockData::Black:
+          blockData[blockIdx] = BLACK_LEAF;
+          break;
+        case InOutBlockData::White:
+          blockData[blockIdx] = WHITE_LEAF;
+          break;
+        case InOutBlockData::Gray:
+        {
+          auto cells = octree.leafCells(BlockIndex(pt, lev), data);
+          for(int i = 0; i < cells.size(); ++i)
+          {
+            grayCells[cellRefIdx++] = cells[i];
+          }
+          grayOffsets[grayIdx + 1] = cellRefIdx;
+          blockData[blockIdx] = static_cast<std::int32_t>(grayIdx++);
+        }
+        break;
+        case InOutBlockData::Undetermined:
+          SLIC_ERROR("All leaf blocks must have a color before packing");
+          break;
+        }
+      }
+
+      ++blockIdx;
+    }
+  }
+  levelOffsets[header.numLevels] = blockIdx;
+
+  SLIC_ASSERT(blockIdx == header.numBlocks);
+  SLIC_ASSERT(grayIdx == header.numGrayLeaves);
+  SLIC_ASSERT(cellRefIdx == header.numCellRefs);
+
+  // Copy the surface mesh
+  const auto& mesh = octree.m_meshWrapper;
+  for(IndexType v = 0; v < header.numVertices; ++v)
+  {
+    const SpacePt& pos = mesh.vertexPosition(v);
+    std::copy(pos.data(), pos.data() + DIM, vertices + DIM * v);
+  }
+  for(IndexType c = 0; c < header.numCells; ++c)
+  {
+    const auto verts = mesh.cellVertexIndices(c);
+    for(int i = 0; i < NUM_CELL_VERTS; ++i)
+    {
+      cellVertices[NUM_CELL_VERTS * c + i] = verts[i];
+    }
+  }
+
+  return layout.totalSize;
+}
+
+template <int DIM>
+PackedInOutOctree<DIM>::PackedInOutOctree(const void* buffer)
+  : m_header(static_cast<const Header*>(buffer))
+{
+  SLIC_ASSERT(buffer != nullptr);
+  SLIC_ASSERT(reinterpret_cast<std::uintptr_t>(buffer) % 8 == 0);
+  SLIC_ERROR_IF(m_header->dimension != DIM,
+                "Packed InOutOctree has dimension " << m_header->dimension
+                                                    << ", expected " << DIM);
+
+  m_boundingBox = GeometricBoundingBox(SpacePt(m_header->bbMin, DIM),
+                                       SpacePt(m_header->bbMax, DIM));
+
+  const Layout layout(*m_header);
+  const char* base = static_cast<const char*>(buffer);
+
+  m_levelOffsets =
+    reinterpret_cast<const std::int64_t*>(base + layout.levelOffsets);
+  m_deltas = reinterpret_cast<const double*>(base + layout.deltas);
+  m_invDeltas = reinterpret_cast<const double*>(base + layout.invDeltas);
+  m_blockPts = reinterpret_cast<const CoordType*>(base + layout.blockPts);
+  m_blockData = reinterpret_cast<const std::int32_t*>(base + layout.blockData);
+  m_grayOffsets =
+    reinterpret_cast<const std::int64_t*>(base + layout.grayOffsets);
+  m_grayCells = reinterpret_cast<const CellIndex*>(base + layout.grayCells);
+  m_vertices = reinterpret_cast<const double*>(base + layout.vertices);
+  m_cellVertices =
+    reinterpret_cast<const VertexIndex*>(base + layout.cellVertices);
+}
+
+template <int DIM>
+bool PackedInOutOctree<DIM>::within(const SpacePt& pt) const
+{
+  if(!m_boundingBox.contains(pt))
+  {
+    return false;
+  }
+
+  // Perform binary search on levels to find the leaf block containing the point
+  int minLev = 0;
+  int maxLev = numLevels() - 1;
+  int lev = maxLev >> 1;
+
+  while(minLev <= maxLev)
+  {
+    const GridPt gridPt = findGridCellAtLevel(pt, lev);
+    const std::int64_t blk = findBlock(gridPt, lev);
+
+    if(blk == NO_BLOCK)
+    {
+      // Block must be in coarser levels -- update upper bound
+      maxLev = lev - 1;
+    }
+    else if(m_blockData[blk] == INTERNAL_BLOCK)
+    {
+      // Block must be in deeper levels -- update lower bound
+      minLev = lev + 1;
+    }
+    else
+    {
+      const std::int32_t data = m_blockData[blk];
+      switch(data)
+      {
+      case BLACK_LEAF:
+        return true;
+      case WHITE_LEAF:
+        return false;
+      default:
+      {
+        const std::int64_t first = m_grayOffsets[data];
+        const std::int64_t last = m_grayOffsets[data + 1];
+        return withinGrayLeaf(pt,
+                              blockBoundingBox(gridPt, lev),
+                              CellIndexSpan(m_grayCells + first, last - first),
+                              *this,
+                              m_header->boundingBoxScaleFactor);
+      }
+      }
+    }
+
+    lev = (maxLev + minLev) >> 1;
+  }
+
+  SLIC_ASSERT_MSG(false,
+                  "Point " << pt << " not found in a leaf block of the octree");
+
+  return false;
+}
+
+template <int DIM>
+typename PackedInOutOctree<DIM>::SpaceCell
+PackedInOutOctree<DIM>::cellPositions(CellIndex idx) const
+{
+  const VertexIndex* verts = cellVertexIndices(idx);
+
+  SpaceCell cell;
+  for(int i = 0; i < NUM_CELL_VERTS; ++i)
+  {
+    cell[i] = vertexPosition(verts[i]);
+  }
+  return cell;
+}
+
+template <int DIM>
+typename PackedInOutOctree<DIM>::SpaceVector
+PackedInOutOctree<DIM>::surfaceNormal(CellIndex cidx,
+                                      double segmentParameter,
+                                      const CellIndexSpan& otherCells) const
+{
+  auto incidentInVertex = [this](CellIndex idx, VertexIndex vIdx) {
+    const VertexIndex* verts = cellVertexIndices(idx);
+    return std::find(verts, verts + NUM_CELL_VERTS, vIdx) !=
+      verts + NUM_CELL_VERTS;
+  };
+
+  SpaceVector vec = cellPositions(cidx).normal();
+
+  // Average the normals of the incident segments when the point is
+  // at the first or second vertex of the segment
+  int vertOffset = -1;
+  if(axom::utilities::isNearlyEqual(segmentParameter, 0.))
+  {
+    vertOffset = 0;
+  }
+  else if(axom::utilities::isNearlyEqual(segmentParameter, 1.))
+  {
+    vertOffset = 1;
+  }
+
+  if(vertOffset >= 0)
+  {
+    vec = vec.unitVector();
+    const VertexIndex vidx = cellVertexIndices(cidx)[vertOffset];
+    for(auto idx : otherCells)
+    {
+      if(idx != cidx && incidentInVertex(idx, vidx))
+      {
+        vec += cellPositions(idx).normal().unitVector();
+      }
+    }
+  }
+
+  return vec.unitVector();
+}
+
+}  // namespace detail
+}  // namespace quest
+}  // namespace axom
+
+#endif  // AXOM_QUEST_INOUT_OCTREE_PACKED__HPP_
@@ -0,0 +1,136 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * \file hex_oct_classification.hpp
+ *
+ * \brief Classification of hexahedral elements against the octahedra of a
+ *  revolved shape, which lets IntersectionShaper skip unnecessary clipping
+ */
+
+#ifndef AXOM_QUEST_HEX_OCT_CLASSIFICATION__HPP_
+#define AXOM_QUEST_HEX_OCT_CLASSIFICATION__HPP_
+
+#include "axom/config.hpp"
+#include "axom/core/Macros.hpp"
+
+#include "axom/primal/geometry/Octahedron.hpp"
+#include "axom/primal/geometry/Point.hpp"
+#include "axom/primal/geometry/Polyhedron.hpp"
+#include "axom/primal/geometry/Vector.hpp"
+
+namespace axom
+{
+namespace quest
+{
+namespace shaping
+{
+/// Classification of a hexahedral element before clipping
+enum HexClassification
+{
+  HEX_OUTSIDE = 0,
+  HEX_INSIDE = 1,
+  HEX_BOUNDARY = 2
+};
+
+/**
+ * \brief Classifies a hexahedron Polyhedron with respect to an Octahedron
+ *        without clipping them.
+ *        The hexahedron vertices are compared against the planes of the
+ *        octahedron faces, oriented outward:
+ *          - inside if they are on the inner side of all faces,
+ *            i.e., in the kernel of the octahedron
+ *          - outside if they are on the outer side of a face whose
+ *            plane does not cut the octahedron
+ *
+ * \param hex [in] The hexahedron Polyhedron to classify
+ * \param oct [in] The Octahedron
+ * \return HEX_INSIDE, HEX_OUTSIDE, or HEX_BOUNDARY when the pair
+ *         needs to be clipped
+ *
+ * \note Assumes given Polyhedron has 8 points
+ * \note The classification is conservative: octahedra with degenerate
+ *       faces, e.g., with duplicate vertices, are always HEX_BOUNDARY
+ */
+AXOM_HOST_DEVICE
+inline HexClassification classifyHexInOct(
+  const primal::Polyhedron<double, 3>& hex,
+  const primal::Octahedron<double, 3>& oct)
+{
+  using OctahedronType = primal::Octahedron<double, 3>;
+  using Point3D = primal::Point<double, 3>;
+  using Vector3D = primal::Vector<double, 3>;
+
+  constexpr int NUM_OCT_FACES = 8;
+  constexpr int NUM_HEX_VERTS = 8;
+  constexpr double EPS = 1.e-10;
+
+  // Octahedron faces with consistent winding (see primal::clip())
+  const int faces[NUM_OCT_FACES][3] = {{0, 1, 5},
+                                       {0, 5, 4},
+                                       {0, 4, 2},
+                                       {0, 2, 1},
+                                       {3, 1, 2},
+                                       {3, 2, 4},
+                                       {3, 4, 5},
+                                       {3, 5, 1}};
+
+  // Unit face normals, flipped to point outward if the volume is negative
+  Vector3D normals[NUM_OCT_FACES];
+  double volume = 0.;
+  for(int f = 0; f < NUM_OCT_FACES; f++)
+  {
+    const Point3D& a = oct[faces[f][0]];
+    normals[f] = Vector3D::cross_product(Vector3D(a, oct[faces[f][1]]),
+                                         Vector3D(a, oct[faces[f][2]]));
+    volume += normals[f].dot(Vector3D(oct[0], a));
+
+    const double area = normals[f].norm();
+    if(area < EPS)
+    {
+      return HEX_BOUNDARY;
+    }
+    normals[f] /= area;
+  }
+  if(volume < 0)
+  {
+    for(int f = 0; f < NUM_OCT_FACES; f++)
+    {
+      normals[f] *= -1.;
+    }
+  }
+
+  bool inside = true;
+  for(int f = 0; f < NUM_OCT_FACES; f++)
+  {
+    const Point3D& a = oct[faces[f][0]];
+
+    bool separates = true;
+    for(int i = 0; i < NUM_HEX_VERTS; i++)
+    {
+      const double dist = normals[f].dot(Vector3D(a, hex[i]));
+      inside = inside && dist <= EPS;
+      separates = separates && dist >= -EPS;
+    }
+
+    // Face plane separates the pair only if the octahedron is behind it
+    for(int i = 0; separates && i < OctahedronType::NUM_OCT_VERTS; i++)
+    {
+      separates = normals[f].dot(Vector3D(a, oct[i])) <= EPS;
+    }
+    if(separates)
+    {
+      return HEX_OUTSIDE;
+    }
+  }
+
+  return inside ? HEX_INSIDE : HEX_BOUNDARY;
+}
+
+}  // end namespace shaping
+}  // end namespace quest
+}  // end namespace axom
+
+#endif  // AXOM_QUEST_HEX_OCT_CLASSIFICATION__HPP_
@@ -150,6 +150,7 @@ int main(int argc, char** argv)
   int nQueryPoints = 100000;
   int segmentsPerKnotSpan = 25;
   double weldThresh = 1E-9;
+  bool useSharedMemory = false;
 
   axom::CLI::App app {"Driver for containment query using inout API"};
   app.add_option("-i,--input", fileName)
@@ -172,6 +173,10 @@ int main(int argc, char** argv)
       "(2D only) Number of linear segments to generate per NURBS knot span")
     ->capture_default_str()
     ->check(axom::CLI::PositiveNumber);
+  app.add_flag("-s,--shared-memory", useSharedMemory)
+    ->description(
+      "Share the spatial index among the ranks of each node (requires MPI-3)")
+    ->capture_default_str();
 
   app.get_formatter()->column_width(50);
 
@@ -225,6 +230,12 @@ int main(int argc, char** argv)
   {
     cleanAbort();
   }
+
+  rc = quest::inout_use_shared_memory(useSharedMemory);
+  if(rc != quest::QUEST_INOUT_SUCCESS)
+  {
+    cleanAbort();
+  }
   // _quest_inout_interface_parameters_end
 
   // -- Initialize quest_inout
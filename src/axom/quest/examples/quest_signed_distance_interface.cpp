@@ -83,6 +83,7 @@ struct Arguments
   bool use_shared {false};
   bool use_batched_query {false};
   bool ignore_signs {false};
+  double band_width {-1.};
   quest::SignedDistExec exec_space {quest::SignedDistExec::CPU};
 
   void parse(int argc, char** argv, axom::CLI::App& app)
@@ -136,6 +137,13 @@ struct Arguments
                 "distance query should ignore signs")
       ->capture_default_str();
 
+    app
+      .add_option("--band-width",
+                  this->band_width,
+                  "limits the exact distances to a band of the given width "
+                  "around the surface (default: no band)")
+      ->check(axom::CLI::NonNegativeNumber);
+
     std::string pol_info =
       "Sets execution space of the SignedDistance query.\n";
     pol_info += "Set to \'seq\' to use sequential execution policy.";
@@ -231,6 +239,10 @@ int main(int argc, char** argv)
   quest::signed_distance_set_closed_surface(args.is_water_tight);
   quest::signed_distance_set_compute_signs(!args.ignore_signs);
   quest::signed_distance_set_execution_space(args.exec_space);
+  if(args.band_width >= 0.)
+  {
+    quest::signed_distance_set_band_width(args.band_width);
+  }
   // _quest_distance_interface_init_start
   int rc = quest::signed_distance_init(args.fileName, global_comm);
   // _quest_distance_interface_init_end
@@ -108,6 +108,14 @@ int QUEST_inout_set_segments_per_knot_span(int segmentsPerKnotSpan)
   // splicer end function.inout_set_segments_per_knot_span
 }
 
+int QUEST_inout_use_shared_memory(bool status)
+{
+  // splicer begin function.inout_use_shared_memory
+  int SHC_rv = axom::quest::inout_use_shared_memory(status);
+  return SHC_rv;
+  // splicer end function.inout_use_shared_memory
+}
+
 bool QUEST_inout_evaluate_0(double x, double y)
 {
   // splicer begin function.inout_evaluate_0
@@ -255,6 +263,13 @@ void QUEST_signed_distance_set_allocator(int allocatorID)
   // splicer end function.signed_distance_set_allocator
 }
 
+void QUEST_signed_distance_set_band_width(double bandWidth)
+{
+  // splicer begin function.signed_distance_set_band_width
+  axom::quest::signed_distance_set_band_width(bandWidth);
+  // splicer end function.signed_distance_set_band_width
+}
+
 void QUEST_signed_distance_set_verbose(bool status)
 {
   // splicer begin function.signed_distance_set_verbose
@@ -68,6 +68,8 @@ int QUEST_inout_set_vertex_weld_threshold(double thresh);
 
 int QUEST_inout_set_segments_per_knot_span(int segmentsPerKnotSpan);
 
+int QUEST_inout_use_shared_memory(bool status);
+
 bool QUEST_inout_evaluate_0(double x, double y);
 
 bool QUEST_inout_evaluate_1(double x, double y, double z);
@@ -112,6 +114,8 @@ void QUEST_signed_distance_set_compute_signs(bool computeSign);
 
 void QUEST_signed_distance_set_allocator(int allocatorID);
 
+void QUEST_signed_distance_set_band_width(double bandWidth);
+
 void QUEST_signed_distance_set_verbose(bool status);
 
 void QUEST_signed_distance_use_shared_memory(bool status);
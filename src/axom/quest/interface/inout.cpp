@@ -26,6 +26,7 @@ struct InOutParameters
   int m_dimension {3};
   int m_segmentsPerKnotSpan {25};  /// Used when linearizing curves
   double m_vertexWeldThreshold {1E-9};
+  bool m_useSharedMemory {false};
 
   void setDefault() { *this = InOutParameters {}; }
 };
@@ -44,6 +45,7 @@ struct InOutHelper
   using GeometricBoundingBox = primal::BoundingBox<double, DIM>;
   using SpacePt = primal::Point<double, DIM>;
   using SpaceVec = primal::Vector<double, DIM>;
+  using PackedOctree = detail::PackedInOutOctree<DIM>;
 
   static_assert(DIM == 2 || DIM == 3, "InOutHelper only supports 2D and 3D");
 
@@ -58,7 +60,10 @@ struct InOutHelper
     void setDefault() { *this = State {}; }
   };
 
-  InOutHelper() : m_surfaceMesh(nullptr), m_inoutTree(nullptr)
+  InOutHelper()
+    : m_surfaceMesh(nullptr)
+    , m_inoutTree(nullptr)
+    , m_packedTree(nullptr)
   {
     m_params.setDefault();
     m_state.setDefault();
@@ -85,6 +90,12 @@ struct InOutHelper
     m_params.m_segmentsPerKnotSpan = numSegments;
   }
 
+  /// Sets whether the spatial index is shared among the ranks of each node
+  void setUseSharedMemory(bool useSharedMemory)
+  {
+    m_params.m_useSharedMemory = useSharedMemory;
+  }
+
   /*!
    * Initializes the InOut query from an stl file
    *
@@ -95,34 +106,37 @@ struct InOutHelper
     mint::Mesh* mesh = nullptr;
     m_params.m_dimension = getDimension();
 
+    // In shared memory mode, only the first rank on each node loads the mesh
+    bool shouldReadMesh = true;
+    MPI_Comm readComm = comm;
+#if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+    if(m_params.m_useSharedMemory)
+    {
+      createNodeCommunicators(comm);
+      shouldReadMesh = isNodeLeader();
+      readComm = m_interNodeComm;
+    }
+#endif
+
     // load the mesh
-    int rc = QUEST_INOUT_FAILED;
+    int rc = QUEST_INOUT_SUCCESS;
+    if(shouldReadMesh)
+    {
+      rc = readMesh(file, mesh, readComm);
+    }
 
-    switch(DIM)
+#if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+    if(m_params.m_useSharedMemory)
     {
-    case 2:
-#ifdef AXOM_USE_C2C
-      rc = internal::read_c2c_mesh(file,
-                                   m_params.m_segmentsPerKnotSpan,
-                                   m_params.m_vertexWeldThreshold,
-                                   mesh,
-                                   comm);
-#else
-      SLIC_WARNING(fmt::format(
-        "Cannot read contour file: C2C not enabled in this configuration.",
-        file));
-#endif
-      break;
-    case 3:
-      rc = internal::read_stl_mesh(file, mesh, comm);
-      break;
-    default:  // no-op
-      break;
+      rc = reduceStatus(rc, comm);
     }
+#endif
 
     if(rc != QUEST_INOUT_SUCCESS)
     {
       SLIC_WARNING("reading mesh from [" << file << "] failed!");
+      delete mesh;
+      freeSharedResources();
       return QUEST_INOUT_FAILED;
     }
     m_state.m_should_delete_mesh = true;
@@ -148,58 +162,22 @@ struct InOutHelper
     internal::ScopedLogLevelChanger logLevelChanger(
       m_params.m_verbose ? slic::message::Debug : slic::message::Warning);
 
-    // handle mesh pointer, with some error checking
-    if(mesh == nullptr)
+    int rc = QUEST_INOUT_FAILED;
+#if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+    if(m_params.m_useSharedMemory)
     {
-      SLIC_WARNING("Cannot initialize: mesh was NULL");
-      return QUEST_INOUT_FAILED;
+      rc = initializeShared(mesh, comm);
     }
-    m_surfaceMesh = mesh;
-
-    if(m_surfaceMesh->getDimension() != getDimension())
+    else
+#endif
     {
-      SLIC_WARNING("Incorrect dimensionality for mesh."
-                   << "Expected " << getDimension() << ", "
-                   << "but got " << m_surfaceMesh->getDimension());
-      return QUEST_INOUT_FAILED;
+      rc = generateIndex(mesh);
     }
 
-    // compute the mesh bounding box and center of mass
-    m_meshBoundingBox.clear();
-    m_meshCenterOfMass = SpacePt::zero();
-    SpacePt pt;
-
-    const int numMeshNodes = m_surfaceMesh->getNumberOfNodes();
-    if(numMeshNodes > 0)
-    {
-      for(int i = 0; i < numMeshNodes; ++i)
-      {
-        m_surfaceMesh->getNode(i, pt.data());
-
-        m_meshBoundingBox.addPoint(pt);
-        m_meshCenterOfMass.array() += pt.array();
-      }
-
-      m_meshCenterOfMass.array() /= numMeshNodes;
-      SLIC_ASSERT(m_meshBoundingBox.isValid());
-    }
-
-    // initialize InOutOctree
-    m_inoutTree = new InOutOctree<DIM>(m_meshBoundingBox, m_surfaceMesh);
-
-    // set params
-    m_inoutTree->setVertexWeldThreshold(m_params.m_vertexWeldThreshold);
-
-    // initialize the spatial index
-    m_inoutTree->generateIndex();
-
-    // Update the mesh parameter since the InOutOctree modifies the mesh
-    mesh = m_surfaceMesh;
-
     // set the initialized flag to true
-    m_state.m_initialized = true;
+    m_state.m_initialized = (rc == QUEST_INOUT_SUCCESS);
 
-    return QUEST_INOUT_SUCCESS;
+    return rc;
   }
 
   /*!
@@ -216,6 +194,13 @@ struct InOutHelper
       m_inoutTree = nullptr;
     }
 
+    if(m_packedTree != nullptr)
+    {
+      delete(m_packedTree);
+      m_packedTree = nullptr;
+    }
+    freeSharedResources();
+
     // deal with mesh
     if(m_state.m_should_delete_mesh)
     {
@@ -251,7 +236,7 @@ struct InOutHelper
   /// Predicate to determine if a point is inside the surface
   bool within(double x, double y, double z = 0.) const
   {
-    return m_inoutTree->within(SpacePt {x, y, z});
+    return within(SpacePt {x, y, z});
   }
 
   /*!
@@ -272,7 +257,7 @@ struct InOutHelper
 #endif
       for(int i = 0; i < npoints; ++i)
       {
-        const bool ins = m_inoutTree->within(SpacePt {x[i], y[i]});
+        const bool ins = within(SpacePt {x[i], y[i]});
         res[i] = ins ? 1 : 0;
       }
     }
@@ -283,7 +268,7 @@ struct InOutHelper
 #endif
       for(int i = 0; i < npoints; ++i)
       {
-        const bool ins = m_inoutTree->within(SpacePt {x[i], y[i], z[i]});
+        const bool ins = within(SpacePt {x[i], y[i], z[i]});
         res[i] = ins ? 1 : 0;
       }
     }
@@ -291,12 +276,248 @@ struct InOutHelper
     return QUEST_INOUT_SUCCESS;
   }
 
+private:
+  /// Dispatches the containment query to the local or the shared index
+  bool within(const SpacePt& pt) const
+  {
+    return (m_packedTree != nullptr) ? m_packedTree->within(pt)
+                                     : m_inoutTree->within(pt);
+  }
+
+  /// Reads the surface mesh from \a file, collectively over \a comm
+  int readMesh(const std::string& file, mint::Mesh*& mesh, MPI_Comm comm)
+  {
+    int rc = QUEST_INOUT_FAILED;
+
+    switch(DIM)
+    {
+    case 2:
+#ifdef AXOM_USE_C2C
+      rc = internal::read_c2c_mesh(file,
+                                   m_params.m_segmentsPerKnotSpan,
+                                   m_params.m_vertexWeldThreshold,
+                                   mesh,
+                                   comm);
+#else
+      AXOM_UNUSED_VAR(comm);
+      SLIC_WARNING(fmt::format(
+        "Cannot read contour file: C2C not enabled in this configuration.",
+        file));
+#endif
+      break;
+    case 3:
+      rc = internal::read_stl_mesh(file, mesh, comm);
+      break;
+    default:  // no-op
+      break;
+    }
+
+    return rc;
+  }
+
+  /*!
+   * Computes the bounding box and center of mass of the mesh
+   * and generates the InOutOctree over it
+   */
+  int generateIndex(mint::Mesh*& mesh)
+  {
+    // handle mesh pointer, with some error checking
+    if(mesh == nullptr)
+    {
+      SLIC_WARNING("Cannot initialize: mesh was NULL");
+      return QUEST_INOUT_FAILED;
+    }
+    m_surfaceMesh = mesh;
+
+    if(m_surfaceMesh->getDimension() != getDimension())
+    {
+      SLIC_WARNING("Incorrect dimensionality for mesh."
+                   << "Expected " << getDimension() << ", "
+                   << "but got " << m_surfaceMesh->getDimension());
+      return QUEST_INOUT_FAILED;
+    }
+
+    // compute the mesh bounding box and center of mass
+    m_meshBoundingBox.clear();
+    m_meshCenterOfMass = SpacePt::zero();
+    SpacePt pt;
+
+    const int numMeshNodes = m_surfaceMesh->getNumberOfNodes();
+    if(numMeshNodes > 0)
+    {
+      for(int i = 0; i < numMeshNodes; ++i)
+      {
+        m_surfaceMesh->getNode(i, pt.data());
+
+        m_meshBoundingBox.addPoint(pt);
+        m_meshCenterOfMass.array() += pt.array();
+      }
+
+      m_meshCenterOfMass.array() /= numMeshNodes;
+      SLIC_ASSERT(m_meshBoundingBox.isValid());
+    }
+
+    // initialize InOutOctree
+    m_inoutTree = new InOutOctree<DIM>(m_meshBoundingBox, m_surfaceMesh);
+
+    // set params
+    m_inoutTree->setVertexWeldThreshold(m_params.m_vertexWeldThreshold);
+
+    // initialize the spatial index
+    m_inoutTree->generateIndex();
+
+    // Update the mesh parameter since the InOutOctree modifies the mesh
+    mesh = m_surfaceMesh;
+
+    return QUEST_INOUT_SUCCESS;
+  }
+
+#if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+  /// Predicate to check if this rank builds the shared index for its node
+  bool isNodeLeader() const { return m_nodeRank == 0; }
+
+  /// Creates the intra-node and inter-node communicators, if necessary
+  void createNodeCommunicators(MPI_Comm comm)
+  {
+    if(m_intraNodeComm != MPI_COMM_NULL)
+    {
+      return;
+    }
+
+    int global_rank = -1;
+    int intercom_rank = -1;
+    internal::create_communicators(comm,
+                                   m_intraNodeComm,
+                                   m_interNodeComm,
+                                   global_rank,
+                                   m_nodeRank,
+                                   intercom_rank);
+  }
+
+  /// Returns QUEST_INOUT_FAILED on all ranks if it failed on any rank
+  static int reduceStatus(int rc, MPI_Comm comm)
+  {
+    int failed = (rc != QUEST_INOUT_SUCCESS) ? 1 : 0;
+    int anyFailed = 0;
+    MPI_Allreduce(&failed, &anyFailed, 1, MPI_INT, MPI_MAX, comm);
+    return (anyFailed != 0) ? QUEST_INOUT_FAILED : QUEST_INOUT_SUCCESS;
+  }
+
+  /*!
+   * Initializes the InOut query using a single spatial index per node
+   *
+   * The first rank on each node generates the InOutOctree, packs it into
+   * an MPI-3 shared window and discards its local copy. All ranks on the
+   * node then query the packed octree in the shared window.
+   */
+  int initializeShared(mint::Mesh*& mesh, MPI_Comm comm)
+  {
+    constexpr int ROOT_RANK = 0;
+
+    createNodeCommunicators(comm);
+
+    // STEP 1: generate the octree on the first rank of each node
+    int rc = QUEST_INOUT_SUCCESS;
+    MPI_Aint numBytes = 0;
+    if(isNodeLeader())
+    {
+      rc = generateIndex(mesh);
+      if(rc == QUEST_INOUT_SUCCESS)
+      {
+        numBytes =
+          static_cast<MPI_Aint>(PackedOctree::packedSize(*m_inoutTree));
+      }
+    }
+
+    rc = reduceStatus(rc, comm);
+    if(rc != QUEST_INOUT_SUCCESS)
+    {
+      delete m_inoutTree;
+      m_inoutTree = nullptr;
+      freeSharedResources();
+      return QUEST_INOUT_FAILED;
+    }
+
+    // STEP 2: pack the octree into a shared window owned by the first rank
+    int disp = sizeof(unsigned char);
+    unsigned char* buffer = nullptr;
+    MPI_Win_allocate_shared(numBytes,
+                            disp,
+                            MPI_INFO_NULL,
+                            m_intraNodeComm,
+                            &buffer,
+                            &m_window);
+    MPI_Win_shared_query(m_window, ROOT_RANK, &numBytes, &disp, &buffer);
+
+    if(isNodeLeader())
+    {
+      PackedOctree::pack(*m_inoutTree, buffer);
+
+      // The local octree and mesh are no longer needed
+      delete m_inoutTree;
+      m_inoutTree = nullptr;
+
+      if(m_state.m_should_delete_mesh)
+      {
+        delete m_surfaceMesh;
+        m_surfaceMesh = nullptr;
+        mesh = nullptr;
+      }
+
+      SLIC_INFO(fmt::format(
+        "Packed InOutOctree into a {} byte shared memory window",
+        static_cast<std::int64_t>(numBytes)));
+    }
+    MPI_Barrier(m_intraNodeComm);
+
+    m_packedTree = new PackedOctree(buffer);
+
+    // STEP 3: share the mesh bounding box and center of mass within the node
+    double meshInfo[3 * DIM];
+    if(isNodeLeader())
+    {
+      m_meshBoundingBox.getMin().array().to_array(meshInfo);
+      m_meshBoundingBox.getMax().array().to_array(meshInfo + DIM);
+      m_meshCenterOfMass.array().to_array(meshInfo + 2 * DIM);
+    }
+    MPI_Bcast(meshInfo, 3 * DIM, MPI_DOUBLE, ROOT_RANK, m_intraNodeComm);
+
+    if(!isNodeLeader())
+    {
+      m_meshBoundingBox = GeometricBoundingBox(SpacePt(meshInfo),
+                                               SpacePt(meshInfo + DIM));
+      m_meshCenterOfMass = SpacePt(meshInfo + 2 * DIM);
+    }
+
+    return QUEST_INOUT_SUCCESS;
+  }
+#endif
+
+  /// Frees the shared memory window and communicators, if any
+  void freeSharedResources()
+  {
+#if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+    internal::mpi_win_free(&m_window);
+    internal::mpi_comm_free(&m_interNodeComm);
+    internal::mpi_comm_free(&m_intraNodeComm);
+    m_nodeRank = -1;
+#endif
+  }
+
 private:
   mint::Mesh* m_surfaceMesh;
   InOutOctree<DIM>* m_inoutTree;
+  PackedOctree* m_packedTree;
   GeometricBoundingBox m_meshBoundingBox;
   SpacePt m_meshCenterOfMass;
 
+#if defined(AXOM_USE_MPI) && defined(AXOM_USE_MPI3)
+  MPI_Comm m_intraNodeComm {MPI_COMM_NULL};
+  MPI_Comm m_interNodeComm {MPI_COMM_NULL};
+  MPI_Win m_window {MPI_WIN_NULL};
+  int m_nodeRank {-1};
+#endif
+
   InOutParameters m_params;
   State m_state;
 };
@@ -338,6 +559,7 @@ int inout_init(const std::string& file, MPI_Comm comm)
     s_inoutHelper2D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper2D.setSegmentsPerKnotSpan(s_inoutParams.m_segmentsPerKnotSpan);
     s_inoutHelper2D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper2D.setUseSharedMemory(s_inoutParams.m_useSharedMemory);
 
     rc = s_inoutHelper2D.initialize(file, comm);
     break;
@@ -345,6 +567,7 @@ int inout_init(const std::string& file, MPI_Comm comm)
   case 3:
     s_inoutHelper3D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper3D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper3D.setUseSharedMemory(s_inoutParams.m_useSharedMemory);
 
     rc = s_inoutHelper3D.initialize(file, comm);
     break;
@@ -375,6 +598,7 @@ int inout_init(mint::Mesh*& mesh, MPI_Comm comm)
     s_inoutHelper2D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper2D.setSegmentsPerKnotSpan(s_inoutParams.m_segmentsPerKnotSpan);
     s_inoutHelper2D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper2D.setUseSharedMemory(s_inoutParams.m_useSharedMemory);
 
     rc = s_inoutHelper2D.initialize(mesh, comm);
     break;
@@ -383,6 +607,7 @@ int inout_init(mint::Mesh*& mesh, MPI_Comm comm)
     s_inoutHelper3D.setVerbose(s_inoutParams.m_verbose);
     s_inoutHelper3D.setSegmentsPerKnotSpan(s_inoutParams.m_segmentsPerKnotSpan);
     s_inoutHelper3D.setVertexWeldThreshold(s_inoutParams.m_vertexWeldThreshold);
+    s_inoutHelper3D.setUseSharedMemory(s_inoutParams.m_useSharedMemory);
 
     rc = s_inoutHelper3D.initialize(mesh, comm);
     break;
@@ -667,5 +892,25 @@ int inout_set_segments_per_knot_span(int segmentsPerKnotSpan)
   return QUEST_INOUT_SUCCESS;
 }
 
+int inout_use_shared_memory(bool status)
+{
+  if(inout_initialized())
+  {
+    SLIC_WARNING("quest inout query must NOT be initialized "
+                 << "prior to calling 'inout_use_shared_memory'");
+
+    return QUEST_INOUT_FAILED;
+  }
+
+#if !defined(AXOM_USE_MPI) || !defined(AXOM_USE_MPI3)
+  SLIC_WARNING_IF(status,
+                  "Enabling shared memory requires MPI-3. Option is ignored!");
+#endif
+
+  s_inoutParams.m_useSharedMemory = status;
+
+  return QUEST_INOUT_SUCCESS;
+}
+
 }  // end namespace quest
 }  // end namespace axom
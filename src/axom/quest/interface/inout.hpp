@@ -251,6 +251,33 @@ int inout_set_vertex_weld_threshold(double thresh);
  */
 int inout_set_segments_per_knot_span(int segmentsPerKnotSpan);
 
+/*!
+ * \brief Sets whether the ranks on each compute node share a single copy
+ *  of the inout query's spatial index
+ *
+ * When enabled, only one rank per compute node reads the surface mesh and
+ * generates the spatial index. The index is then packed into an MPI-3 shared
+ * memory window and the other ranks on the node query it read-only. This
+ * reduces the memory and initialization cost of the query by roughly the
+ * number of ranks per node. Query results are identical to those without
+ * shared memory.
+ *
+ * By default, shared memory is disabled.
+ *
+ * \param status True to enable shared memory, false to disable it
+ * \return Return code is QUEST_INOUT_SUCCESS if successful
+ *  and QUEST_INOUT_FAILED otherwise.
+ * \pre inout_initialized() == false
+ *
+ * \note Requires MPI-3, i.e. Axom configured with AXOM_USE_MPI3.
+ *  Otherwise, the option is ignored.
+ * \note When shared memory is enabled, inout_init() is collective over the
+ *  supplied communicator. When initializing from a pre-loaded mesh, only the
+ *  mesh on the first rank of each node is used and updated; the mesh pointer
+ *  on the other ranks may be null.
+ */
+int inout_use_shared_memory(bool status);
+
 /// @}
 
 }  // end namespace quest
@@ -197,6 +197,32 @@ static PyObject *PY_inout_set_segments_per_knot_span(PyObject *SHROUD_UNUSED(sel
   // splicer end function.inout_set_segments_per_knot_span
 }
 
+static char PY_inout_use_shared_memory__doc__[] = "documentation";
+
+static PyObject *PY_inout_use_shared_memory(PyObject *SHROUD_UNUSED(self),
+                                            PyObject *args,
+                                            PyObject *kwds)
+{
+  // splicer begin function.inout_use_shared_memory
+  bool status;
+  PyObject *SHPy_status;
+  const char *SHT_kwlist[] = {"status", nullptr};
+  PyObject *SHTPy_rv = nullptr;
+
+  if(!PyArg_ParseTupleAndKeywords(args,
+                                  kwds,
+                                  "O!:inout_use_shared_memory",
+                                  const_cast<char **>(SHT_kwlist),
+                                  &PyBool_Type,
+                                  &SHPy_status))
+    return nullptr;
+  status = PyObject_IsTrue(SHPy_status);
+  int SHCXX_rv = axom::quest::inout_use_shared_memory(status);
+  SHTPy_rv = PyInt_FromLong(SHCXX_rv);
+  return (PyObject *)SHTPy_rv;
+  // splicer end function.inout_use_shared_memory
+}
+
 static char PY_inout_evaluate_1__doc__[] = "documentation";
 
 static PyObject *PY_inout_evaluate_1(PyObject *SHROUD_UNUSED(self),
@@ -435,6 +461,27 @@ static PyObject *PY_signed_distance_set_allocator(PyObject *SHROUD_UNUSED(self),
   // splicer end function.signed_distance_set_allocator
 }
 
+static char PY_signed_distance_set_band_width__doc__[] = "documentation";
+
+static PyObject *PY_signed_distance_set_band_width(PyObject *SHROUD_UNUSED(self),
+                                                   PyObject *args,
+                                                   PyObject *kwds)
+{
+  // splicer begin function.signed_distance_set_band_width
+  double bandWidth;
+  const char *SHT_kwlist[] = {"bandWidth", nullptr};
+
+  if(!PyArg_ParseTupleAndKeywords(args,
+                                  kwds,
+                                  "d:signed_distance_set_band_width",
+                                  const_cast<char **>(SHT_kwlist),
+                                  &bandWidth))
+    return nullptr;
+  axom::quest::signed_distance_set_band_width(bandWidth);
+  Py_RETURN_NONE;
+  // splicer end function.signed_distance_set_band_width
+}
+
 static char PY_signed_distance_set_verbose__doc__[] = "documentation";
 
 static PyObject *PY_signed_distance_set_verbose(PyObject *SHROUD_UNUSED(self),
@@ -734,6 +781,10 @@ static PyMethodDef PY_methods[] = {
    (PyCFunction)PY_inout_set_segments_per_knot_span,
    METH_VARARGS | METH_KEYWORDS,
    PY_inout_set_segments_per_knot_span__doc__},
+  {"inout_use_shared_memory",
+   (PyCFunction)PY_inout_use_shared_memory,
+   METH_VARARGS | METH_KEYWORDS,
+   PY_inout_use_shared_memory__doc__},
   {"inout_evaluate",
    (PyCFunction)PY_inout_evaluate_1,
    METH_VARARGS | METH_KEYWORDS,
@@ -766,6 +817,10 @@ static PyMethodDef PY_methods[] = {
    (PyCFunction)PY_signed_distance_set_allocator,
    METH_VARARGS | METH_KEYWORDS,
    PY_signed_distance_set_allocator__doc__},
+  {"signed_distance_set_band_width",
+   (PyCFunction)PY_signed_distance_set_band_width,
+   METH_VARARGS | METH_KEYWORDS,
+   PY_signed_distance_set_band_width__doc__},
   {"signed_distance_set_verbose",
    (PyCFunction)PY_signed_distance_set_verbose,
    METH_VARARGS | METH_KEYWORDS,
@@ -62,6 +62,7 @@ static struct parameters_t
   bool is_closed_surface; /*!< indicates if the input is a closed surface */
   bool use_shared_memory; /*!< use MPI-3 shared memory for the surface mesh */
   bool compute_sign;      /*!< indicates if sign should be computed */
+  double band_width;      /*!< width of the band for the distance queries */
   int allocator_id; /*!< the allocator ID to create BVH with (-1 for default) */
   SignedDistExec exec_space; /*!< indicates the execution space to run in */
 
@@ -74,6 +75,7 @@ static struct parameters_t
     , is_closed_surface(true)
     , use_shared_memory(false)
     , compute_sign(true)
+    , band_width(numerics::floating_point_limits<double>::max())
     , allocator_id(-1)
     , exec_space(SignedDistExec::CPU)
   { }
@@ -203,6 +205,7 @@ int signed_distance_init(const mint::Mesh* m, MPI_Comm comm)
                                    Parameters.is_closed_surface,
                                    Parameters.compute_sign,
                                    allocatorID);
+    s_query->setBandWidth(Parameters.band_width);
     break;
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
   case SignedDistExec::OpenMP:
@@ -214,6 +217,7 @@ int signed_distance_init(const mint::Mesh* m, MPI_Comm comm)
                                           Parameters.is_closed_surface,
                                           Parameters.compute_sign,
                                           allocatorID);
+    s_query_omp->setBandWidth(Parameters.band_width);
     break;
 #endif
 #if defined(AXOM_USE_GPU) && defined(AXOM_USE_RAJA)
@@ -226,6 +230,7 @@ int signed_distance_init(const mint::Mesh* m, MPI_Comm comm)
                                           Parameters.is_closed_surface,
                                           Parameters.compute_sign,
                                           allocatorID);
+    s_query_gpu->setBandWidth(Parameters.band_width);
     break;
 #endif
   default:
@@ -310,6 +315,17 @@ void signed_distance_set_allocator(int allocatorID)
   Parameters.allocator_id = allocatorID;
 }
 
+//------------------------------------------------------------------------------
+void signed_distance_set_band_width(double bandWidth)
+{
+  SLIC_ERROR_IF(
+    signed_distance_initialized(),
+    "signed distance query already initialized; setting option has no effect!");
+  SLIC_ERROR_IF(bandWidth < 0., "band width must be non-negative!");
+
+  Parameters.band_width = bandWidth;
+}
+
 //------------------------------------------------------------------------------
 void signed_distance_set_verbose(bool status)
 {
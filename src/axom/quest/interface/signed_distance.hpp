@@ -197,6 +197,20 @@ void signed_distance_set_compute_signs(bool computeSign);
  */
 void signed_distance_set_allocator(int allocatorID);
 
+/*!
+ * \brief Limits the exact distance computation to a band around the surface.
+ * \param [in] bandWidth the width of the band
+ *
+ * Points farther than \a bandWidth from the surface get a distance of
+ * \a bandWidth with the sign of the point, which is much cheaper to compute.
+ * By default, the queries are not band-limited.
+ *
+ * \note Options must be set before initializing the Signed Distance Query.
+ *
+ * \sa SignedDistance::setBandWidth()
+ */
+void signed_distance_set_band_width(double bandWidth);
+
 /*!
  * \brief Enables/Disables verbose output for the Signed Distance Query.
  * \param [in] status flag indicating whether to enable/disable verbose output
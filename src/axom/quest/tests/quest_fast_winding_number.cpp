@@ -0,0 +1,287 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/mint.hpp"
+#include "axom/primal.hpp"
+
+#include "axom/quest/FastWindingNumber.hpp"
+
+#include "quest_test_utilities.hpp"
+
+// Google Test includes
+#include "gtest/gtest.h"
+
+// C/C++ includes
+#include <cmath>
+#include <vector>
+
+// Aliases
+namespace mint = axom::mint;
+namespace quest = axom::quest;
+namespace primal = axom::primal;
+using UMesh = axom::mint::UnstructuredMesh<mint::SINGLE_SHAPE>;
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr double SPHERE_RADIUS = 0.5;
+constexpr int SPHERE_THETA_RES = 40;
+constexpr int SPHERE_PHI_RES = 40;
+
+/*!
+ * \brief Returns a triangulated sphere with outward normals, skipping every
+ *  \a gapStride-th triangle when \a gapStride is positive.
+ */
+UMesh* make_sphere_mesh(int gapStride = 0)
+{
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+
+  UMesh sphere(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(&sphere,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  UMesh* mesh = new UMesh(3, mint::TRIANGLE);
+  for(axom::IndexType inode = 0; inode < sphere.getNumberOfNodes(); ++inode)
+  {
+    double x[3];
+    sphere.getNode(inode, x);
+    mesh->appendNode(x[0], x[1], x[2]);
+  }
+  for(axom::IndexType icell = 0; icell < sphere.getNumberOfCells(); ++icell)
+  {
+    if(gapStride <= 0 || icell % gapStride != 0)
+    {
+      mesh->appendCell(sphere.getCellNodeIDs(icell));
+    }
+  }
+
+  return mesh;
+}
+
+/// Returns the winding number of a segment of a 2D surface mesh
+double cell_winding_number(const primal::Point<double, 2>& q,
+                           const primal::Point<double, 2>* p)
+{
+  return primal::winding_number(q, primal::Segment<double, 2>(p[0], p[1]));
+}
+
+/// Returns the winding number of a triangle of a 3D surface mesh
+double cell_winding_number(const primal::Point<double, 3>& q,
+                           const primal::Point<double, 3>* p)
+{
+  return primal::winding_number(q, primal::Triangle<double, 3>(p[0], p[1], p[2]));
+}
+
+/// Returns the exact generalized winding number, summed over all cells
+template <typename PointType>
+double brute_force_winding_number(const UMesh* mesh, const PointType& q)
+{
+  double wn = 0.;
+  for(axom::IndexType icell = 0; icell < mesh->getNumberOfCells(); ++icell)
+  {
+    const axom::IndexType* c = mesh->getCellNodeIDs(icell);
+    PointType p[3];
+    for(int i = 0; i < mesh->getNumberOfCellNodes(icell); ++i)
+    {
+      mesh->getNode(c[i], p[i].data());
+    }
+    wn += cell_winding_number(q, p);
+  }
+  return wn;
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, sphere_winding_numbers)
+{
+  using PointType = primal::Point<double, 3>;
+
+  UMesh* surface_mesh = make_sphere_mesh();
+  quest::FastWindingNumber<3> fwn(surface_mesh);
+  EXPECT_EQ(fwn.getNumberOfElements(), surface_mesh->getNumberOfCells());
+
+  // compare against the exact sum, at points near and far from the surface
+  constexpr int NUM_PTS = 500;
+  std::vector<PointType> pts(NUM_PTS);
+  for(auto& pt : pts)
+  {
+    pt = quest::utilities::randomSpacePt<3>(-1.5, 1.5);
+  }
+  std::vector<double> wn(NUM_PTS);
+  fwn.computeWindingNumbers(NUM_PTS, pts.data(), wn.data());
+
+  double maxError = 0.;
+  for(int i = 0; i < NUM_PTS; ++i)
+  {
+    const double exact = brute_force_winding_number(surface_mesh, pts[i]);
+    maxError = std::max(maxError, std::fabs(wn[i] - exact));
+    EXPECT_NEAR(exact, wn[i], 2e-2);
+  }
+  SLIC_INFO("Max winding number error with default accuracy: " << maxError);
+
+  // a higher accuracy parameter gives a smaller error
+  fwn.setAccuracy(4.);
+  EXPECT_DOUBLE_EQ(fwn.getAccuracy(), 4.);
+  fwn.computeWindingNumbers(NUM_PTS, pts.data(), wn.data());
+  double maxAccurateError = 0.;
+  for(int i = 0; i < NUM_PTS; ++i)
+  {
+    const double exact = brute_force_winding_number(surface_mesh, pts[i]);
+    maxAccurateError = std::max(maxAccurateError, std::fabs(wn[i] - exact));
+  }
+  EXPECT_LT(maxAccurateError, maxError);
+
+  // the winding number of a closed surface is one inside and zero outside
+  EXPECT_NEAR(1., fwn.computeWindingNumber(PointType {0., 0., 0.}), 1e-2);
+  EXPECT_NEAR(1., fwn.computeWindingNumber(PointType {0.1, -0.2, 0.3}), 1e-2);
+  EXPECT_NEAR(0., fwn.computeWindingNumber(PointType {2., 2., 2.}), 1e-2);
+
+  delete surface_mesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, sphere_with_gaps_containment)
+{
+  using PointType = primal::Point<double, 3>;
+
+  // remove about five percent of the triangles
+  UMesh* surface_mesh = make_sphere_mesh(20);
+  quest::FastWindingNumber<3> fwn(surface_mesh);
+
+  constexpr int NUM_PTS = 2000;
+  std::vector<PointType> pts;
+  while(static_cast<int>(pts.size()) < NUM_PTS)
+  {
+    const PointType pt = quest::utilities::randomSpacePt<3>(-1., 1.);
+
+    // skip points close to the surface, whose classification is ambiguous
+    const double r = std::sqrt(primal::squared_distance(pt, PointType()));
+    if(std::fabs(r - SPHERE_RADIUS) > 0.1 * SPHERE_RADIUS)
+    {
+      pts.push_back(pt);
+    }
+  }
+
+  bool* contained = new bool[NUM_PTS];
+  fwn.computeContainment(NUM_PTS, pts.data(), contained);
+
+  int numInside = 0;
+  for(int i = 0; i < NUM_PTS; ++i)
+  {
+    const double r = std::sqrt(primal::squared_distance(pts[i], PointType()));
+    const bool expected = r < SPHERE_RADIUS;
+    EXPECT_EQ(expected, contained[i]) << "point " << pts[i] << " at radius " << r;
+    EXPECT_EQ(contained[i], fwn.contains(pts[i]));
+    numInside += expected ? 1 : 0;
+  }
+  EXPECT_GT(numInside, 0);
+
+  delete[] contained;
+  delete surface_mesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, cube_of_quads)
+{
+  using PointType = primal::Point<double, 3>;
+
+  // unit cube with outward oriented quadrilateral faces
+  UMesh surface_mesh(3, mint::QUAD);
+  for(int i = 0; i < 8; ++i)
+  {
+    surface_mesh.appendNode(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+  }
+  const axom::IndexType faces[6][4] = {{0, 2, 3, 1},
+                                       {4, 5, 7, 6},
+                                       {0, 1, 5, 4},
+                                       {2, 6, 7, 3},
+                                       {0, 4, 6, 2},
+                                       {1, 3, 7, 5}};
+  for(const auto& face : faces)
+  {
+    surface_mesh.appendCell(face);
+  }
+
+  quest::FastWindingNumber<3> fwn(&surface_mesh);
+  EXPECT_EQ(fwn.getNumberOfElements(), 12);
+
+  EXPECT_NEAR(1., fwn.computeWindingNumber(PointType {0.5, 0.5, 0.5}), 1e-10);
+  EXPECT_NEAR(1., fwn.computeWindingNumber(PointType {0.1, 0.9, 0.2}), 1e-10);
+  EXPECT_NEAR(0., fwn.computeWindingNumber(PointType {1.5, 0.5, 0.5}), 1e-10);
+  EXPECT_TRUE(fwn.contains(PointType {0.25, 0.75, 0.5}));
+  EXPECT_FALSE(fwn.contains(PointType {-0.25, 0.75, 0.5}));
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_fast_winding_number, circle_2d)
+{
+  using PointType = primal::Point<double, 2>;
+
+  constexpr double RADIUS = 1.;
+  constexpr int NUM_SEGMENTS = 400;
+  mint::Mesh* closed_circle =
+    quest::utilities::make_circle_mesh_2d(RADIUS, NUM_SEGMENTS);
+
+  // circle with a gap of ten segments
+  UMesh open_circle(2, mint::SEGMENT);
+  for(int i = 0; i < NUM_SEGMENTS; ++i)
+  {
+    double x[2];
+    closed_circle->getNode(i, x);
+    open_circle.appendNode(x[0], x[1]);
+  }
+  for(int i = 10; i < NUM_SEGMENTS; ++i)
+  {
+    const axom::IndexType cell[2] = {i, (i + 1) % NUM_SEGMENTS};
+    open_circle.appendCell(cell);
+  }
+
+  quest::FastWindingNumber<2> closed_fwn(closed_circle);
+  quest::FastWindingNumber<2> open_fwn(&open_circle);
+
+  // the dipole approximation of curved 2D patches is coarser than in 3D
+  open_fwn.setAccuracy(4.);
+
+  EXPECT_NEAR(1., closed_fwn.computeWindingNumber(PointType {0., 0.}), 2e-2);
+  EXPECT_NEAR(0., closed_fwn.computeWindingNumber(PointType {3., 1.}), 2e-2);
+
+  constexpr int NUM_PTS = 1000;
+  for(int i = 0; i < NUM_PTS; ++i)
+  {
+    const PointType pt = quest::utilities::randomSpacePt<2>(-2., 2.);
+    const double r = std::sqrt(primal::squared_distance(pt, PointType()));
+    if(std::fabs(r - RADIUS) < 0.1 * RADIUS)
+    {
+      continue;
+    }
+
+    const double exact = brute_force_winding_number(&open_circle, pt);
+    EXPECT_NEAR(exact, open_fwn.computeWindingNumber(pt), 2e-2);
+    EXPECT_EQ(r < RADIUS, open_fwn.contains(pt));
+    EXPECT_EQ(r < RADIUS, closed_fwn.contains(pt));
+  }
+
+  delete closed_circle;
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  return result;
+}
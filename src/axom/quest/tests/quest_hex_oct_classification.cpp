@@ -0,0 +1,144 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "axom/config.hpp"
+#include "axom/slic.hpp"
+#include "axom/primal.hpp"
+
+#include "axom/quest/detail/shaping/hex_oct_classification.hpp"
+
+// Google Test includes
+#include "gtest/gtest.h"
+
+// Aliases
+namespace primal = axom::primal;
+namespace shaping = axom::quest::shaping;
+using PolyhedronType = primal::Polyhedron<double, 3>;
+using OctahedronType = primal::Octahedron<double, 3>;
+using Point3D = primal::Point<double, 3>;
+
+//------------------------------------------------------------------------------
+//  HELPER METHODS
+//------------------------------------------------------------------------------
+namespace
+{
+/// Returns the axis-aligned hexahedron with corners \a lo and \a hi
+PolyhedronType make_hex(const Point3D& lo, const Point3D& hi)
+{
+  PolyhedronType hex;
+  hex.addVertex(Point3D {lo[0], lo[1], lo[2]});
+  hex.addVertex(Point3D {hi[0], lo[1], lo[2]});
+  hex.addVertex(Point3D {hi[0], hi[1], lo[2]});
+  hex.addVertex(Point3D {lo[0], hi[1], lo[2]});
+  hex.addVertex(Point3D {lo[0], lo[1], hi[2]});
+  hex.addVertex(Point3D {hi[0], lo[1], hi[2]});
+  hex.addVertex(Point3D {hi[0], hi[1], hi[2]});
+  hex.addVertex(Point3D {lo[0], hi[1], hi[2]});
+  return hex;
+}
+
+/// Returns the regular octahedron with vertices at unit distance from origin
+OctahedronType make_unit_oct()
+{
+  return OctahedronType(Point3D {1., 0., 0.},
+                        Point3D {0., 1., 0.},
+                        Point3D {0., 0., 1.},
+                        Point3D {-1., 0., 0.},
+                        Point3D {0., -1., 0.},
+                        Point3D {0., 0., -1.});
+}
+
+/// Returns the unit octahedron with the opposite orientation
+OctahedronType make_inverted_unit_oct()
+{
+  return OctahedronType(Point3D {-1., 0., 0.},
+                        Point3D {0., 1., 0.},
+                        Point3D {0., 0., 1.},
+                        Point3D {1., 0., 0.},
+                        Point3D {0., -1., 0.},
+                        Point3D {0., 0., -1.});
+}
+
+}  // end anonymous namespace
+
+//------------------------------------------------------------------------------
+TEST(quest_hex_oct_classification, inside)
+{
+  const PolyhedronType hex = make_hex({-0.1, -0.1, -0.1}, {0.1, 0.1, 0.1});
+  EXPECT_EQ(shaping::HEX_INSIDE,
+            shaping::classifyHexInOct(hex, make_unit_oct()));
+  EXPECT_EQ(shaping::HEX_INSIDE,
+            shaping::classifyHexInOct(hex, make_inverted_unit_oct()));
+
+  // a hexahedron touching the faces of the octahedron is still inside
+  const PolyhedronType touching = make_hex({0., 0., 0.}, {0.5, 0.5, 0.});
+  EXPECT_EQ(shaping::HEX_INSIDE,
+            shaping::classifyHexInOct(touching, make_unit_oct()));
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_hex_oct_classification, outside)
+{
+  const PolyhedronType beyond_face = make_hex({1., 1., 1.}, {2., 2., 2.});
+  EXPECT_EQ(shaping::HEX_OUTSIDE,
+            shaping::classifyHexInOct(beyond_face, make_unit_oct()));
+  EXPECT_EQ(shaping::HEX_OUTSIDE,
+            shaping::classifyHexInOct(beyond_face, make_inverted_unit_oct()));
+
+  const PolyhedronType beyond_vertex =
+    make_hex({1.5, -0.1, -0.1}, {1.7, 0.1, 0.1});
+  EXPECT_EQ(shaping::HEX_OUTSIDE,
+            shaping::classifyHexInOct(beyond_vertex, make_unit_oct()));
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_hex_oct_classification, straddling)
+{
+  // hexahedron containing the octahedron
+  const PolyhedronType around = make_hex({-2., -2., -2.}, {2., 2., 2.});
+  EXPECT_EQ(shaping::HEX_BOUNDARY,
+            shaping::classifyHexInOct(around, make_unit_oct()));
+
+  // hexahedra crossing a face and a vertex of the octahedron
+  const PolyhedronType across_face = make_hex({0., 0., 0.}, {0.5, 0.5, 0.5});
+  EXPECT_EQ(shaping::HEX_BOUNDARY,
+            shaping::classifyHexInOct(across_face, make_unit_oct()));
+
+  const PolyhedronType across_vertex =
+    make_hex({0.5, -0.1, -0.1}, {1.5, 0.1, 0.1});
+  EXPECT_EQ(shaping::HEX_BOUNDARY,
+            shaping::classifyHexInOct(across_vertex, make_inverted_unit_oct()));
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_hex_oct_classification, degenerate)
+{
+  // octahedra with duplicate vertices have degenerate faces, and are
+  // conservatively classified as boundary, even far away from the hexahedron
+  OctahedronType oct = make_unit_oct();
+  oct[1] = oct[0];
+
+  const PolyhedronType inside = make_hex({-0.1, -0.1, -0.1}, {0.1, 0.1, 0.1});
+  const PolyhedronType outside = make_hex({5., 5., 5.}, {6., 6., 6.});
+  EXPECT_EQ(shaping::HEX_BOUNDARY, shaping::classifyHexInOct(inside, oct));
+  EXPECT_EQ(shaping::HEX_BOUNDARY, shaping::classifyHexInOct(outside, oct));
+
+  // the same holds for an octahedron collapsed to a single point
+  const Point3D pt {0.2, 0.3, 0.4};
+  const OctahedronType collapsed(pt, pt, pt, pt, pt, pt);
+  EXPECT_EQ(shaping::HEX_BOUNDARY,
+            shaping::classifyHexInOct(outside, collapsed));
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  return result;
+}
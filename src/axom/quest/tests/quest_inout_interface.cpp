@@ -14,6 +14,7 @@
 #include "axom/quest/interface/internal/QuestHelpers.hpp"
 
 #include <string>
+#include <vector>
 
 /// Helper class to wrap a template for the dimension.
 /// Appears to be required to use non-type template parameters with TYPED_TEST
@@ -239,6 +240,7 @@ TYPED_TEST(InOutInterfaceTest, set_params)
     EXPECT_EQ(successCode, axom::quest::inout_set_dimension(DIM));
     // The following is not used in 3D, but we can still invoke it
     EXPECT_EQ(successCode, axom::quest::inout_set_segments_per_knot_span(10));
+    EXPECT_EQ(successCode, axom::quest::inout_use_shared_memory(false));
   }
 
   // Initialize the query
@@ -258,6 +260,7 @@ TYPED_TEST(InOutInterfaceTest, set_params)
     EXPECT_EQ(failCode, axom::quest::inout_set_dimension(DIM));
     // The following is not used in 3D, but we can still invoke it, and get a warning
     EXPECT_EQ(failCode, axom::quest::inout_set_segments_per_knot_span(10));
+    EXPECT_EQ(failCode, axom::quest::inout_use_shared_memory(true));
 
     SLIC_INFO("--]==]");
   }
@@ -284,6 +287,98 @@ TYPED_TEST(InOutInterfaceTest, query)
   axom::quest::inout_finalize();
 }
 
+TYPED_TEST(InOutInterfaceTest, query_shared_memory)
+{
+  using PointType = typename TestFixture::InOutPoint;
+  using BBoxType = typename TestFixture::InOutBBox;
+
+  const int DIM = TestFixture::DIM;
+  const int successCode = axom::quest::QUEST_INOUT_SUCCESS;
+
+#ifdef AXOM_USE_MPI
+  MPI_Comm comm = MPI_COMM_WORLD;
+#else
+  MPI_Comm comm = MPI_COMM_SELF;
+#endif
+
+  // Evaluate the query on a lattice of points without shared memory
+  EXPECT_EQ(successCode, axom::quest::inout_set_dimension(DIM));
+  EXPECT_EQ(successCode, axom::quest::inout_init(this->meshfile, comm));
+
+  PointType lo, hi, cm;
+  EXPECT_EQ(successCode, axom::quest::inout_mesh_min_bounds(lo.data()));
+  EXPECT_EQ(successCode, axom::quest::inout_mesh_max_bounds(hi.data()));
+  EXPECT_EQ(successCode, axom::quest::inout_mesh_center_of_mass(cm.data()));
+
+  BBoxType bbox(lo, hi);
+  bbox.scale(1.1);
+
+  constexpr int RES = 17;
+  const int npts = (DIM == 2) ? RES * RES : RES * RES * RES;
+  std::vector<double> coords[3];
+  for(int d = 0; d < DIM; ++d)
+  {
+    coords[d].reserve(npts);
+  }
+  for(int k = 0; k < ((DIM == 2) ? 1 : RES); ++k)
+  {
+    for(int j = 0; j < RES; ++j)
+    {
+      for(int i = 0; i < RES; ++i)
+      {
+        const int ijk[3] = {i, j, k};
+        for(int d = 0; d < DIM; ++d)
+        {
+          const double t = static_cast<double>(ijk[d]) / (RES - 1);
+          coords[d].push_back((1. - t) * bbox.getMin()[d] +
+                              t * bbox.getMax()[d]);
+        }
+      }
+    }
+  }
+  const double* z = (DIM == 2) ? nullptr : coords[2].data();
+
+  std::vector<int> expected(npts, -1);
+  EXPECT_EQ(successCode,
+            axom::quest::inout_evaluate(coords[0].data(),
+                                        coords[1].data(),
+                                        z,
+                                        npts,
+                                        expected.data()));
+  EXPECT_EQ(successCode, axom::quest::inout_finalize());
+
+  // Evaluate again using a single spatial index per compute node
+  EXPECT_EQ(successCode, axom::quest::inout_set_dimension(DIM));
+  EXPECT_EQ(successCode, axom::quest::inout_use_shared_memory(true));
+  EXPECT_EQ(successCode, axom::quest::inout_init(this->meshfile, comm));
+  EXPECT_TRUE(axom::quest::inout_initialized());
+
+  PointType sharedLo, sharedHi, sharedCm;
+  EXPECT_EQ(successCode, axom::quest::inout_mesh_min_bounds(sharedLo.data()));
+  EXPECT_EQ(successCode, axom::quest::inout_mesh_max_bounds(sharedHi.data()));
+  EXPECT_EQ(successCode,
+            axom::quest::inout_mesh_center_of_mass(sharedCm.data()));
+  EXPECT_EQ(lo, sharedLo);
+  EXPECT_EQ(hi, sharedHi);
+  EXPECT_EQ(cm, sharedCm);
+
+  std::vector<int> actual(npts, -1);
+  EXPECT_EQ(successCode,
+            axom::quest::inout_evaluate(coords[0].data(),
+                                        coords[1].data(),
+                                        z,
+                                        npts,
+                                        actual.data()));
+  EXPECT_EQ(expected, actual);
+
+  // test an inside and an outside point
+  EXPECT_TRUE(axom::quest::inout_evaluate(0, 0, 0));
+  EXPECT_FALSE(axom::quest::inout_evaluate(10, 10, 10));
+
+  EXPECT_EQ(successCode, axom::quest::inout_finalize());
+  EXPECT_FALSE(axom::quest::inout_initialized());
+}
+
 int main(int argc, char** argv)
 {
 #ifdef AXOM_USE_MPI
@@ -36,6 +36,10 @@ using BlockIndex = Octree3D::BlockIndex;
 #include <cstdlib>
 #include <limits>
 
+#ifdef AXOM_USE_OPENMP
+  #include <omp.h>
+#endif
+
 // Uncomment the line below for true randomized points
 #ifndef INOUT_OCTREE_TESTER_SHOULD_SEED
 //  #define INOUT_OCTREE_TESTER_SHOULD_SEED
@@ -240,6 +244,192 @@ TEST(quest_inout_octree, tetrahedron_mesh)
   }
 }
 
+TEST(quest_inout_octree, packed_octree)
+{
+  SLIC_INFO("*** Checks that a packed InOutOctree matches the original.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+  using PackedOctree3D = quest::detail::PackedInOutOctree<DIM>;
+
+  for(int meshIdx = 0; meshIdx < 2; ++meshIdx)
+  {
+    mint::Mesh* mesh = (meshIdx == 0)
+      ? quest::utilities::make_octahedron_mesh()
+      : quest::utilities::make_tetrahedron_mesh();
+    GeometricBoundingBox bbox = computeBoundingBox(mesh);
+
+    Octree3D octree(bbox, mesh);
+    octree.generateIndex();
+
+    // Pack the octree into an 8-byte aligned buffer
+    const std::size_t numBytes = PackedOctree3D::packedSize(octree);
+    std::vector<std::uint64_t> buffer(numBytes / sizeof(std::uint64_t));
+    EXPECT_EQ(numBytes, PackedOctree3D::pack(octree, buffer.data()));
+
+    PackedOctree3D packed(buffer.data());
+    EXPECT_EQ(numBytes, packed.size());
+    EXPECT_EQ(mesh->getNumberOfNodes(), packed.numMeshVertices());
+    EXPECT_EQ(mesh->getNumberOfCells(), packed.numMeshCells());
+    EXPECT_EQ(octree.boundingBox(), packed.boundingBox());
+
+    // Query points slightly beyond the bounding box, on the mesh vertices
+    // and at random locations
+    GeometricBoundingBox queryBox = octree.boundingBox();
+    queryBox.scale(1.1);
+    const SpacePt& qMin = queryBox.getMin();
+    const SpacePt& qMax = queryBox.getMax();
+
+    for(int i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+      const SpacePt pt = getVertex(mesh, i);
+      EXPECT_EQ(octree.within(pt), packed.within(pt));
+    }
+
+    int numInside = 0;
+    for(int i = 0; i < NUM_PT_TESTS; ++i)
+    {
+      SpacePt pt;
+      for(int d = 0; d < DIM; ++d)
+      {
+        pt[d] = axom::utilities::random_real(qMin[d], qMax[d]);
+      }
+
+      const bool expected = octree.within(pt);
+      EXPECT_EQ(expected, packed.within(pt)) << "Query point: " << pt;
+      numInside += expected ? 1 : 0;
+    }
+    EXPECT_GT(numInside, 0);
+
+    delete mesh;
+  }
+}
+
+TEST(quest_inout_octree, statistics)
+{
+  SLIC_INFO("*** Checks the InOutOctree's statistics and query counters.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+
+  mint::Mesh* mesh = quest::utilities::make_octahedron_mesh();
+  const int numCells = mesh->getNumberOfCells();
+
+  SpacePt ptNeg(-2.);
+  SpacePt ptPos(2.);
+  GeometricBoundingBox bbox(ptNeg, ptPos);
+
+  Octree3D octree(bbox, mesh);
+  octree.generateIndex();
+
+  Octree3D::Statistics stats = octree.statistics();
+  ASSERT_FALSE(stats.levels.empty());
+  EXPECT_LE(static_cast<int>(stats.levels.size()), octree.maxLeafLevel());
+
+  int numLeaves = 0;
+  int numCellRefs = 0;
+  int numGrayLeaves = 0;
+  for(const auto& levelStats : stats.levels)
+  {
+    EXPECT_EQ(octree.getOctreeLevel(levelStats.level).numBlocks(),
+              levelStats.numBlocks);
+
+    // All leaves are colored
+    EXPECT_EQ(levelStats.numLeafBlocks,
+              levelStats.numBlackLeaves + levelStats.numWhiteLeaves +
+                levelStats.numGrayLeaves);
+
+    numLeaves += levelStats.numLeafBlocks;
+    numGrayLeaves += levelStats.numGrayLeaves;
+    numCellRefs += levelStats.numCellReferences;
+  }
+  EXPECT_GT(numLeaves, 0);
+  EXPECT_GT(numGrayLeaves, 0);
+  EXPECT_GE(numCellRefs, numCells);
+
+  EXPECT_EQ(octree.numBytes(), stats.octreeBytes);
+  EXPECT_GT(stats.grayLeafRelationBytes, 0u);
+  EXPECT_GT(stats.vertexBlockMapBytes, 0u);
+  EXPECT_EQ(stats.octreeBytes + stats.grayLeafRelationBytes +
+              stats.vertexBlockMapBytes,
+            stats.totalBytes());
+
+  // Query statistics are only collected once they are enabled
+  EXPECT_TRUE(octree.within(SpacePt(0.)));
+  EXPECT_EQ(0u, octree.statistics().containmentQueries.numQueries);
+
+  octree.enableQueryStatistics();
+  const int NUM_QUERIES = 1000;
+  for(int i = 0; i < NUM_QUERIES; ++i)
+  {
+    octree.within(quest::utilities::randomSpacePt<DIM>(-3., 3.));
+  }
+
+  stats = octree.statistics();
+  const auto& queries = stats.containmentQueries;
+  EXPECT_EQ(static_cast<std::uint64_t>(NUM_QUERIES), queries.numQueries);
+  EXPECT_GT(queries.numOutsideBoundingBox, 0u);
+  EXPECT_EQ(queries.numQueries - queries.numOutsideBoundingBox,
+            stats.leafQueries.numQueries);
+  EXPECT_LE(queries.numGrayLeafQueries, stats.leafQueries.numQueries);
+  EXPECT_GE(queries.numGrayLeafCells, queries.numGrayLeafQueries);
+  EXPECT_GE(stats.leafQueries.averageLevelsProbed(), 1.);
+
+  octree.resetQueryStatistics();
+  stats = octree.statistics();
+  EXPECT_EQ(0u, stats.containmentQueries.numQueries);
+  EXPECT_EQ(0u, stats.containmentQueries.numGrayLeafQueries);
+  EXPECT_EQ(0u, stats.leafQueries.numQueries);
+
+  delete mesh;
+}
+
+#ifdef AXOM_USE_OPENMP
+TEST(quest_inout_octree, thread_count_independence)
+{
+  SLIC_INFO("*** Checks that the generated InOutOctree does not depend"
+            << " on the number of OpenMP threads.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+  using PackedOctree3D = quest::detail::PackedInOutOctree<DIM>;
+
+  const int maxThreads = omp_get_max_threads();
+
+  for(int meshIdx = 0; meshIdx < 2; ++meshIdx)
+  {
+    mint::Mesh* mesh = (meshIdx == 0)
+      ? quest::utilities::make_octahedron_mesh()
+      : quest::utilities::make_tetrahedron_mesh();
+
+    // Use a shifted bounding box so the mesh is not aligned with the blocks
+    GeometricBoundingBox bbox = computeBoundingBox(mesh);
+    bbox.scale(2.);
+    bbox.shift(SpaceVector(0.01));
+
+    // Generate and pack the octree using one thread and using all threads
+    std::vector<std::uint64_t> buffers[2];
+    const int numThreads[2] = {1, std::max(maxThreads, 4)};
+    for(int t = 0; t < 2; ++t)
+    {
+      omp_set_num_threads(numThreads[t]);
+
+      Octree3D octree(bbox, mesh);
+      octree.generateIndex();
+
+      const std::size_t numBytes = PackedOctree3D::packedSize(octree);
+      buffers[t].resize(numBytes / sizeof(std::uint64_t));
+      PackedOctree3D::pack(octree, buffers[t].data());
+    }
+    omp_set_num_threads(maxThreads);
+
+    EXPECT_EQ(buffers[0], buffers[1]);
+
+    delete mesh;
+  }
+}
+#endif  // AXOM_USE_OPENMP
+
 //----------------------------------------------------------------------
 
 int main(int argc, char* argv[])
@@ -197,6 +197,52 @@ TEST(quest_inout_quadtree, circle_mesh)
   }
 }
 
+TEST(quest_inout_quadtree, packed_quadtree)
+{
+  SLIC_INFO("*** Checks that a packed 2D InOutOctree matches the original.\n");
+
+  namespace mint = axom::mint;
+  namespace quest = axom::quest;
+  using PackedOctree2D = quest::detail::PackedInOutOctree<DIM>;
+
+  for(int num_segments : {3, 100, 1000})
+  {
+    mint::Mesh* mesh = quest::utilities::make_circle_mesh_2d(1., num_segments);
+    GeometricBoundingBox bbox = computeBoundingBox(mesh);
+
+    Octree2D octree(bbox, mesh);
+    octree.generateIndex();
+
+    const std::size_t numBytes = PackedOctree2D::packedSize(octree);
+    std::vector<std::uint64_t> buffer(numBytes / sizeof(std::uint64_t));
+    PackedOctree2D::pack(octree, buffer.data());
+
+    PackedOctree2D packed(buffer.data());
+    EXPECT_EQ(mesh->getNumberOfCells(), packed.numMeshCells());
+    EXPECT_EQ(octree.boundingBox(), packed.boundingBox());
+
+    GeometricBoundingBox queryBox = octree.boundingBox();
+    queryBox.scale(1.1);
+    const SpacePt& qMin = queryBox.getMin();
+    const SpacePt& qMax = queryBox.getMax();
+
+    for(int i = 0; i < mesh->getNumberOfNodes(); ++i)
+    {
+      const SpacePt pt = getVertex(mesh, i);
+      EXPECT_EQ(octree.within(pt), packed.within(pt));
+    }
+
+    for(int i = 0; i < NUM_PT_TESTS; ++i)
+    {
+      SpacePt pt {axom::utilities::random_real(qMin[0], qMax[0]),
+                  axom::utilities::random_real(qMin[1], qMax[1])};
+      EXPECT_EQ(octree.within(pt), packed.within(pt)) << "Query point: " << pt;
+    }
+
+    delete mesh;
+  }
+}
+
 //----------------------------------------------------------------------
 
 int main(int argc, char* argv[])
@@ -524,6 +524,91 @@ TEST(quest_mesh_tester, surfacemesh_watertight_ondisk)
 
 //----------------------------------------------------------------------
 
+/*!
+ * Builds a stack of \a numLevels parallel triangles, pierced by a vertical
+ * triangle with index numLevels, followed by a degenerate triangle
+ */
+UMesh* make_pierced_stack_mesh(int numLevels)
+{
+  UMesh* mesh = new UMesh(3, mint::TRIANGLE);
+
+  for(int k = 0; k < numLevels; ++k)
+  {
+    const double z = k;
+    mesh->appendNode(-1., -1., z);
+    mesh->appendNode(2., -1., z);
+    mesh->appendNode(-1., 2., z);
+  }
+  mesh->appendNode(0., 0., -1.);
+  mesh->appendNode(0., 0., numLevels);
+  mesh->appendNode(0.5, 0.5, numLevels);
+  mesh->appendNode(3., 3., 3.);
+
+  for(int k = 0; k < numLevels; ++k)
+  {
+    const axom::IndexType cell[] = {3 * k, 3 * k + 1, 3 * k + 2};
+    mesh->appendCell(cell);
+  }
+  const axom::IndexType nodeOffset = 3 * numLevels;
+  const axom::IndexType piercing[] = {nodeOffset,
+                                      nodeOffset + 1,
+                                      nodeOffset + 2};
+  mesh->appendCell(piercing);
+  const axom::IndexType degenerate[] = {nodeOffset + 3,
+                                        nodeOffset + 3,
+                                        nodeOffset + 1};
+  mesh->appendCell(degenerate);
+
+  return mesh;
+}
+
+template <typename ExecSpace>
+void check_ordered_uniform_grid_intersections()
+{
+  constexpr int NUM_LEVELS = 20;
+  UMesh* surface_mesh = make_pierced_stack_mesh(NUM_LEVELS);
+
+  std::vector<std::pair<int, int>> expisect;
+  for(int k = 0; k < NUM_LEVELS; ++k)
+  {
+    expisect.push_back(std::make_pair(k, NUM_LEVELS));
+  }
+  const std::vector<int> expdegen {NUM_LEVELS + 1};
+
+  // Coarse and fine grids; triangles share several bins in the latter
+  for(int res : {1, 3, 16})
+  {
+    SCOPED_TRACE("resolution " + std::to_string(res));
+
+    std::vector<std::pair<int, int>> collisions;
+    std::vector<int> degenerate;
+    quest::findTriMeshIntersectionsUniformGrid<ExecSpace, double>(surface_mesh,
+                                                                  collisions,
+                                                                  degenerate,
+                                                                  res);
+
+    // results are ordered and free of duplicates without sorting
+    EXPECT_EQ(expisect, collisions);
+    EXPECT_EQ(expdegen, degenerate);
+  }
+
+  delete surface_mesh;
+}
+
+TEST(quest_mesh_tester, uniform_grid_ordered_intersections_seq)
+{
+  check_ordered_uniform_grid_intersections<axom::SEQ_EXEC>();
+}
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+TEST(quest_mesh_tester, uniform_grid_ordered_intersections_omp)
+{
+  check_ordered_uniform_grid_intersections<axom::OMP_EXEC>();
+}
+#endif
+
+//----------------------------------------------------------------------
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleTest(&argc, argv);
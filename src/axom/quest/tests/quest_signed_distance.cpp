@@ -305,6 +305,215 @@ TEST(quest_signed_distance, sphere_test_with_normals)
 
   SLIC_INFO("Done.");
 }
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, sphere_update_mesh)
+{
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+
+  UMesh* surface_mesh = new UMesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  mint::UniformMesh* umesh = nullptr;
+  getUniformMesh(surface_mesh, umesh);
+  const int nnodes = umesh->getNumberOfNodes();
+
+  constexpr bool is_watertight = true;
+  quest::SignedDistance<3> signed_distance(surface_mesh, is_watertight);
+
+  // Deform the sphere over a few cycles, growing and shifting it
+  double* x = surface_mesh->getCoordinateArray(mint::X_COORDINATE);
+  double* y = surface_mesh->getCoordinateArray(mint::Y_COORDINATE);
+  double* z = surface_mesh->getCoordinateArray(mint::Z_COORDINATE);
+  const int nsurfnodes = surface_mesh->getNumberOfNodes();
+
+  constexpr int NUM_CYCLES = 3;
+  constexpr double SCALE = 1.1;
+  constexpr double SHIFT = 0.05;
+  double radius = SPHERE_RADIUS;
+  double center = 0.;
+  for(int cycle = 0; cycle < NUM_CYCLES; ++cycle)
+  {
+    for(int inode = 0; inode < nsurfnodes; ++inode)
+    {
+      x[inode] = (x[inode] - center) * SCALE + center + SHIFT;
+      y[inode] = (y[inode] - center) * SCALE + center + SHIFT;
+      z[inode] = (z[inode] - center) * SCALE + center + SHIFT;
+    }
+    radius *= SCALE;
+    center += SHIFT;
+
+    EXPECT_TRUE(signed_distance.updateMesh());
+
+    // Results must match a SignedDistance built on the deformed mesh
+    quest::SignedDistance<3> rebuilt(surface_mesh, is_watertight);
+    const primal::Sphere<double, 3> analytic_sphere(
+      primal::Point<double, 3>(center),
+      radius);
+
+    for(int inode = 0; inode < nnodes; ++inode)
+    {
+      primal::Point<double, 3> pt;
+      umesh->getNode(inode, pt.data());
+
+      const double phi = signed_distance.computeDistance(pt);
+      EXPECT_DOUBLE_EQ(rebuilt.computeDistance(pt), phi);
+      EXPECT_NEAR(analytic_sphere.computeSignedDistance(pt), phi, 2.e-2);
+    }
+  }
+
+  delete surface_mesh;
+  delete umesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, sphere_band_limited)
+{
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+  constexpr double BAND_WIDTH = 0.25;
+
+  UMesh* surface_mesh = new UMesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  mint::UniformMesh* umesh = nullptr;
+  getUniformMesh(surface_mesh, umesh);
+  const int nnodes = umesh->getNumberOfNodes();
+
+  // The sign outside the band comes from a containment query when the
+  // surface is watertight, and from the closest point otherwise
+  for(bool is_watertight : {true, false})
+  {
+    quest::SignedDistance<3> exact(surface_mesh, is_watertight);
+    quest::SignedDistance<3> banded(surface_mesh, is_watertight);
+    banded.setBandWidth(BAND_WIDTH);
+    EXPECT_DOUBLE_EQ(BAND_WIDTH, banded.getBandWidth());
+
+    int numInBand = 0;
+    for(int inode = 0; inode < nnodes; ++inode)
+    {
+      primal::Point<double, 3> pt;
+      umesh->getNode(inode, pt.data());
+
+      const double phi = exact.computeDistance(pt);
+      const double banded_phi = banded.computeDistance(pt);
+      if(std::abs(phi) < BAND_WIDTH)
+      {
+        EXPECT_DOUBLE_EQ(phi, banded_phi);
+        ++numInBand;
+      }
+      else
+      {
+        EXPECT_DOUBLE_EQ(std::copysign(BAND_WIDTH, phi), banded_phi);
+      }
+    }
+    EXPECT_GT(numInBand, 0);
+    EXPECT_LT(numInBand, nnodes);
+
+    // Without a band, the results are exact again
+    banded.clearBandWidth();
+    primal::Point<double, 3> origin;
+    EXPECT_DOUBLE_EQ(exact.computeDistance(origin),
+                     banded.computeDistance(origin));
+  }
+
+  delete surface_mesh;
+  delete umesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_signed_distance, sphere_distance_field)
+{
+  constexpr double SPHERE_RADIUS = 0.5;
+  constexpr int SPHERE_THETA_RES = 25;
+  constexpr int SPHERE_PHI_RES = 25;
+  const double SPHERE_CENTER[3] = {0.0, 0.0, 0.0};
+  constexpr int N = 24;
+
+  UMesh* surface_mesh = new UMesh(3, mint::TRIANGLE);
+  quest::utilities::getSphereSurfaceMesh(surface_mesh,
+                                         SPHERE_CENTER,
+                                         SPHERE_RADIUS,
+                                         SPHERE_THETA_RES,
+                                         SPHERE_PHI_RES);
+
+  constexpr bool is_watertight = true;
+  quest::SignedDistance<3> signed_distance(surface_mesh, is_watertight);
+
+  // A uniform grid and a rectilinear grid with cells growing away from the
+  // sphere
+  const double lo[3] = {-1., -1., -1.};
+  const double hi[3] = {1.5, 1., 1.};
+  mint::UniformMesh uniform_grid(lo, hi, N, N, N);
+
+  mint::RectilinearMesh rectilinear_grid(N, N, N);
+  for(int d = 0; d < 3; ++d)
+  {
+    double* coords = rectilinear_grid.getCoordinateArray(d);
+    for(int i = 0; i < N; ++i)
+    {
+      const double t = -1. + 2. * i / (N - 1);
+      coords[i] = t * (0.5 + 0.5 * std::abs(t));
+    }
+  }
+
+  for(const mint::StructuredMesh* grid :
+      {static_cast<const mint::StructuredMesh*>(&uniform_grid),
+       static_cast<const mint::StructuredMesh*>(&rectilinear_grid)})
+  {
+    const int nnodes = grid->getNumberOfNodes();
+    std::vector<primal::Point<double, 3>> pts(nnodes);
+    double maxSpacing = 0.;
+    for(int inode = 0; inode < nnodes; ++inode)
+    {
+      grid->getNode(inode, pts[inode].data());
+    }
+    for(int d = 0; d < 3; ++d)
+    {
+      const int stride =
+        (d == 0) ? 1 : (d == 1 ? grid->nodeJp() : grid->nodeKp());
+      for(int i = 1; i < N; ++i)
+      {
+        maxSpacing = std::max(maxSpacing,
+                              pts[i * stride][d] - pts[(i - 1) * stride][d]);
+      }
+    }
+
+    std::vector<double> exact(nnodes), field(nnodes);
+    signed_distance.computeDistances(nnodes, pts.data(), exact.data());
+    signed_distance.computeDistanceField(grid, field.data());
+
+    // Exact within the band, first-order accurate with the exact sign outside
+    for(int inode = 0; inode < nnodes; ++inode)
+    {
+      if(std::abs(exact[inode]) < maxSpacing)
+      {
+        EXPECT_DOUBLE_EQ(exact[inode], field[inode]);
+      }
+      else
+      {
+        EXPECT_EQ(exact[inode] < 0., field[inode] < 0.);
+        EXPECT_NEAR(exact[inode], field[inode], maxSpacing);
+      }
+    }
+  }
+
+  delete surface_mesh;
+}
+
 //------------------------------------------------------------------------------
 template <typename ExecSpace>
 void run_vectorized_sphere_test()
@@ -303,6 +303,349 @@ TEST(quest_vertex_weld, indexedOctahedron)
   mesh = nullptr;
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_weld_matches_tri_weld()
+{
+  SLIC_INFO("*** Tests that weldMeshVertices() in execution space "
+            << axom::execution_space<ExecSpace>::name()
+            << " matches weldTriMeshVertices() on a triangle soup");
+
+  // A triangle soup over the octahedron: each triangle has its own vertices
+  UMesh* octahedron =
+    static_cast<UMesh*>(axom::quest::utilities::make_octahedron_mesh());
+
+  const int NT = octahedron->getNumberOfCells();
+  UMesh* soup = new UMesh(DIM, axom::mint::TRIANGLE);
+  for(int i = 0; i < NT; ++i)
+  {
+    const axom::IndexType* tri = octahedron->getCellNodeIDs(i);
+    for(int j = 0; j < 3; ++j)
+    {
+      double xyz[3];
+      octahedron->getNode(tri[j], xyz);
+      insertVertex(soup, xyz[0], xyz[1], xyz[2]);
+    }
+    insertTriangle(soup, 3 * i, 3 * i + 1, 3 * i + 2);
+  }
+  insertTriangle(soup, 0, 0, 1);  // degenerate
+  delete octahedron;
+
+  UMesh* expected = new UMesh(DIM, axom::mint::TRIANGLE);
+  expected->appendNodes(soup->getCoordinateArray(0),
+                        soup->getCoordinateArray(1),
+                        soup->getCoordinateArray(2),
+                        soup->getNumberOfNodes());
+  expected->appendCells(soup->getCellNodesArray(), soup->getNumberOfCells());
+  axom::quest::weldTriMeshVertices(&expected, EPS);
+
+  axom::quest::WeldStatistics stats =
+    axom::quest::weldMeshVertices<ExecSpace>(soup, EPS);
+
+  EXPECT_EQ(3 * NT, stats.numInputNodes);
+  EXPECT_EQ(6, stats.numOutputNodes);
+  EXPECT_EQ(6, stats.numWeldedGroups);
+  EXPECT_EQ(3 * NT - 6, stats.numMergedNodes());
+  EXPECT_EQ(NT + 1, stats.numInputCells);
+  EXPECT_EQ(NT, stats.numOutputCells);
+  EXPECT_EQ(1, stats.numRemovedCells());
+  EXPECT_EQ(0, stats.numDegradedCells);
+  EXPECT_DOUBLE_EQ(0., stats.maxDisplacement);
+
+  // Both functions keep the first vertex of each group and the cell order
+  ASSERT_EQ(expected->getNumberOfNodes(), soup->getNumberOfNodes());
+  ASSERT_EQ(expected->getNumberOfCells(), soup->getNumberOfCells());
+  for(int i = 0; i < soup->getNumberOfNodes(); ++i)
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      EXPECT_EQ(expected->getNodeCoordinate(i, d),
+                soup->getNodeCoordinate(i, d));
+    }
+  }
+  for(int i = 0; i < soup->getNumberOfCells(); ++i)
+  {
+    for(int j = 0; j < 3; ++j)
+    {
+      EXPECT_EQ(expected->getCellNodeIDs(i)[j], soup->getCellNodeIDs(i)[j]);
+    }
+  }
+
+  delete expected;
+  delete soup;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_weld_segments()
+{
+  SLIC_INFO("*** Tests weldMeshVertices() in execution space "
+            << axom::execution_space<ExecSpace>::name()
+            << " on a segment soup");
+
+  // A closed polygon with N segments, each with its own perturbed vertices
+  const int N = 16;
+  const double perturbation = 0.25 * EPS;
+  UMesh* mesh = new UMesh(2, axom::mint::SEGMENT);
+  for(int i = 0; i < N; ++i)
+  {
+    const double t0 = 2. * M_PI * i / N;
+    const double t1 = 2. * M_PI * (i + 1) / N;
+    const double delta = (i % 2 == 0) ? perturbation : -perturbation;
+    mesh->appendNode(std::cos(t0) + delta, std::sin(t0));
+    mesh->appendNode(std::cos(t1), std::sin(t1) + delta);
+
+    axom::IndexType seg[2] = {2 * i, 2 * i + 1};
+    mesh->appendCell(seg);
+  }
+
+  axom::quest::WeldStatistics stats =
+    axom::quest::weldMeshVertices<ExecSpace>(mesh, EPS);
+
+  EXPECT_EQ(2 * N, stats.numInputNodes);
+  EXPECT_EQ(N, stats.numOutputNodes);
+  EXPECT_EQ(N, stats.numWeldedGroups);
+  EXPECT_EQ(N, stats.numOutputCells);
+  EXPECT_EQ(0, stats.numRemovedCells());
+  EXPECT_GT(stats.maxDisplacement, 0.);
+  EXPECT_LE(stats.maxDisplacement, 2 * perturbation);
+
+  EXPECT_EQ(N, mesh->getNumberOfNodes());
+  EXPECT_EQ(N, mesh->getNumberOfCells());
+
+  // Each segment now shares its end vertex with the next one's start vertex
+  for(int i = 0; i < N; ++i)
+  {
+    const axom::IndexType* seg = mesh->getCellNodeIDs(i);
+    const axom::IndexType* next = mesh->getCellNodeIDs((i + 1) % N);
+    EXPECT_EQ(seg[1], next[0]);
+    EXPECT_NE(seg[0], seg[1]);
+  }
+
+  delete mesh;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_weld_quads()
+{
+  SLIC_INFO("*** Tests weldMeshVertices() in execution space "
+            << axom::execution_space<ExecSpace>::name() << " on a quad soup");
+
+  // An N x N grid of quads, each with its own vertices
+  const int N = 10;
+  const double h = 0.1;
+  UMesh* mesh = new UMesh(DIM, axom::mint::QUAD);
+  for(int j = 0; j < N; ++j)
+  {
+    for(int i = 0; i < N; ++i)
+    {
+      const axom::IndexType first = mesh->getNumberOfNodes();
+      mesh->appendNode(i * h, j * h, 1.);
+      mesh->appendNode((i + 1) * h, j * h, 1.);
+      mesh->appendNode((i + 1) * h, (j + 1) * h, 1.);
+      mesh->appendNode(i * h, (j + 1) * h, 1.);
+
+      axom::IndexType quad[4] = {first, first + 1, first + 2, first + 3};
+      mesh->appendCell(quad);
+    }
+  }
+
+  // Collapse the first quad's top edge
+  axom::IndexType* collapsed = mesh->getCellNodeIDs(0);
+  collapsed[3] = collapsed[2];
+
+  axom::quest::WeldStatistics stats =
+    axom::quest::weldMeshVertices<ExecSpace>(mesh, EPS);
+
+  // All but the four corners of the grid are shared by several quads
+  EXPECT_EQ(4 * N * N, stats.numInputNodes);
+  EXPECT_EQ((N + 1) * (N + 1), stats.numOutputNodes);
+  EXPECT_EQ((N + 1) * (N + 1) - 4, stats.numWeldedGroups);
+  EXPECT_EQ(N * N - 1, stats.numOutputCells);
+  EXPECT_EQ(1, stats.numRemovedCells());
+  EXPECT_EQ(1, stats.numDegradedCells);
+
+  EXPECT_EQ((N + 1) * (N + 1), mesh->getNumberOfNodes());
+  EXPECT_EQ(N * N - 1, mesh->getNumberOfCells());
+
+  delete mesh;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_weld_fields()
+{
+  SLIC_INFO("*** Tests that weldMeshVertices() in execution space "
+            << axom::execution_space<ExecSpace>::name()
+            << " compacts the node and cell fields");
+
+  // A row of N quads, each with its own vertices
+  const int N = 3;
+  UMesh* mesh = new UMesh(2, axom::mint::QUAD);
+  for(int i = 0; i < N; ++i)
+  {
+    const axom::IndexType first = mesh->getNumberOfNodes();
+    mesh->appendNode(i, 0.);
+    mesh->appendNode(i + 1, 0.);
+    mesh->appendNode(i + 1, 1.);
+    mesh->appendNode(i, 1.);
+
+    axom::IndexType quad[4] = {first, first + 1, first + 2, first + 3};
+    mesh->appendCell(quad);
+  }
+
+  // Collapse the first quad's top edge
+  axom::IndexType* collapsed = mesh->getCellNodeIDs(0);
+  collapsed[3] = collapsed[2];
+
+  const int numNodes = mesh->getNumberOfNodes();
+  double* xy = mesh->createField<double>("xy", axom::mint::NODE_CENTERED, 2);
+  axom::int64* nodeIDs =
+    mesh->createField<axom::int64>("nodeIDs", axom::mint::NODE_CENTERED);
+  for(int i = 0; i < numNodes; ++i)
+  {
+    mesh->getNode(i, &xy[2 * i]);
+    nodeIDs[i] = i;
+  }
+
+  axom::int32* cellIDs =
+    mesh->createField<axom::int32>("cellIDs", axom::mint::CELL_CENTERED);
+  float* area = mesh->createField<float>("area", axom::mint::CELL_CENTERED);
+  for(int c = 0; c < N; ++c)
+  {
+    cellIDs[c] = c;
+    area[c] = (c == 0) ? 0.5f : 1.f;
+  }
+
+  axom::quest::WeldStatistics stats =
+    axom::quest::weldMeshVertices<ExecSpace>(mesh, EPS);
+
+  EXPECT_EQ(2 * (N + 1), stats.numOutputNodes);
+  EXPECT_EQ(N - 1, stats.numOutputCells);
+  EXPECT_EQ(1, stats.numDegradedCells);
+
+  // Each welded node keeps the values of the first node of its group
+  xy = mesh->getFieldPtr<double>("xy", axom::mint::NODE_CENTERED);
+  nodeIDs =
+    mesh->getFieldPtr<axom::int64>("nodeIDs", axom::mint::NODE_CENTERED);
+  EXPECT_EQ(0, nodeIDs[0]);
+  for(int i = 0; i < mesh->getNumberOfNodes(); ++i)
+  {
+    EXPECT_EQ(mesh->getNodeCoordinate(i, 0), xy[2 * i]);
+    EXPECT_EQ(mesh->getNodeCoordinate(i, 1), xy[2 * i + 1]);
+    if(i > 0)
+    {
+      EXPECT_LT(nodeIDs[i - 1], nodeIDs[i]);
+    }
+  }
+
+  cellIDs =
+    mesh->getFieldPtr<axom::int32>("cellIDs", axom::mint::CELL_CENTERED);
+  area = mesh->getFieldPtr<float>("area", axom::mint::CELL_CENTERED);
+  for(int c = 0; c < mesh->getNumberOfCells(); ++c)
+  {
+    EXPECT_EQ(c + 1, cellIDs[c]);
+    EXPECT_EQ(1.f, area[c]);
+  }
+
+  delete mesh;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_weld_chain()
+{
+  SLIC_INFO("*** Tests weldMeshVertices() in execution space "
+            << axom::execution_space<ExecSpace>::name()
+            << " on chains of close vertices");
+
+  // Vertices that are not within eps of each other, but are connected
+  // through a chain of vertices that are, get welded.
+  // The chains straddle several lattice cells.
+  const double eps = 0.1;
+  UMesh* mesh = new UMesh(DIM, axom::mint::TRIANGLE);
+  insertVertex(mesh, 0.35, 0, 0);
+  insertVertex(mesh, 0.15, 0, 0);  // chain of 0.15 - 0.22 - 0.29 - 0.35
+  insertVertex(mesh, 0.29, 0, 0);
+  insertVertex(mesh, 0.22, 0, 0);
+  insertVertex(mesh, 1, 1, 0);
+  insertVertex(mesh, 1.0999, 0.9001, 0);  // within eps of the previous vertex
+  insertVertex(mesh, 1.25, 1, 0);         // not within eps of the others
+  insertTriangle(mesh, 0, 4, 6);
+  insertTriangle(mesh, 1, 5, 6);
+  insertTriangle(mesh, 2, 3, 4);  // degenerate after welding
+
+  axom::quest::WeldStatistics stats =
+    axom::quest::weldMeshVertices<ExecSpace>(mesh, eps);
+
+  EXPECT_EQ(3, stats.numOutputNodes);
+  EXPECT_EQ(2, stats.numWeldedGroups);
+  EXPECT_NEAR(0.2, stats.maxDisplacement, 1e-12);
+  EXPECT_EQ(2, stats.numOutputCells);
+
+  // The welded vertices keep the coordinates of the first vertex of their group
+  EXPECT_DOUBLE_EQ(0.35, mesh->getNodeCoordinate(0, 0));
+  EXPECT_DOUBLE_EQ(1., mesh->getNodeCoordinate(1, 0));
+  EXPECT_DOUBLE_EQ(1.25, mesh->getNodeCoordinate(2, 0));
+
+  for(int i = 0; i < 2; ++i)
+  {
+    const axom::IndexType* tri = mesh->getCellNodeIDs(i);
+    EXPECT_EQ(0, tri[0]);
+    EXPECT_EQ(1, tri[1]);
+    EXPECT_EQ(2, tri[2]);
+  }
+
+  delete mesh;
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+void check_weld_empty()
+{
+  UMesh* mesh = new UMesh(DIM, axom::mint::TRIANGLE);
+
+  axom::quest::WeldStatistics stats =
+    axom::quest::weldMeshVertices<ExecSpace>(mesh, EPS);
+
+  EXPECT_EQ(0, stats.numInputNodes);
+  EXPECT_EQ(0, stats.numOutputNodes);
+  EXPECT_EQ(0, stats.numWeldedGroups);
+  EXPECT_EQ(0, mesh->getNumberOfNodes());
+  EXPECT_EQ(0, mesh->getNumberOfCells());
+
+  delete mesh;
+}
+
+//------------------------------------------------------------------------------
+TEST(quest_vertex_weld, weldMeshVertices_seq)
+{
+  using exec = axom::SEQ_EXEC;
+
+  check_weld_empty<exec>();
+  check_weld_matches_tri_weld<exec>();
+  check_weld_segments<exec>();
+  check_weld_quads<exec>();
+  check_weld_fields<exec>();
+  check_weld_chain<exec>();
+}
+
+#if defined(AXOM_USE_RAJA) && defined(AXOM_USE_OPENMP)
+//------------------------------------------------------------------------------
+TEST(quest_vertex_weld, weldMeshVertices_omp)
+{
+  using exec = axom::OMP_EXEC;
+
+  check_weld_empty<exec>();
+  check_weld_matches_tri_weld<exec>();
+  check_weld_segments<exec>();
+  check_weld_quads<exec>();
+  check_weld_fields<exec>();
+  check_weld_chain<exec>();
+}
+#endif
+
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
 int main(int argc, char* argv[])
@@ -10,6 +10,7 @@
 #include <algorithm>
 
 // Sidre project headers
+#include "DataStore.hpp"
 #include "Group.hpp"
 #include "View.hpp"
 
@@ -82,6 +83,8 @@ Buffer* Buffer::allocate(int allocID)
   if(data != nullptr)
   {
     m_node.set_external(DataType(m_node.dtype()), data);
+    m_allocator_id = allocID;
+    trackMemory();
   }
   return this;
 }
@@ -146,6 +149,11 @@ Buffer* Buffer::reallocate(IndexType num_elems)
   {
     m_node.reset();
     m_node.set_external(dtype, new_data_ptr);
+    if(old_data_ptr == nullptr)
+    {
+      m_allocator_id = axom::getDefaultAllocatorID();
+    }
+    trackMemory();
   }
   else
   {
@@ -172,6 +180,8 @@ Buffer* Buffer::deallocate()
 
   releaseBytes(getVoidPtr());
   m_node.set_external(DataType(m_node.dtype()), nullptr);
+  m_allocator_id = INVALID_ALLOCATOR_ID;
+  trackMemory();
 
   std::set<View*>::iterator vit = m_views.begin();
   for(; vit != m_views.end(); ++vit)
@@ -318,7 +328,16 @@ void Buffer::importFrom(conduit::Node& buffer_holder)
  *
  *************************************************************************
  */
-Buffer::Buffer(IndexType uid) : m_index(uid), m_views(), m_node() { }
+Buffer::Buffer(IndexType uid, DataStore* datastore)
+  : m_index(uid)
+  , m_views()
+  , m_node()
+  , m_datastore(datastore)
+  , m_allocator_id(INVALID_ALLOCATOR_ID)
+  , m_tracked_bytes(0)
+  , m_tracked_allocator_id(INVALID_ALLOCATOR_ID)
+  , m_tracked_paths()
+{ }
 
 /*
  *************************************************************************
@@ -331,6 +350,11 @@ Buffer::Buffer(const Buffer& source)
   : m_index(source.m_index)
   , m_views(source.m_views)
   , m_node(source.m_node)
+  , m_datastore(source.m_datastore)
+  , m_allocator_id(source.m_allocator_id)
+  , m_tracked_bytes(0)
+  , m_tracked_allocator_id(INVALID_ALLOCATOR_ID)
+  , m_tracked_paths()
 {
   // disallow?
 }
@@ -342,7 +366,12 @@ Buffer::Buffer(const Buffer& source)
  *
  *************************************************************************
  */
-Buffer::~Buffer() { releaseBytes(getVoidPtr()); }
+Buffer::~Buffer()
+{
+  releaseBytes(getVoidPtr());
+  m_node.reset();
+  trackMemory();
+}
 
 /*
  *************************************************************************
@@ -358,6 +387,7 @@ void Buffer::attachToView(View* view)
   if(view->m_data_buffer == this)
   {
     m_views.insert(view);
+    trackMemory();
   }
 }
 
@@ -377,6 +407,7 @@ void Buffer::detachFromView(View* view)
   {
     m_views.erase(view);
     view->setBufferViewToEmpty();
+    trackMemory();
   }
 }
 
@@ -396,6 +427,7 @@ void Buffer::detachFromAllViews()
   }
 
   m_views.clear();
+  trackMemory();
 }
 
 /*
@@ -426,5 +458,20 @@ void Buffer::releaseBytes(void* ptr)
   axom::deallocate(ptr_copy);
 }
 
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to update the DataStore's memory tracking.
+ *
+ *************************************************************************
+ */
+void Buffer::trackMemory()
+{
+  if(m_datastore != nullptr && m_datastore->isMemoryTracking())
+  {
+    m_datastore->trackBufferMemory(this);
+  }
+}
+
 } /* end namespace sidre */
 } /* end namespace axom */
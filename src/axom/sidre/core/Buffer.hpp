@@ -18,6 +18,8 @@
 
 // Standard C++ headers
 #include <set>
+#include <string>
+#include <vector>
 
 // Other axom headers
 #include "axom/core/memory_management.hpp"
@@ -139,6 +141,12 @@ public:
     return m_node.dtype().element_bytes();
   }
 
+  /*!
+   * \brief Return the ID of the allocator of the Buffer's data, or
+   *        INVALID_ALLOCATOR_ID if the Buffer has not been allocated.
+   */
+  int getAllocatorID() const { return m_allocator_id; }
+
   /*!
    * \brief Return true if Buffer has been (re)allocated with length >= 0, else
    *  false.
@@ -262,9 +270,10 @@ private:
 
   /*!
    *  \brief Private ctor assigns id generated by DataStore (must be
-   *         unique among Buffers in DataStore.
+   *         unique among Buffers in DataStore) and the DataStore that
+   *         tracks its memory.
    */
-  Buffer(IndexType uid);
+  Buffer(IndexType uid, DataStore* datastore = nullptr);
 
   /*!
    * \brief Private copy ctor.
@@ -306,6 +315,14 @@ private:
    */
   void releaseBytes(void* ptr);
 
+  /*!
+   * \brief Private method to update the DataStore's memory tracking after
+   *        the Buffer's data or Views have changed.
+   *
+   * This is a no-op unless memory tracking is enabled in the DataStore.
+   */
+  void trackMemory();
+
   /// Buffer's unique index within DataStore object that created it.
   IndexType m_index;
 
@@ -314,6 +331,17 @@ private:
 
   /// Conduit Node that holds Buffer data.
   Node m_node;
+
+  /// DataStore that created the Buffer, which tracks its memory.
+  DataStore* m_datastore;
+
+  /// Allocator ID of the Buffer data.
+  int m_allocator_id;
+
+  /// Bytes, allocator ID and Group paths charged to the memory tracking.
+  IndexType m_tracked_bytes;
+  int m_tracked_allocator_id;
+  std::vector<std::string> m_tracked_paths;
 };
 
 } /* end namespace sidre */
@@ -4,7 +4,9 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 
 // Standard C++ headers
+#include <algorithm>
 #include <fstream>
+#include <set>
 
 #include "conduit_blueprint.hpp"
 #include "conduit_utils.hpp"  // for setting conduit's message logging handlers
@@ -86,6 +88,7 @@ DataStore::DataStore()
   , m_buffer_coll(new BufferCollection())
   , m_attribute_coll(new AttributeCollection())
   , m_need_to_finalize_slic(false)
+  , m_memory_tracking(false)
 {
   if(!axom::slic::isInitialized())
   {
@@ -123,6 +126,9 @@ DataStore::DataStore()
  */
 DataStore::~DataStore()
 {
+  // nothing is left to account for once the DataStore goes away
+  m_memory_tracking = false;
+
   // clean up Groups and Views before we destroy Buffers
   delete m_RootGroup;
   destroyAllBuffers();
@@ -215,7 +221,7 @@ Buffer* DataStore::getBuffer(IndexType idx) const
 Buffer* DataStore::createBuffer()
 {
   IndexType newIndex = m_buffer_coll->getValidEmptyIndex();
-  Buffer* buff = new Buffer(newIndex);
+  Buffer* buff = new Buffer(newIndex, this);
   m_buffer_coll->insertItem(buff, newIndex);
   return buff;
 }
@@ -704,6 +710,283 @@ bool DataStore::generateBlueprintIndex(MPI_Comm comm,
 }
 #endif
 
+namespace
+{
+using MemoryStatsMap = std::map<std::string, DataStore::MemoryStats>;
+
+/*
+ *************************************************************************
+ *
+ * Fill the memory report of a Group subtree and collect the Buffers
+ * referenced by its Views.
+ *
+ *************************************************************************
+ */
+void reportGroupMemory(const Group* group,
+                       const MemoryStatsMap* peaks,
+                       Node& report,
+                       std::set<const Buffer*>& buffers)
+{
+  IndexType external_bytes = 0;
+  IndexType num_views = 0;
+  IndexType num_external_views = 0;
+
+  // Buffers of this subtree only; merged into the caller's set at the end
+  std::set<const Buffer*> subtree_buffers;
+
+  for(const auto& view : group->views())
+  {
+    ++num_views;
+    if(view.isExternal())
+    {
+      ++num_external_views;
+      external_bytes += view.getTotalBytes();
+    }
+    else if(view.hasBuffer())
+    {
+      subtree_buffers.insert(view.getBuffer());
+    }
+  }
+
+  for(const auto& child : group->groups())
+  {
+    Node& child_report = report["groups"][child.getName()];
+    reportGroupMemory(&child, peaks, child_report, subtree_buffers);
+
+    external_bytes += child_report["external_bytes"].as_int64();
+    num_views += child_report["num_views"].as_int64();
+    num_external_views += child_report["num_external_views"].as_int64();
+  }
+
+  IndexType current_bytes = 0;
+  for(const Buffer* buffer : subtree_buffers)
+  {
+    if(buffer->isAllocated())
+    {
+      current_bytes += buffer->getTotalBytes();
+    }
+  }
+  buffers.insert(subtree_buffers.begin(), subtree_buffers.end());
+
+  report["current_bytes"].set_int64(current_bytes);
+  report["external_bytes"].set_int64(external_bytes);
+  report["num_views"].set_int64(num_views);
+  report["num_external_views"].set_int64(num_external_views);
+
+  if(peaks != nullptr)
+  {
+    const auto it = peaks->find(group->getPathName());
+    const IndexType peak_bytes =
+      (it != peaks->end()) ? it->second.peak_bytes : 0;
+    report["peak_bytes"].set_int64(std::max(peak_bytes, current_bytes));
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Fill the memory report of an allocator, or of all of them.
+ *
+ *************************************************************************
+ */
+void reportMemoryStats(const DataStore::MemoryStats& stats, Node& report)
+{
+  report["current_bytes"].set_int64(stats.current_bytes);
+  report["peak_bytes"].set_int64(stats.peak_bytes);
+  report["num_allocations"].set_int64(stats.num_allocations);
+}
+
+}  // end anonymous namespace
+
+/*
+ *************************************************************************
+ *
+ * Enable or disable memory tracking; enabling it charges the Buffers
+ * allocated at that time.
+ *
+ *************************************************************************
+ */
+void DataStore::setMemoryTracking(bool enabled)
+{
+  if(enabled == m_memory_tracking)
+  {
+    return;
+  }
+
+  m_memory_total = MemoryStats();
+  m_memory_by_allocator.clear();
+  m_memory_by_path.clear();
+
+  for(auto& buffer : buffers())
+  {
+    buffer.m_tracked_bytes = 0;
+    buffer.m_tracked_allocator_id = INVALID_ALLOCATOR_ID;
+    buffer.m_tracked_paths.clear();
+  }
+
+  m_memory_tracking = enabled;
+
+  if(m_memory_tracking)
+  {
+    for(auto& buffer : buffers())
+    {
+      trackBufferMemory(&buffer);
+    }
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Reset the peak bytes of the memory tracking to the current bytes.
+ *
+ *************************************************************************
+ */
+void DataStore::resetMemoryPeaks()
+{
+  m_memory_total.peak_bytes = m_memory_total.current_bytes;
+  for(auto& entry : m_memory_by_allocator)
+  {
+    entry.second.peak_bytes = entry.second.current_bytes;
+  }
+  for(auto& entry : m_memory_by_path)
+  {
+    entry.second.peak_bytes = entry.second.current_bytes;
+  }
+}
+
+/*
+ *************************************************************************
+ *
+ * Fill a Conduit Node with a report of the memory held by the DataStore.
+ *
+ *************************************************************************
+ */
+void DataStore::getMemoryReport(Node& report) const
+{
+  report.reset();
+
+  IndexType num_buffers = 0;
+  IndexType allocated_bytes = 0;
+  for(const auto& buffer : buffers())
+  {
+    ++num_buffers;
+    if(buffer.isAllocated())
+    {
+      allocated_bytes += buffer.getTotalBytes();
+    }
+  }
+  report["buffers/num_buffers"].set_int64(num_buffers);
+  report["buffers/allocated_bytes"].set_int64(allocated_bytes);
+
+  if(m_memory_tracking)
+  {
+    reportMemoryStats(m_memory_total, report["total"]);
+    for(const auto& entry : m_memory_by_allocator)
+    {
+      reportMemoryStats(entry.second,
+                        report["allocators"][std::to_string(entry.first)]);
+    }
+  }
+
+  std::set<const Buffer*> root_buffers;
+  reportGroupMemory(m_RootGroup,
+                    m_memory_tracking ? &m_memory_by_path : nullptr,
+                    report["hierarchy"],
+                    root_buffers);
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to add bytes to memory stats and update the peak.
+ *
+ *************************************************************************
+ */
+void DataStore::addBytes(MemoryStats& stats, IndexType bytes)
+{
+  stats.current_bytes += bytes;
+  stats.peak_bytes = std::max(stats.peak_bytes, stats.current_bytes);
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to move the memory tracked for a Buffer to its current
+ * bytes, allocator and Group paths.
+ *
+ * A Buffer is charged to the Group of each of its Views and to all of
+ * their ancestors, once per Group.
+ *
+ *************************************************************************
+ */
+void DataStore::trackBufferMemory(Buffer* buffer)
+{
+  const IndexType bytes = buffer->isAllocated() ? buffer->getTotalBytes() : 0;
+  const int allocator_id =
+    (bytes > 0) ? buffer->getAllocatorID() : INVALID_ALLOCATOR_ID;
+
+  std::set<std::string> path_set;
+  if(bytes > 0)
+  {
+    for(const View* view : buffer->m_views)
+    {
+      const Group* group = view->getOwningGroup();
+      while(group != nullptr)
+      {
+        if(!path_set.insert(group->getPathName()).second || group->isRoot())
+        {
+          break;
+        }
+        group = group->getParent();
+      }
+    }
+  }
+  std::vector<std::string> paths(path_set.begin(), path_set.end());
+
+  const IndexType old_bytes = buffer->m_tracked_bytes;
+  const int old_allocator_id = buffer->m_tracked_allocator_id;
+
+  if(bytes == old_bytes && allocator_id == old_allocator_id &&
+     paths == buffer->m_tracked_paths)
+  {
+    return;
+  }
+
+  // uncharge the previous state before charging the current one, so
+  // that peaks only reflect memory that is held at the same time
+  if(old_bytes > 0)
+  {
+    m_memory_total.current_bytes -= old_bytes;
+    m_memory_by_allocator[old_allocator_id].current_bytes -= old_bytes;
+    for(const auto& path : buffer->m_tracked_paths)
+    {
+      m_memory_by_path[path].current_bytes -= old_bytes;
+    }
+  }
+
+  if(bytes > 0)
+  {
+    addBytes(m_memory_total, bytes);
+    MemoryStats& allocator_stats = m_memory_by_allocator[allocator_id];
+    addBytes(allocator_stats, bytes);
+    for(const auto& path : paths)
+    {
+      addBytes(m_memory_by_path[path], bytes);
+    }
+
+    if(bytes != old_bytes || allocator_id != old_allocator_id)
+    {
+      ++m_memory_total.num_allocations;
+      ++allocator_stats.num_allocations;
+    }
+  }
+
+  buffer->m_tracked_bytes = bytes;
+  buffer->m_tracked_allocator_id = allocator_id;
+  buffer->m_tracked_paths.swap(paths);
+}
+
 /*
  *************************************************************************
  *
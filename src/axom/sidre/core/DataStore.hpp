@@ -17,6 +17,8 @@
 #define SIDRE_DATASTORE_HPP_
 
 // Standard C++ headers
+#include <map>
+#include <string>
 #include <vector>
 #include <stack>
 
@@ -60,6 +62,12 @@ class MapCollection;
 class DataStore
 {
 public:
+  //
+  // Friend declarations to constrain usage via controlled access to
+  // private members.
+  //
+  friend class Buffer;
+
   using AttributeCollection = MapCollection<Attribute>;
   using BufferCollection = IndexedCollection<Buffer>;
 
@@ -411,6 +419,76 @@ public:
 
   //@}
 
+public:
+  //@{
+  //!  @name Methods to account for the memory held by the DataStore.
+
+  /*!
+   * \brief Current and peak bytes of an allocator or a Group subtree, and
+   *        number of (re)allocations of an allocator.
+   */
+  struct MemoryStats
+  {
+    IndexType current_bytes {0};
+    IndexType peak_bytes {0};
+    IndexType num_allocations {0};
+  };
+
+  /*!
+   * \brief Enable or disable tracking the memory of the DataStore's Buffers.
+   *
+   * While enabled, every (re)allocation and deallocation of a Buffer, and
+   * every change to the Views attached to it, updates the current and peak
+   * bytes held by the Buffer's allocator and by the Groups whose Views
+   * reference it, and by all of their ancestors.
+   *
+   * Enabling memory tracking starts from the Buffers allocated at that
+   * time.  Disabling it discards the tracked data.  Memory tracking is
+   * disabled by default, in which case its overhead is a single check per
+   * Buffer operation.
+   */
+  void setMemoryTracking(bool enabled);
+
+  /*!
+   * \brief Return true if memory tracking is enabled, else false.
+   */
+  bool isMemoryTracking() const { return m_memory_tracking; }
+
+  /*!
+   * \brief Reset the peak bytes of the memory tracking to the current bytes.
+   */
+  void resetMemoryPeaks();
+
+  /*!
+   * \brief Fill a Conduit Node with a report of the memory held by the
+   *        DataStore.
+   *
+   * The report holds, for the root Group at "hierarchy" and for each of its
+   * descendants at "groups/<name>" under its parent's entry:
+   *
+   *  - "current_bytes", the bytes of the Buffers referenced by the Views of
+   *    the Group's subtree, counting each Buffer once
+   *  - "external_bytes", the bytes of the external data described by the
+   *    Views of the subtree
+   *  - "num_views" and "num_external_views", the numbers of Views and of
+   *    external Views of the subtree
+   *  - "peak_bytes", the largest value of "current_bytes" while memory
+   *    tracking was enabled, only if it is enabled
+   *
+   * The totals of the allocated Buffers are at "buffers".  When memory
+   * tracking is enabled, the current and peak bytes and the number of
+   * (re)allocations are also reported for each allocator ID at
+   * "allocators/<ID>", and for all of them at "total".
+   *
+   * \note The peak bytes of a subtree are attributed when Buffers are
+   *       (re)allocated and attached to or detached from Views, hence a
+   *       View that is moved to another Group is counted in its new
+   *       subtree from its Buffer's next such change.
+   */
+  void getMemoryReport(Node& report) const;
+
+  //@}
+
 public:
   /*!
    * \brief Generate a Conduit Blueprint index based on a mesh in stored in
@@ -497,6 +575,18 @@ private:
 
   //@}
 
+  /*!
+   * \brief Private method to move the memory tracked for a Buffer from
+   *        the bytes, allocator and Group paths previously charged for it
+   *        to its current ones (callable only by Buffer methods).
+   */
+  void trackBufferMemory(Buffer* buffer);
+
+  /*!
+   * \brief Private method to add bytes to memory stats and update the peak.
+   */
+  static void addBytes(MemoryStats& stats, IndexType bytes);
+
 private:
   /// Root Group, created when DataStore object is created.
   Group* m_RootGroup;
@@ -509,6 +599,14 @@ private:
 
   /// Flag indicating whether SLIC logging environment was initialized in ctor.
   bool m_need_to_finalize_slic;
+
+  /// Flag indicating whether the memory of Buffers is tracked.
+  bool m_memory_tracking;
+
+  /// Tracked memory of all Buffers, by allocator ID and by Group path.
+  MemoryStats m_memory_total;
+  std::map<int, MemoryStats> m_memory_by_allocator;
+  std::map<std::string, MemoryStats> m_memory_by_path;
 };
 
 } /* end namespace sidre */
@@ -13,13 +13,13 @@
 #endif
 
 #include "axom/core/Macros.hpp"
-#include "axom/core/Path.hpp"
 
 // Sidre headers
 #include "ListCollection.hpp"
 #include "MapCollection.hpp"
 #include "Buffer.hpp"
 #include "DataStore.hpp"
+#include "PathHandle.hpp"
 
 namespace axom
 {
@@ -37,6 +37,52 @@ namespace sidre
 // support path syntax.
 const char Group::s_path_delimiter = '/';
 
+namespace
+{
+/*
+ * Finds the positions [first, last) of the next non-empty entry of a
+ * delimited path, starting the search at position pos.
+ * Returns false if there are no more entries.
+ */
+bool nextPathEntry(const std::string& path,
+                   char delim,
+                   std::string::size_type pos,
+                   std::string::size_type& first,
+                   std::string::size_type& last)
+{
+  first = path.find_first_not_of(delim, pos);
+  if(first == std::string::npos)
+  {
+    return false;
+  }
+
+  last = path.find(delim, first);
+  if(last == std::string::npos)
+  {
+    last = path.size();
+  }
+  return true;
+}
+
+/*
+ * Returns the index of the item with given name in a named collection.
+ * The cached index is used when it still refers to an item with that name;
+ * otherwise, it is updated with the result of a lookup by name.
+ */
+template <typename CollectionType>
+IndexType cachedItemIndex(const CollectionType* coll,
+                          const std::string& name,
+                          IndexType& cached_idx)
+{
+  if(!coll->hasItem(cached_idx) || coll->getItemName(cached_idx) != name)
+  {
+    cached_idx = coll->getItemIndex(name);
+  }
+  return cached_idx;
+}
+
+}  // end anonymous namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Private utility functions to cast ItemCollections to (named) MapCollections.
@@ -130,6 +176,28 @@ bool Group::hasView(const std::string& path) const
   return group->hasChildView(intpath);
 }
 
+/*
+ *************************************************************************
+ *
+ * Return true if Group owns a View with name or path of given handle;
+ * else false.
+ *
+ *************************************************************************
+ */
+bool Group::hasView(const PathHandle& handle) const
+{
+  const Group* group = walkPath(handle);
+
+  if(group == nullptr || handle.getNumEntries() == 0 || group->isUsingList())
+  {
+    return false;
+  }
+
+  return indexIsValid(cachedItemIndex(group->getNamedViews(),
+                                      handle.getName(),
+                                      handle.m_indices.back()));
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // View access methods.
@@ -191,6 +259,55 @@ const View* Group::getView(const std::string& path) const
   return group->getNamedViews()->getItem(intpath);
 }
 
+/*
+ *************************************************************************
+ *
+ * Return pointer to non-const View with name or path of given handle
+ * if it exists.
+ *
+ *************************************************************************
+ */
+View* Group::getView(const PathHandle& handle)
+{
+  const Group* self = this;
+  return const_cast<View*>(self->getView(handle));
+}
+
+/*
+ *************************************************************************
+ *
+ * Return pointer to const View with name or path of given handle
+ * if it exists.
+ *
+ *************************************************************************
+ */
+const View* Group::getView(const PathHandle& handle) const
+{
+  const Group* group = walkPath(handle);
+
+  if(group == nullptr)
+  {
+    SLIC_CHECK_MSG(group != nullptr,
+                   SIDRE_GROUP_LOG_PREPEND << "Non-existent group in path "
+                                           << handle.getPath());
+    return nullptr;
+  }
+
+  IndexType idx = InvalidIndex;
+  if(handle.getNumEntries() > 0 && group->isUsingMap())
+  {
+    idx = cachedItemIndex(group->getNamedViews(),
+                          handle.getName(),
+                          handle.m_indices.back());
+  }
+
+  SLIC_CHECK_MSG(indexIsValid(idx),
+                 SIDRE_GROUP_LOG_PREPEND << "No View with name '"
+                                         << handle.getName() << "'");
+
+  return group->m_view_coll->getItem(idx);
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 //  Methods to create a View that has no associated data.
@@ -838,6 +955,28 @@ bool Group::hasGroup(const std::string& path) const
   }
 }
 
+/*
+ *************************************************************************
+ *
+ * Return true if this Group has a descendant Group with name or path of
+ * given handle; else false.
+ *
+ *************************************************************************
+ */
+bool Group::hasGroup(const PathHandle& handle) const
+{
+  const Group* group = walkPath(handle);
+
+  if(group == nullptr || handle.getNumEntries() == 0 || group->isUsingList())
+  {
+    return false;
+  }
+
+  return indexIsValid(cachedItemIndex(group->getNamedGroups(),
+                                      handle.getName(),
+                                      handle.m_indices.back()));
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Child Group access methods.
@@ -901,6 +1040,56 @@ const Group* Group::getGroup(const std::string& path) const
   return group->getNamedGroups()->getItem(intpath);
 }
 
+/*
+ *************************************************************************
+ *
+ * Return pointer to non-const child Group with name or path of given
+ * handle if it exists.
+ *
+ *************************************************************************
+ */
+Group* Group::getGroup(const PathHandle& handle)
+{
+  const Group* self = this;
+  return const_cast<Group*>(self->getGroup(handle));
+}
+
+/*
+ *************************************************************************
+ *
+ * Return pointer to const child Group with name or path of given handle
+ * if it exists.
+ *
+ *************************************************************************
+ */
+const Group* Group::getGroup(const PathHandle& handle) const
+{
+  const Group* group = walkPath(handle);
+
+  if(group == nullptr)
+  {
+    SLIC_CHECK_MSG(group != nullptr,
+                   SIDRE_GROUP_LOG_PREPEND << "Non-existent group in path "
+                                           << handle.getPath());
+    return nullptr;
+  }
+
+  IndexType idx = InvalidIndex;
+  if(handle.getNumEntries() > 0 && group->isUsingMap())
+  {
+    idx = cachedItemIndex(group->getNamedGroups(),
+                          handle.getName(),
+                          handle.m_indices.back());
+  }
+
+  SLIC_CHECK_MSG(indexIsValid(idx),
+                 SIDRE_GROUP_LOG_PREPEND
+                   << "Group has no descendant Group with name '"
+                   << handle.getPath() << "'.");
+
+  return group->m_group_coll->getItem(idx);
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 //  Methods for managing child Group objects in Group
@@ -1619,6 +1808,21 @@ void Group::loadExternalData(const std::string& path)
 #endif
 }
 
+/*
+ *************************************************************************
+ *
+ * PRIVATE method to copy Group to the Node written by the sidre_hdf5
+ * protocol.
+ *
+ *************************************************************************
+ */
+void Group::exportToSidreHDF5Layout(Node& n, const Attribute* attr) const
+{
+  exportTo(n["sidre"], attr);
+  createExternalLayout(n["sidre/external"], attr);
+  n["sidre_group_name"] = m_name;
+}
+
 // Functions that directly use the hdf5 API in their signature
 #ifdef AXOM_USE_HDF5
 
@@ -1639,9 +1843,7 @@ void Group::save(const hid_t& h5_id,
   if(protocol == "sidre_hdf5")
   {
     Node n;
-    exportTo(n["sidre"], attr);
-    createExternalLayout(n["sidre/external"], attr);
-    n["sidre_group_name"] = m_name;
+    exportToSidreHDF5Layout(n, attr);
     conduit::relay::io::hdf5_write(n, h5_id);
   }
   else if(protocol == "conduit_hdf5")
@@ -2332,40 +2534,35 @@ Group* Group::walkPath(std::string& path, bool create_groups_in_path)
 {
   Group* group_ptr = this;
 
-  // Split path into parts
-  std::vector<std::string> path_parts =
-    axom::Path(path, s_path_delimiter).parts();
-
-  if(path_parts.size() > 0)
+  std::string::size_type first, last;
+  if(nextPathEntry(path, s_path_delimiter, 0, first, last))
   {
-    // Find stopping point (right before last part of path)
-    std::vector<std::string>::const_iterator stop = path_parts.end() - 1;
-
-    // Navigate path down to desired Group
-    for(std::vector<std::string>::const_iterator iter = path_parts.begin();
-        iter < stop;
-        ++iter)
+    // Navigate path down to desired Group, stopping right before the last
+    // entry. The entries are not split out of the path; a single name
+    // buffer is reused for the lookup of each intermediate Group.
+    std::string name;
+    std::string::size_type next_first, next_last;
+    while(nextPathEntry(path, s_path_delimiter, last, next_first, next_last))
     {
-      if(group_ptr->hasChildGroup(*iter))
+      if(group_ptr != nullptr)
       {
-        group_ptr = group_ptr->getGroup(*iter);
-      }
-      else if(create_groups_in_path)
-      {
-        group_ptr = group_ptr->createGroup(*iter);
+        name.assign(path, first, last - first);
+        Group* child = group_ptr->getNamedGroups()->getItem(name);
 
-        if(group_ptr == nullptr)
+        if(child == nullptr && create_groups_in_path)
         {
-          iter = stop;
+          child = group_ptr->createGroup(name);
         }
+        group_ptr = child;
       }
-      else
-      {
-        iter = stop;
-        group_ptr = nullptr;
-      }
+
+      first = next_first;
+      last = next_last;
     }
-    path = path_parts.back();
+
+    // Reduce path to its last entry in place
+    path.erase(last);
+    path.erase(0, first);
   }
 
   return group_ptr;
@@ -2384,31 +2581,60 @@ const Group* Group::walkPath(std::string& path) const
 {
   const Group* group_ptr = this;
 
-  // Split path into parts
-  std::vector<std::string> path_parts =
-    axom::Path(path, s_path_delimiter).parts();
-
-  if(path_parts.size() > 0)
+  std::string::size_type first, last;
+  if(nextPathEntry(path, s_path_delimiter, 0, first, last))
   {
-    // Find stopping point (right before last part of path)
-    std::vector<std::string>::const_iterator stop = path_parts.end() - 1;
-
-    // Navigate path down to desired Group
-    for(std::vector<std::string>::const_iterator iter = path_parts.begin();
-        iter < stop;
-        ++iter)
+    // Navigate path down to desired Group, stopping right before the last
+    // entry. The entries are not split out of the path; a single name
+    // buffer is reused for the lookup of each intermediate Group.
+    std::string name;
+    std::string::size_type next_first, next_last;
+    while(nextPathEntry(path, s_path_delimiter, last, next_first, next_last))
     {
-      if(group_ptr->hasChildGroup(*iter))
-      {
-        group_ptr = group_ptr->getGroup(*iter);
-      }
-      else
+      if(group_ptr != nullptr)
       {
-        group_ptr = nullptr;
-        iter = stop;
+        name.assign(path, first, last - first);
+        group_ptr = group_ptr->getNamedGroups()->getItem(name);
       }
+
+      first = next_first;
+      last = next_last;
+    }
+
+    // Reduce path to its last entry in place
+    path.erase(last);
+    path.erase(0, first);
+  }
+
+  return group_ptr;
+}
+
+/*
+ *************************************************************************
+ *
+ * PRIVATE const method to walk down the path of a PathHandle to the
+ * next-to-last entry, using and updating the indices cached in the handle.
+ *
+ * If an error is encountered, this private function will return nullptr
+ *
+ *************************************************************************
+ */
+const Group* Group::walkPath(const PathHandle& handle) const
+{
+  const Group* group_ptr = this;
+
+  const std::size_t num_entries = handle.m_entries.size();
+  for(std::size_t i = 0; i + 1 < num_entries && group_ptr != nullptr; ++i)
+  {
+    if(group_ptr->isUsingList())
+    {
+      return nullptr;
     }
-    path = path_parts.back();
+
+    const MapCollection<Group>* groups = group_ptr->getNamedGroups();
+    IndexType idx =
+      cachedItemIndex(groups, handle.m_entries[i], handle.m_indices[i]);
+    group_ptr = groups->getItem(idx);
   }
 
   return group_ptr;
@@ -54,6 +54,7 @@ namespace sidre
 class Buffer;
 class Group;
 class DataStore;
+class PathHandle;
 template <typename TYPE>
 class ItemCollection;
 template <typename TYPE>
@@ -128,6 +129,8 @@ public:
   //
   friend class DataStore;
   friend class View;
+  friend class PathHandle;
+  friend class IOManager;
 
   using ViewCollection = ItemCollection<View>;
   using GroupCollection = ItemCollection<Group>;
@@ -279,6 +282,12 @@ public:
    */
   bool hasView(const std::string& path) const;
 
+  /*!
+   * \brief Return true if Group includes a descendant View with the
+   * name or path of the given PathHandle; else false.
+   */
+  bool hasView(const PathHandle& handle) const;
+
   /*!
    * \brief Return true if this Group owns a View with given name (not path);
    * else false.
@@ -328,6 +337,25 @@ public:
    */
   const View* getView(const std::string& path) const;
 
+  /*!
+   * \brief Return pointer to non-const View with the name or path of the
+   * given PathHandle.
+   *
+   * This is equivalent to getView(handle.getPath()), but avoids splitting
+   * the path and reuses the child indices cached in the handle.
+   *
+   * If no such View exists, nullptr is returned.
+   */
+  View* getView(const PathHandle& handle);
+
+  /*!
+   * \brief Return pointer to const View with the name or path of the
+   * given PathHandle.
+   *
+   * If no such View exists, nullptr is returned.
+   */
+  const View* getView(const PathHandle& handle) const;
+
   /*!
    * \brief Return pointer to non-const View with given index.
    *
@@ -830,6 +858,12 @@ public:
    */
   bool hasGroup(const std::string& path) const;
 
+  /*!
+   * \brief Return true if this Group has a descendant Group with the
+   * name or path of the given PathHandle; else false.
+   */
+  bool hasGroup(const PathHandle& handle) const;
+
   /*!
    * \brief Return true if this Group has a child Group with given
    * name; else false.
@@ -879,6 +913,25 @@ public:
    */
   Group const* getGroup(const std::string& path) const;
 
+  /*!
+   * \brief Return pointer to non-const child Group with the name or path
+   * of the given PathHandle.
+   *
+   * This is equivalent to getGroup(handle.getPath()), but avoids splitting
+   * the path and reuses the child indices cached in the handle.
+   *
+   * If no such Group exists, nullptr is returned.
+   */
+  Group* getGroup(const PathHandle& handle);
+
+  /*!
+   * \brief Return pointer to const child Group with the name or path
+   * of the given PathHandle.
+   *
+   * If no such Group exists, nullptr is returned.
+   */
+  Group const* getGroup(const PathHandle& handle) const;
+
   /*!
    * \brief Return pointer to non-const immediate child Group with given index.
    *
@@ -1595,6 +1648,15 @@ private:
                 const Attribute* attr,
                 std::set<IndexType>& buffer_indices) const;
 
+  /*!
+   * \brief Private method to copy Group to the Conduit Node that save()
+   * writes to an hdf5 handle with the sidre_hdf5 protocol.
+   *
+   * This lets IOManager gather the Nodes of several ranks and write them
+   * to a file together.
+   */
+  void exportToSidreHDF5Layout(conduit::Node& n, const Attribute* attr) const;
+
   /*!
    * \brief Private method to build a Group hierarchy from Conduit Node.
    *
@@ -1645,6 +1707,16 @@ private:
    */
   const Group* walkPath(std::string& path) const;
 
+  /*!
+   * \brief Const private method that returns the Group that is the
+   * next-to-last entry in the path of the given PathHandle, or nullptr
+   * if a Group along the path does not exist.
+   *
+   * The child indices cached in the handle are validated against the entry
+   * names and are updated when they are stale.
+   */
+  const Group* walkPath(const PathHandle& handle) const;
+
   /*!
    * \brief Private method. If allocatorID is a valid allocator ID then return
    *  it. Otherwise return the ID of the default allocator of the owning group.
@@ -1153,12 +1153,13 @@ void MFEMSidreDataCollection::addScalarBasedField(const std::string& field_name,
                                                   mfem::Vector* field,
                                                   const std::string& buffer_name,
                                                   IndexType offset,
-                                                  const int num_dofs)
+                                                  const int num_dofs,
+                                                  bool wrap_external)
 {
   sidre::Group* grp = m_bp_grp->getGroup("fields/" + field_name);
   SLIC_ASSERT_MSG(grp != nullptr, "field " << field_name << " does not exist");
 
-  if(field->GetData() == nullptr)
+  if(field->GetData() == nullptr && !wrap_external)
   {
     AllocNamedBuffer(buffer_name, offset + num_dofs);
     // field->data is set below.
@@ -1172,13 +1173,21 @@ void MFEMSidreDataCollection::addScalarBasedField(const std::string& field_name,
    *              -- array of size num_dofs
    */
 
+  // When wrapping the field's data, replace an existing "values" View, e.g.
+  // one that was loaded from file.  Its Buffer is only destroyed if no other
+  // View, such as a named buffer, still references it.
+  if(wrap_external && grp->hasView("values"))
+  {
+    grp->destroyViewAndData("values");
+  }
+
   // Make sure we have the View "values".
   sidre::View* vv = alloc_view(grp, "values");
 
   // Describe and apply the "values" View.
   // If the data store has buffer for field_name (e.g. AllocNamedBuffer was
   // called, or it was loaded from file), use that buffer.
-  if(named_buffers_grp()->hasView(buffer_name))
+  if(!wrap_external && named_buffers_grp()->hasView(buffer_name))
   {
     sidre::View* bv = named_buffers_grp()->getView(buffer_name);
     SLIC_ASSERT_MSG(bv->hasBuffer() && bv->isDescribed(), "");
@@ -1214,7 +1223,8 @@ void MFEMSidreDataCollection::addVectorBasedGridFunction(
   const std::string& field_name,
   GridFunction* gf,
   const std::string& buffer_name,
-  IndexType offset)
+  IndexType offset,
+  bool wrap_external)
 {
   sidre::Group* grp = m_bp_grp->getGroup("fields/" + field_name);
   SLIC_ASSERT_MSG(grp != nullptr, "field " << field_name << " does not exist");
@@ -1226,7 +1236,7 @@ void MFEMSidreDataCollection::addVectorBasedGridFunction(
   int ndof = gf->FESpace()->GetNDofs();
   Ordering::Type ordering = gf->FESpace()->GetOrdering();
 
-  if(gf->GetData() == nullptr)
+  if(gf->GetData() == nullptr && !wrap_external)
   {
     AllocNamedBuffer(buffer_name, offset + vdim * ndof);
     // gf->data is set below.
@@ -1246,15 +1256,25 @@ void MFEMSidreDataCollection::addVectorBasedGridFunction(
   // Get/create the Group "values".
   sidre::Group* vg = alloc_group(grp, "values");
 
+  // When wrapping the grid function's data, replace any existing component
+  // Views, e.g. ones that were loaded from file.  Their Buffers are only
+  // destroyed if no other View, such as a named buffer, still references them.
+  if(wrap_external)
+  {
+    vg->destroyViewsAndData();
+  }
+
   // Create the Views "x0", "x1", etc inside the "values" Group, vg.
   // If we have a named buffer for field_name, attach it to the Views;
   // otherwise set the Views to use gf->GetData() as external data.
+  // Either way, the components are strided Views over a single array,
+  // so neither ordering requires a copy of the data.
   sidre::DataType dtype = sidre::DataType::c_double(ndof);
   const int entry_stride = (ordering == Ordering::byNODES ? 1 : vdim);
   const int vdim_stride = (ordering == Ordering::byNODES ? ndof : 1);
   dtype.set_stride(dtype.stride() * entry_stride);
 
-  if(named_buffers_grp()->hasView(buffer_name))
+  if(!wrap_external && named_buffers_grp()->hasView(buffer_name))
   {
     sidre::View* bv = named_buffers_grp()->getView(buffer_name);
     SLIC_ASSERT_MSG(bv->hasBuffer() && bv->isDescribed(), "");
@@ -1335,6 +1355,31 @@ void MFEMSidreDataCollection::RegisterField(const std::string& field_name,
                                             GridFunction* gf,
                                             const std::string& buffer_name,
                                             IndexType offset)
+{
+  registerGridFunction(field_name, gf, buffer_name, offset, false);
+}
+
+void MFEMSidreDataCollection::RegisterExternalField(const std::string& field_name,
+                                                    GridFunction* gf)
+{
+  SLIC_WARNING_IF(gf != nullptr && gf->GetData() == nullptr && gf->Size() > 0,
+                  "Field with the name '"
+                    << field_name
+                    << "' has no data to wrap, so nothing was done.");
+  if(gf != nullptr && gf->GetData() == nullptr && gf->Size() > 0)
+  {
+    return;
+  }
+
+  registerGridFunction(field_name, gf, field_name, 0, true);
+}
+
+// private method
+void MFEMSidreDataCollection::registerGridFunction(const std::string& field_name,
+                                                   GridFunction* gf,
+                                                   const std::string& buffer_name,
+                                                   IndexType offset,
+                                                   bool wrap_external)
 {
   #ifdef AXOM_DEBUG
   SLIC_WARNING_IF(field_name.empty(), "Name for GridFunction was empty");
@@ -1411,12 +1456,17 @@ void MFEMSidreDataCollection::RegisterField(const std::string& field_name,
                         gf,
                         buffer_name,
                         offset,
-                        gf->FESpace()->GetVSize());
+                        gf->FESpace()->GetVSize(),
+                        wrap_external);
   }
   else  // vector valued
   {
     // Set the Group "<m_bp_grp>/fields/<field_name>/values"
-    addVectorBasedGridFunction(field_name, gf, buffer_name, offset);
+    addVectorBasedGridFunction(field_name,
+                               gf,
+                               buffer_name,
+                               offset,
+                               wrap_external);
   }
 
   // Register field_name in the blueprint_index group.
@@ -1441,6 +1491,33 @@ void MFEMSidreDataCollection::RegisterQField(const std::string& field_name,
                                              mfem::QuadratureFunction* qf,
                                              const std::string& buffer_name,
                                              axom::sidre::IndexType offset)
+{
+  registerQuadratureFunction(field_name, qf, buffer_name, offset, false);
+}
+
+void MFEMSidreDataCollection::RegisterExternalQField(
+  const std::string& field_name,
+  mfem::QuadratureFunction* qf)
+{
+  SLIC_WARNING_IF(qf != nullptr && qf->GetData() == nullptr && qf->Size() > 0,
+                  "QField with the name '"
+                    << field_name
+                    << "' has no data to wrap, so nothing was done.");
+  if(qf != nullptr && qf->GetData() == nullptr && qf->Size() > 0)
+  {
+    return;
+  }
+
+  registerQuadratureFunction(field_name, qf, field_name, 0, true);
+}
+
+// private method
+void MFEMSidreDataCollection::registerQuadratureFunction(
+  const std::string& field_name,
+  mfem::QuadratureFunction* qf,
+  const std::string& buffer_name,
+  axom::sidre::IndexType offset,
+  bool wrap_external)
 {
   #ifdef AXOM_DEBUG
   SLIC_WARNING_IF(field_name.empty(), "Name for QuadratureFunction was empty");
@@ -1514,7 +1591,12 @@ void MFEMSidreDataCollection::RegisterQField(const std::string& field_name,
   v = alloc_view(grp, "topology")->setString("mesh");
 
   // Set the View "<m_bp_grp>/fields/<field_name>/values"
-  addScalarBasedField(field_name, qf, buffer_name, offset, qf->Size());
+  addScalarBasedField(field_name,
+                      qf,
+                      buffer_name,
+                      offset,
+                      qf->Size(),
+                      wrap_external);
 
   // Register field_name in the blueprint_index group.
   if(myid == 0)
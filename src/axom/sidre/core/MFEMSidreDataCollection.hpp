@@ -298,6 +298,28 @@ public:
                       const std::string& buffer_name,
                       axom::sidre::IndexType offset);
 
+  /// Register a GridFunction in the Sidre DataStore without moving its data.
+  /** Unlike RegisterField(), this method never allocates or attaches a named
+      buffer and never changes @a gf's data array: the data is always wrapped
+      as external data in the DataStore.  The components of a vector-valued
+      @a gf are described as strided Views into its data for either ordering
+      (byNODES or byVDIM), and Save() writes them directly from that array.
+      Any data that the DataStore previously held for @a field_name, e.g.
+      after a Load(), is released.
+
+      @note @a gf's data must remain valid while it is registered.
+      @note If @a gf has a nonzero size but no data, the method does nothing.
+   */
+  void RegisterExternalField(const std::string& field_name,
+                             mfem::GridFunction* gf);
+
+  /// Register a mfem::QuadratureFunction in the Sidre DataStore without
+  /// moving its data.
+  /** This is the QuadratureFunction counterpart of RegisterExternalField().
+      @sa RegisterExternalField() */
+  void RegisterExternalQField(const std::string& field_name,
+                              mfem::QuadratureFunction* qf);
+
   /// Registers an attribute field in the Sidre DataStore
   /** The registration process is similar to that of RegisterField()
       The attribute field is associated with the elements of the mesh
@@ -590,6 +612,22 @@ private:
 
   // Private helper functions
 
+  /** @brief Implements RegisterField() and RegisterExternalField(); when
+      @a wrap_external is true, @a gf's data is always used as external data */
+  void registerGridFunction(const std::string& field_name,
+                            mfem::GridFunction* gf,
+                            const std::string& buffer_name,
+                            IndexType offset,
+                            bool wrap_external);
+
+  /** @brief Implements RegisterQField() and RegisterExternalQField(); when
+      @a wrap_external is true, @a qf's data is always used as external data */
+  void registerQuadratureFunction(const std::string& field_name,
+                                  mfem::QuadratureFunction* qf,
+                                  const std::string& buffer_name,
+                                  IndexType offset,
+                                  bool wrap_external);
+
   void RegisterFieldInBPIndex(const std::string& field_name,
                               const int number_of_components);
   void DeregisterFieldInBPIndex(const std::string& field_name);
@@ -626,12 +664,15 @@ private:
    * \note Handles cases where hierarchy is already set up,
    *      where the data was allocated by this data collection
    *      and where the gridfunction data is external to Sidre
+   * \note When \a wrap_external is true, the field's data is always used
+   *      as external data and named buffers are ignored
    */
   void addScalarBasedField(const std::string& field_name,
                            mfem::Vector* field,
                            const std::string& buffer_name,
                            IndexType offset,
-                           const int num_dofs);
+                           const int num_dofs,
+                           bool wrap_external);
 
   /**
    * \brief A private helper function to set up the views associated with the
@@ -641,11 +682,14 @@ private:
    * \note Handles cases where hierarchy is already set up,
    *      where the data was allocated by this data collection
    *      and where the gridfunction data is external to Sidre
+   * \note When \a wrap_external is true, the grid function's data is always
+   *      used as external data and named buffers are ignored
    */
   void addVectorBasedGridFunction(const std::string& field_name,
                                   mfem::GridFunction* gf,
                                   const std::string& buffer_name,
-                                  IndexType offset);
+                                  IndexType offset,
+                                  bool wrap_external);
 
   /** @brief A private helper function to set up the Views associated with
       attribute field named @a field_name */
@@ -0,0 +1,56 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+// Associated header file
+#include "PathHandle.hpp"
+
+#include "axom/core/Path.hpp"
+
+// Sidre headers
+#include "Group.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+/*
+ *************************************************************************
+ *
+ * Split the path into its entries; the index cache starts out empty.
+ *
+ *************************************************************************
+ */
+PathHandle::PathHandle(const std::string& path)
+  : m_path(path)
+  , m_entries(axom::Path(path, Group::s_path_delimiter).parts())
+  , m_indices(m_entries.size(), InvalidIndex)
+{ }
+
+/*
+ *************************************************************************
+ *
+ * Return the last entry in the path (sidre::InvalidName if none).
+ *
+ *************************************************************************
+ */
+const std::string& PathHandle::getName() const
+{
+  return m_entries.empty() ? InvalidName : m_entries.back();
+}
+
+/*
+ *************************************************************************
+ *
+ * Invalidate all cached item indices.
+ *
+ *************************************************************************
+ */
+void PathHandle::resetCache() const
+{
+  m_indices.assign(m_entries.size(), InvalidIndex);
+}
+
+} /* end namespace sidre */
+} /* end namespace axom */
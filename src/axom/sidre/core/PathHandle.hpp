@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/*!
+ ******************************************************************************
+ *
+ * \file PathHandle.hpp
+ *
+ * \brief   Header file containing definition of PathHandle class.
+ *
+ ******************************************************************************
+ */
+
+#ifndef SIDRE_PATHHANDLE_HPP_
+#define SIDRE_PATHHANDLE_HPP_
+
+// Standard C++ headers
+#include <string>
+#include <vector>
+
+// Other axom headers
+#include "axom/config.hpp"
+
+// Sidre project headers
+#include "axom/sidre/core/SidreTypes.hpp"
+
+namespace axom
+{
+namespace sidre
+{
+class Group;
+
+/*!
+ * \class PathHandle
+ *
+ * \brief PathHandle is a precomputed form of a delimited path string for
+ *  repeated lookups of a View or Group relative to a Group.
+ *
+ * The path is split into its entries once, when the handle is constructed.
+ * The first time a handle is used to access an item, the index of each
+ * entry within its parent Group is cached in the handle. Subsequent lookups
+ * through the handle check each cached index against the entry name and
+ * fall back to a name lookup only when the cached index is stale, e.g., when
+ * an item along the path was destroyed and recreated. A handle is therefore
+ * always safe to use, and can be applied to different Groups.
+ *
+ * Example:
+ *
+ *      const sidre::PathHandle density("fields/density/values");
+ *      for(int cycle = 0; cycle < ncycles; ++cycle)
+ *      {
+ *        sidre::View* view = root->getView(density);
+ *        ...
+ *      }
+ *
+ * A handle whose path has a single entry acts as a name handle for a direct
+ * child of a Group.
+ *
+ * \note The index cache is updated through const methods, so a PathHandle
+ *  should not be shared among threads that use it concurrently.
+ *
+ * \sa Group::getView(const PathHandle&), Group::getGroup(const PathHandle&)
+ */
+class PathHandle
+{
+public:
+  /*!
+   * \brief Constructs a handle for the given path.
+   *
+   * Empty path entries, e.g., from repeated or leading delimiters,
+   * are skipped, as they are for the string-based path methods in Group.
+   */
+  explicit PathHandle(const std::string& path);
+
+  /*!
+   * \brief Return the path string used to construct the handle.
+   */
+  const std::string& getPath() const { return m_path; }
+
+  /*!
+   * \brief Return the number of (non-empty) entries in the path.
+   */
+  IndexType getNumEntries() const
+  {
+    return static_cast<IndexType>(m_entries.size());
+  }
+
+  /*!
+   * \brief Return the name of the entry with the given index in the path.
+   */
+  const std::string& getEntry(IndexType idx) const
+  {
+    return m_entries[static_cast<std::size_t>(idx)];
+  }
+
+  /*!
+   * \brief Return the last entry in the path; this is the name of the
+   *  View or Group that the handle refers to.
+   */
+  const std::string& getName() const;
+
+  /*!
+   * \brief Discards the cached item indices in the handle.
+   */
+  void resetCache() const;
+
+private:
+  friend class Group;
+
+  std::string m_path;
+  std::vector<std::string> m_entries;
+
+  /// Cached index of each path entry within its parent Group
+  mutable std::vector<IndexType> m_indices;
+};
+
+} /* end namespace sidre */
+} /* end namespace axom */
+
+#endif /* SIDRE_PATHHANDLE_HPP_ */
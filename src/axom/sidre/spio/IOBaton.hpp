@@ -80,6 +80,18 @@ public:
     return m_my_rank < m_first_regular_set_rank ? m_set_size + 1 : m_set_size;
   }
 
+  /*!
+   * \brief Get the integer id of the local rank's set.
+   *
+   * Unlike wait(), this does not wait for control to pass to the local rank.
+   */
+  int getSetId() const { return m_set_id; }
+
+  /*!
+   * \brief Get the first (lowest) rank in the local rank's set.
+   */
+  int getFirstRankInSet() const { return m_my_rank - m_rank_within_set; }
+
   /*!
    * \brief Tells if the local rank is the first (lowest) in its set.
    */
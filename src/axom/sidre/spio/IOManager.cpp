@@ -34,6 +34,9 @@
 
 namespace
 {
+/// MPI tag of the messages that gather Groups on the aggregator ranks
+constexpr int AGGREGATE_WRITE_TAG = 1;
+
 /*!
  *  Utility function to broadcast a string from rank 0 to all other ranks
  */
@@ -69,6 +72,8 @@ namespace axom
 {
 namespace sidre
 {
+constexpr std::size_t IOManager::DEFAULT_AGGREGATE_BUFFER_BYTES;
+
 /*
  *************************************************************************
  *
@@ -82,6 +87,8 @@ IOManager::IOManager(MPI_Comm comm, bool use_scr)
   , m_baton(nullptr)
   , m_mpi_comm(comm)
   , m_use_scr(use_scr)
+  , m_aggregate_writes(false)
+  , m_aggregate_buffer_bytes(DEFAULT_AGGREGATE_BUFFER_BYTES)
 {
   MPI_Comm_size(comm, &m_comm_size);
   MPI_Comm_rank(comm, &m_my_rank);
@@ -145,6 +152,19 @@ std::string IOManager::correspondingRelayProtocol(const std::string& sidre_proto
   return DEFAULT_PROTOCOL;
 }
 
+/*
+ *************************************************************************
+ *
+ * Set whether writes are aggregated on the first rank of each set.
+ *
+ *************************************************************************
+ */
+void IOManager::setAggregateWrites(bool aggregate, std::size_t buffer_bytes)
+{
+  m_aggregate_writes = aggregate;
+  m_aggregate_buffer_bytes = buffer_bytes;
+}
+
 /*
  *************************************************************************
  *
@@ -188,7 +208,16 @@ void IOManager::write(sidre::Group* datagroup,
 
   std::string root_name = output_base + ".root";
 
-  if(protocol == "sidre_hdf5")
+  if(protocol == "sidre_hdf5" && m_aggregate_writes)
+  {
+#ifdef AXOM_USE_HDF5
+    writeAggregatedSidreHDF5(datagroup, root_name, num_files);
+#else
+    SLIC_WARNING("'sidre_hdf5' protocol only available "
+                 << "when axom is configured with hdf5");
+#endif /* AXOM_USE_HDF5 */
+  }
+  else if(protocol == "sidre_hdf5")
   {
 #ifdef AXOM_USE_HDF5
     std::string file_pattern = getHDF5FilePattern(root_name);
@@ -246,6 +275,7 @@ void IOManager::write(sidre::Group* datagroup,
     SLIC_WARNING("'sidre_hdf5' protocol only available "
                  << "when axom is configured with hdf5");
 #endif /* AXOM_USE_HDF5 */
+    (void)m_baton->pass();
   }
   else
   {
@@ -254,8 +284,8 @@ void IOManager::write(sidre::Group* datagroup,
 
     std::string obase = file_name + "." + protocol;
     datagroup->save(obase, protocol);
+    (void)m_baton->pass();
   }
-  (void)m_baton->pass();
 
   MPI_Barrier(m_mpi_comm);
 }
@@ -678,6 +708,96 @@ std::string IOManager::getHDF5FilePattern(const std::string& root_name)
   return file_pattern;
 }
 
+/*
+ *************************************************************************
+ *
+ * Write to sidre_hdf5 files, gathering the data of each file on one rank.
+ *
+ *************************************************************************
+ */
+void IOManager::writeAggregatedSidreHDF5(sidre::Group* datagroup,
+                                         const std::string& root_name,
+                                         int num_files)
+{
+  std::string file_pattern = getHDF5FilePattern(root_name);
+
+  // Ranks share files in contiguous sets, as when taking turns
+  const int set_id = m_baton->getSetId();
+  const int aggregator = m_baton->getFirstRankInSet();
+  const int set_end = aggregator + m_baton->setSize();
+
+  auto getGroupName = [=](int rank) {
+    return (m_comm_size != num_files) ? fmt::sprintf("datagroup_%07d", rank)
+                                      : std::string("datagroup");
+  };
+
+  // Phase one: the ranks send their serialized Groups to the aggregator
+  conduit::Node local;
+  datagroup->exportToSidreHDF5Layout(local, nullptr);
+
+  if(m_my_rank != aggregator)
+  {
+    conduit::relay::mpi::send_using_schema(local,
+                                           aggregator,
+                                           AGGREGATE_WRITE_TAG,
+                                           m_mpi_comm);
+    return;
+  }
+
+  // Phase two: the aggregator writes the Groups of its set to its file
+  std::string hdf5_name = getFileNameForRank(file_pattern, root_name, set_id);
+  hdf5_name = getSCRPath(hdf5_name);
+
+  // no need to create directories in SCR
+  if(!m_use_scr)
+  {
+    std::string dir_name;
+    utilities::filesystem::getDirName(dir_name, hdf5_name);
+    if(!dir_name.empty())
+    {
+      utilities::filesystem::makeDirsForPath(dir_name);
+    }
+  }
+  hid_t h5_file_id = conduit::relay::io::hdf5_create_file(hdf5_name);
+  SLIC_ASSERT(h5_file_id >= 0);
+
+  conduit::Node gathered;
+  gathered[getGroupName(m_my_rank)].set_external(local);
+  std::size_t gathered_bytes = local.total_bytes_compact();
+
+  for(int rank = m_my_rank + 1; rank < set_end; ++rank)
+  {
+    // write the gathered Groups once they fill the buffer
+    if(gathered_bytes >= m_aggregate_buffer_bytes &&
+       gathered.number_of_children() > 0)
+    {
+      conduit::relay::io::hdf5_write(gathered, h5_file_id);
+      gathered.reset();
+      gathered_bytes = 0;
+    }
+
+    conduit::Node& member = gathered[getGroupName(rank)];
+    conduit::relay::mpi::recv_using_schema(member,
+                                           rank,
+                                           AGGREGATE_WRITE_TAG,
+                                           m_mpi_comm);
+    gathered_bytes += member.total_bytes_compact();
+  }
+
+  if(gathered.number_of_children() > 0)
+  {
+    conduit::relay::io::hdf5_write(gathered, h5_file_id);
+  }
+
+  herr_t status;
+  AXOM_UNUSED_VAR(status);
+
+  status = H5Fflush(h5_file_id, H5F_SCOPE_LOCAL);
+  SLIC_ASSERT(status >= 0);
+  status = H5Fclose(h5_file_id);
+  SLIC_ASSERT(status >= 0);
+}
+
 /*
  *************************************************************************
  *
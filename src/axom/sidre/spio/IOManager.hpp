@@ -27,6 +27,9 @@
 
 #include "mpi.h"
 
+// C/C++ includes
+#include <cstddef>
+
 namespace axom
 {
 namespace sidre
@@ -39,7 +42,9 @@ namespace sidre
  * This class handles the bookkeeping and organizing tasks that must be done
  * before calling Group's I/O methods.  It uses IOBaton to control the
  * parallel I/O operations, such that one rank at a time interacts with any
- * particular output file.
+ * particular output file.  Alternatively, writes may be aggregated such that
+ * one rank writes the data of all the ranks that share an output file, see
+ * setAggregateWrites().
  */
 class IOManager
 {
@@ -109,6 +114,46 @@ public:
              const std::string& protocol,
              const std::string& tree_pattern = "datagroup");
 
+  /*!
+   * \brief Default size of the buffer that aggregates the data of the
+   *  ranks sharing a file, see setAggregateWrites().
+   */
+  static constexpr std::size_t DEFAULT_AGGREGATE_BUFFER_BYTES = 1 << 28;
+
+  /*!
+   * \brief set whether write() aggregates the data of the ranks that
+   * share an output file
+   *
+   * By default, the ranks that share an output file take turns, such that
+   * each rank opens the file, writes its own Group and closes the file
+   * while the other ranks of its set wait.
+   *
+   * When writes are aggregated, the first rank of each set instead gathers
+   * the serialized Groups of the other ranks of its set over MPI, and writes
+   * them to the file, which it opens only once.  The aggregator writes the
+   * gathered Groups together whenever they exceed buffer_bytes, hence
+   * larger buffers give fewer and larger writes at the cost of memory on
+   * the aggregator ranks.
+   *
+   * The output files have the same layout with or without aggregation,
+   * and are read with read().
+   *
+   * \note Aggregation only applies to the sidre_hdf5 protocol.  Other
+   * protocols are written without aggregation.
+   *
+   * \param aggregate     true to aggregate writes, false to take turns
+   * \param buffer_bytes  number of bytes an aggregator gathers before it
+   *                      writes them to its file
+   */
+  void setAggregateWrites(bool aggregate,
+                          std::size_t buffer_bytes = DEFAULT_AGGREGATE_BUFFER_BYTES);
+
+  /*!
+   * \brief Tells if write() aggregates the data of the ranks that share an
+   * output file.
+   */
+  bool getAggregateWrites() const { return m_aggregate_writes; }
+
   /*!
    * \brief write additional group to existing root file
    *
@@ -341,6 +386,16 @@ private:
 #ifdef AXOM_USE_HDF5
   std::string getHDF5FilePattern(const std::string& root_name);
 
+  /*!
+   * \brief write a Group to the sidre_hdf5 files of a new output, with
+   * each set of ranks sharing a file gathering its data on its first rank.
+   *
+   * \see setAggregateWrites()
+   */
+  void writeAggregatedSidreHDF5(sidre::Group* group,
+                                const std::string& root_name,
+                                int num_files);
+
   void readSidreHDF5(sidre::Group* group,
                      const std::string& root_file,
                      bool preserve_contents = false);
@@ -387,6 +442,9 @@ private:
   MPI_Comm m_mpi_comm;
 
   bool m_use_scr;
+
+  bool m_aggregate_writes;
+  std::size_t m_aggregate_buffer_bytes;
 };
 
 } /* end namespace sidre */
@@ -605,3 +605,100 @@ TEST(sidre_datastore, loop_create_delete_buffers_iterate)
 
   delete ds;
 }
+
+//------------------------------------------------------------------------------
+TEST(sidre_datastore, memory_tracking)
+{
+  using axom::sidre::Node;
+
+  DataStore* ds = new DataStore();
+  Group* root = ds->getRoot();
+  EXPECT_FALSE(ds->isMemoryTracking());
+
+  // Buffers allocated before tracking is enabled are charged when it is
+  Group* a = root->createGroup("a");
+  a->createViewAndAllocate("v0", axom::sidre::INT64_ID, 10);
+
+  ds->setMemoryTracking(true);
+  EXPECT_TRUE(ds->isMemoryTracking());
+
+  Group* b = a->createGroup("b");
+  b->createViewAndAllocate("v1", axom::sidre::FLOAT64_ID, 20);
+  View* v2 = root->createViewAndAllocate("v2", axom::sidre::INT32_ID, 5);
+
+  // a View sharing a Buffer does not add to the bytes held
+  Buffer* shared = ds->createBuffer(axom::sidre::INT8_ID, 100)->allocate();
+  a->createView("s0")->attachBuffer(shared);
+  b->createView("s1")->attachBuffer(shared);
+
+  // external data is reported separately
+  int ext[7];
+  b->createView("ext", axom::sidre::INT32_ID, 7, ext);
+
+  Node report;
+  ds->getMemoryReport(report);
+
+  const int allocID = axom::getDefaultAllocatorID();
+  const std::string allocPath = "allocators/" + std::to_string(allocID);
+  EXPECT_EQ(80 + 160 + 20 + 100, report["total/current_bytes"].as_int64());
+  EXPECT_EQ(80 + 160 + 20 + 100, report["total/peak_bytes"].as_int64());
+  EXPECT_EQ(4, report["total/num_allocations"].as_int64());
+  EXPECT_EQ(80 + 160 + 20 + 100,
+            report[allocPath + "/current_bytes"].as_int64());
+  EXPECT_EQ(4, report["buffers/num_buffers"].as_int64());
+  EXPECT_EQ(80 + 160 + 20 + 100, report["buffers/allocated_bytes"].as_int64());
+
+  EXPECT_EQ(80 + 160 + 20 + 100, report["hierarchy/current_bytes"].as_int64());
+  EXPECT_EQ(80 + 160 + 20 + 100, report["hierarchy/peak_bytes"].as_int64());
+  EXPECT_EQ(28, report["hierarchy/external_bytes"].as_int64());
+  EXPECT_EQ(6, report["hierarchy/num_views"].as_int64());
+  EXPECT_EQ(1, report["hierarchy/num_external_views"].as_int64());
+  EXPECT_EQ(80 + 160 + 100,
+            report["hierarchy/groups/a/current_bytes"].as_int64());
+  EXPECT_EQ(80 + 160 + 100, report["hierarchy/groups/a/peak_bytes"].as_int64());
+  EXPECT_EQ(5, report["hierarchy/groups/a/num_views"].as_int64());
+  EXPECT_EQ(160 + 100,
+            report["hierarchy/groups/a/groups/b/current_bytes"].as_int64());
+  EXPECT_EQ(160 + 100,
+            report["hierarchy/groups/a/groups/b/peak_bytes"].as_int64());
+  EXPECT_EQ(28,
+            report["hierarchy/groups/a/groups/b/external_bytes"].as_int64());
+
+  // freeing memory lowers the current bytes and keeps the peaks
+  b->destroyViewAndData("v1");
+  v2->deallocate();
+
+  ds->getMemoryReport(report);
+  EXPECT_EQ(80 + 100, report["total/current_bytes"].as_int64());
+  EXPECT_EQ(80 + 160 + 20 + 100, report["total/peak_bytes"].as_int64());
+  EXPECT_EQ(80 + 100, report["hierarchy/current_bytes"].as_int64());
+  EXPECT_EQ(80 + 160 + 20 + 100, report["hierarchy/peak_bytes"].as_int64());
+  EXPECT_EQ(100,
+            report["hierarchy/groups/a/groups/b/current_bytes"].as_int64());
+  EXPECT_EQ(160 + 100,
+            report["hierarchy/groups/a/groups/b/peak_bytes"].as_int64());
+
+  // allocating again counts as an allocation, and can raise the peaks
+  v2->reallocate(50);
+  ds->getMemoryReport(report);
+  EXPECT_EQ(80 + 100 + 200, report["total/current_bytes"].as_int64());
+  EXPECT_EQ(80 + 100 + 200, report["total/peak_bytes"].as_int64());
+  EXPECT_EQ(5, report["total/num_allocations"].as_int64());
+
+  ds->resetMemoryPeaks();
+  ds->getMemoryReport(report);
+  EXPECT_EQ(80 + 100 + 200, report["total/peak_bytes"].as_int64());
+  EXPECT_EQ(100, report["hierarchy/groups/a/groups/b/peak_bytes"].as_int64());
+
+  // without tracking, the report only holds the current state
+  ds->setMemoryTracking(false);
+  EXPECT_FALSE(ds->isMemoryTracking());
+  ds->getMemoryReport(report);
+  EXPECT_FALSE(report.has_path("total"));
+  EXPECT_FALSE(report.has_path("allocators"));
+  EXPECT_FALSE(report.has_path("hierarchy/peak_bytes"));
+  EXPECT_EQ(80 + 100 + 200, report["hierarchy/current_bytes"].as_int64());
+  EXPECT_EQ(80 + 100, report["hierarchy/groups/a/current_bytes"].as_int64());
+
+  delete ds;
+}
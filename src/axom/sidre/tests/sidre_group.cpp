@@ -22,6 +22,7 @@ using axom::sidre::IndexType;
 using axom::sidre::INT_ID;
 using axom::sidre::InvalidIndex;
 using axom::sidre::nameIsValid;
+using axom::sidre::PathHandle;
 using axom::sidre::TypeID;
 using axom::sidre::View;
 
@@ -375,6 +376,78 @@ TEST(sidre_group, view_with_path)
   delete ds;
 }
 
+//------------------------------------------------------------------------------
+// hasView(), getView(), hasGroup(), getGroup() with PathHandle
+//------------------------------------------------------------------------------
+TEST(sidre_group, path_handle)
+{
+  DataStore* ds = new DataStore();
+  Group* root = ds->getRoot();
+
+  View* view = root->createView("groupA/groupB/view");
+  Group* groupB = root->getGroup("groupA/groupB");
+
+  const PathHandle view_path("groupA/groupB/view");
+  const PathHandle group_path("/groupA//groupB/");
+  const PathHandle name_path("view");
+  const PathHandle bad_path("groupA/BAD/view");
+  const PathHandle empty_path("");
+
+  EXPECT_EQ(3, view_path.getNumEntries());
+  EXPECT_EQ(2, group_path.getNumEntries());
+  EXPECT_EQ(std::string("view"), view_path.getName());
+  EXPECT_EQ(std::string("groupB"), group_path.getName());
+  EXPECT_EQ(0, empty_path.getNumEntries());
+
+  // Repeated lookups through a handle return the same items as paths
+  for(int i = 0; i < 3; ++i)
+  {
+    EXPECT_TRUE(root->hasView(view_path));
+    EXPECT_EQ(view, root->getView(view_path));
+    EXPECT_TRUE(root->hasGroup(group_path));
+    EXPECT_EQ(groupB, root->getGroup(group_path));
+    EXPECT_EQ(view, groupB->getView(name_path));
+
+    const Group* croot = root;
+    EXPECT_EQ(view, croot->getView(view_path));
+    EXPECT_EQ(groupB, croot->getGroup(group_path));
+  }
+
+  // A handle can be used with a different Group
+  EXPECT_FALSE(groupB->hasView(view_path));
+  EXPECT_FALSE(root->hasView(name_path));
+  EXPECT_TRUE(root->getGroup("groupA")->hasView(PathHandle("groupB/view")));
+
+  // Views and Groups are not confused
+  EXPECT_FALSE(root->hasGroup(view_path));
+  EXPECT_FALSE(root->hasView(group_path));
+
+  // Bad and empty paths
+  EXPECT_FALSE(root->hasView(bad_path));
+  EXPECT_EQ(nullptr, root->getView(bad_path));
+  EXPECT_FALSE(root->hasView(empty_path));
+  EXPECT_FALSE(root->hasGroup(empty_path));
+  EXPECT_EQ(nullptr, root->getGroup(empty_path));
+
+  // Cached indices are revalidated when items are destroyed and recreated
+  root->destroyGroup("groupA/groupB");
+  EXPECT_FALSE(root->hasView(view_path));
+  EXPECT_FALSE(root->hasGroup(group_path));
+  EXPECT_EQ(nullptr, root->getView(view_path));
+
+  root->getGroup("groupA")->createGroup("other");
+  View* view2 = root->createView("groupA/groupB/view");
+  EXPECT_TRUE(root->hasView(view_path));
+  EXPECT_EQ(view2, root->getView(view_path));
+  EXPECT_EQ(root->getGroup("groupA/groupB"), root->getGroup(group_path));
+
+  // Resetting the cache has no effect on the result
+  view_path.resetCache();
+  EXPECT_EQ(view2, root->getView(view_path));
+
+  delete ds;
+}
+
 //------------------------------------------------------------------------------
 // Verify getViewName(), getViewIndex()
 //------------------------------------------------------------------------------
@@ -362,6 +362,132 @@ TEST(sidre_datacollection, dc_reload_qf)
   EXPECT_LT(reader_qv->Norml2(), 1e-15);
 }
 
+TEST(sidre_datacollection, dc_register_external_field)
+{
+  const std::string field_name = "test_field";
+  const int vdim = 3;
+  // 2D mesh divided into triangles
+  auto mesh = mfem::Mesh::MakeCartesian2D(4, 4, mfem::Element::TRIANGLE);
+  mfem::H1_FECollection fec(1, mesh.Dimension());
+
+  for(auto ordering : {mfem::Ordering::byNODES, mfem::Ordering::byVDIM})
+  {
+    mfem::FiniteElementSpace fes(&mesh, &fec, vdim, ordering);
+    mfem::GridFunction gf(&fes);
+    gf = 1.5;
+    double* gf_data = gf.GetData();
+
+    MFEMSidreDataCollection sdc(testName(), &mesh);
+
+    // A named buffer for the field would be used by RegisterField(),
+    // but is ignored when registering the field's own data
+    sdc.AllocNamedBuffer(field_name, gf.Size());
+    sdc.RegisterExternalField(field_name, &gf);
+    EXPECT_TRUE(sdc.HasField(field_name));
+    EXPECT_EQ(gf.GetData(), gf_data);
+
+    // The components are strided external Views into the GridFunction's data
+    const int ndofs = fes.GetNDofs();
+    const int entry_stride = (ordering == mfem::Ordering::byNODES) ? 1 : vdim;
+    const int vdim_stride = (ordering == mfem::Ordering::byNODES) ? ndofs : 1;
+    Group* values_grp = sdc.GetBPGroup()->getGroup("fields/test_field/values");
+    ASSERT_NE(values_grp, nullptr);
+    EXPECT_EQ(values_grp->getNumViews(), vdim);
+    for(int d = 0; d < vdim; ++d)
+    {
+      axom::sidre::View* xv = values_grp->getView(axom::fmt::format("x{}", d));
+      EXPECT_TRUE(xv->isExternal());
+      EXPECT_EQ(xv->getNumElements(), ndofs);
+      EXPECT_EQ(xv->getStride(), entry_stride);
+      EXPECT_EQ(static_cast<double*>(xv->getData()), gf_data + d * vdim_stride);
+    }
+
+    EXPECT_TRUE(sdc.verifyMeshBlueprint());
+  }
+}
+
+TEST(sidre_datacollection, dc_register_external_scalar_field)
+{
+  // 2D mesh divided into triangles
+  auto mesh = mfem::Mesh::MakeCartesian2D(4, 4, mfem::Element::TRIANGLE);
+  mfem::H1_FECollection fec(1, mesh.Dimension());
+  mfem::FiniteElementSpace fes(&mesh, &fec);
+
+  mfem::GridFunction gf(&fes);
+  gf = 1.5;
+  double* gf_data = gf.GetData();
+
+  MFEMSidreDataCollection sdc(testName(), &mesh);
+
+  // Registering a new external field does not emit any warnings
+  axom::slic::enableAbortOnWarning();
+  sdc.RegisterExternalField("new_field", &gf);
+  axom::slic::disableAbortOnWarning();
+
+  axom::sidre::View* values =
+    sdc.GetBPGroup()->getView("fields/new_field/values");
+  ASSERT_NE(values, nullptr);
+  EXPECT_TRUE(values->isExternal());
+  EXPECT_EQ(values->getNumElements(), gf.Size());
+  EXPECT_EQ(static_cast<double*>(values->getData()), gf_data);
+
+  // A "values" View that already exists, e.g. loaded from file, is replaced,
+  // but its Buffer is kept while a named buffer still references it
+  axom::sidre::View* nbv = sdc.AllocNamedBuffer("loaded_field", gf.Size());
+  Group* loaded_grp = sdc.GetBPGroup()->createGroup("fields/loaded_field");
+  loaded_grp->createView("values")
+    ->attachBuffer(nbv->getBuffer())
+    ->apply(axom::sidre::DOUBLE_ID, gf.Size());
+  EXPECT_EQ(nbv->getBuffer()->getNumViews(), 2);
+
+  sdc.RegisterExternalField("loaded_field", &gf);
+
+  values = loaded_grp->getView("values");
+  EXPECT_TRUE(values->isExternal());
+  EXPECT_EQ(static_cast<double*>(values->getData()), gf_data);
+  ASSERT_NE(sdc.GetNamedBuffer("loaded_field"), nullptr);
+  EXPECT_TRUE(sdc.GetNamedBuffer("loaded_field")->isAllocated());
+  EXPECT_EQ(nbv->getBuffer()->getNumViews(), 1);
+
+  EXPECT_TRUE(sdc.verifyMeshBlueprint());
+}
+
+TEST(sidre_datacollection, dc_save_external_qf)
+{
+  auto mesh =
+    mfem::Mesh::MakeCartesian2D(2, 3, mfem::Element::QUADRILATERAL, 0, 2.0, 3.0);
+
+  const int intOrder = 3;
+  const int qv_vdim = 2;
+  mfem::QuadratureSpace qspace(&mesh, intOrder);
+
+  // The QuadratureFunction owns its data
+  mfem::QuadratureFunction qv(&qspace, qv_vdim);
+  qv = 2.5;
+  double* qv_data = qv.GetData();
+
+  MFEMSidreDataCollection sdc(testName(), &mesh);
+#if defined(AXOM_USE_MPI) && defined(MFEM_USE_MPI)
+  sdc.SetComm(MPI_COMM_WORLD);
+#endif
+
+  sdc.RegisterExternalQField("qv", &qv);
+  ASSERT_TRUE(sdc.HasQField("qv"));
+  EXPECT_EQ(qv.GetData(), qv_data);
+
+  axom::sidre::View* values = sdc.GetBPGroup()->getView("fields/qv/values");
+  EXPECT_TRUE(values->isExternal());
+  EXPECT_EQ(values->getNumElements(), qv.Size());
+  EXPECT_EQ(static_cast<double*>(values->getData()), qv_data);
+
+  // The data is written directly from the QuadratureFunction
+  sdc.SetCycle(0);
+  sdc.Save();
+  EXPECT_EQ(qv.GetData(), qv_data);
+
+  EXPECT_TRUE(sdc.verifyMeshBlueprint());
+}
+
 // Helper function to check for the existence of two sidre::Views and to check
 // that they each refer to the same block of data
 void checkReferentialEquality(axom::sidre::Group* grp,
@@ -550,6 +550,79 @@ TEST(spio_parallel, irregular_writeread)
   delete ds2;
 }
 
+//------------------------------------------------------------------------------
+TEST(spio_parallel, aggregated_writeread)
+{
+  if(PROTOCOL != "sidre_hdf5")
+  {
+    SUCCEED() << "Aggregated writes only currently supported "
+              << " for 'sidre_hdf5' protocol";
+    return;
+  }
+
+  int my_rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+
+  int num_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  /*
+   * Create a DataStore whose views have sizes that vary based on rank.
+   */
+  DataStore* ds1 = new DataStore();
+  Group* root1 = ds1->getRoot();
+
+  root1->createViewScalar<int>("fields/a/i0", 101 * my_rank);
+  root1->createViewString("fields/a/s0",
+                          axom::fmt::format("rank {}", my_rank));
+
+  const int num_vals = 100 * (my_rank + 1);
+  View* dvals = root1->createView("fields/b/d0")->allocate(
+    DataType::c_double(num_vals));
+  double* d0 = dvals->getData();
+  for(int i = 0; i < num_vals; ++i)
+  {
+    d0[i] = 0.5 * i + my_rank;
+  }
+
+  /*
+   * Write with aggregation to a single file and to the default number of
+   * files, with a buffer small enough that the aggregators write several
+   * times, and read with the usual reader.
+   */
+  const int file_counts[] = {1, numOutputFiles(num_ranks)};
+  for(int num_files : file_counts)
+  {
+    IOManager writer(MPI_COMM_WORLD);
+    writer.setAggregateWrites(true, 1024);
+    EXPECT_TRUE(writer.getAggregateWrites());
+
+    const std::string file_name =
+      axom::fmt::format("out_spio_aggregated_write_read_{}", num_files);
+    writer.write(root1, num_files, file_name, PROTOCOL);
+
+    DataStore* ds2 = new DataStore();
+
+    IOManager reader(MPI_COMM_WORLD);
+    reader.read(ds2->getRoot(), file_name + ROOT_EXT);
+
+    EXPECT_EQ(reader.getNumFilesFromRoot(file_name + ROOT_EXT), num_files);
+    EXPECT_TRUE(ds2->getRoot()->isEquivalentTo(root1));
+
+    View* dvals2 = ds2->getRoot()->getView("fields/b/d0");
+    EXPECT_EQ(dvals2->getNumElements(), num_vals);
+    double* d0_restored = dvals2->getData();
+    for(int i = 0; i < num_vals; ++i)
+    {
+      EXPECT_EQ(d0[i], d0_restored[i]);
+    }
+
+    delete ds2;
+  }
+
+  delete ds1;
+}
+
 //------------------------------------------------------------------------------
 TEST(spio_parallel, preserve_writeread)
 {
@@ -21,6 +21,7 @@
 #include "axom/primal/operators/intersect.hpp"  // for detail::intersect_ray()
 
 #include "axom/spin/policy/LinearBVH.hpp"
+#include "axom/spin/policy/QuantizedBVH.hpp"
 
 // slic includes
 #include "axom/slic/interface/slic.hpp"  // for SLIC macros
@@ -42,9 +43,14 @@ enum BVHReturnCodes
   BVH_BUILD_OK,           //!< indicates that the BVH was generated successfully
 };
 
+/*!
+ * \brief Enumerates the available BVH implementations.
+ */
 enum class BVHType
 {
-  LinearBVH
+  LinearBVH,       //!< binary BVH with full precision node bounding boxes
+  QuantizedBVH8,   //!< LinearBVH with bounding boxes quantized to 8 bits
+  QuantizedBVH16,  //!< LinearBVH with bounding boxes quantized to 16 bits
 };
 
 template <typename FloatType, int NDIMS, typename ExecType, BVHType Policy>
@@ -56,6 +62,18 @@ struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::LinearBVH>
   using ImplType = policy::LinearBVH<FloatType, NDIMS, ExecType>;
 };
 
+template <typename FloatType, int NDIMS, typename ExecType>
+struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::QuantizedBVH8>
+{
+  using ImplType = policy::QuantizedBVH<FloatType, NDIMS, ExecType, uint8>;
+};
+
+template <typename FloatType, int NDIMS, typename ExecType>
+struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::QuantizedBVH16>
+{
+  using ImplType = policy::QuantizedBVH<FloatType, NDIMS, ExecType, uint16>;
+};
+
 /*!
  * \class BVH
  *
@@ -73,9 +91,12 @@ struct BVHPolicy<FloatType, NDIMS, ExecType, BVHType::LinearBVH>
  * \tparam NDIMS the number of dimensions, e.g., 2 or 3.
  * \tparam ExecSpace the execution space to use, e.g. SEQ_EXEC, CUDA_EXEC, etc.
  * \tparam FloatType floating precision, e.g., `double` or `float`. Optional.
+ * \tparam BVHImpl the BVH implementation, see BVHType. Optional.
  *
- * \note The last template parameter is optional. Defaults to double precision
- *  if not specified.
+ * \note The last two template parameters are optional. Defaults to double
+ *  precision and BVHType::LinearBVH if not specified. The quantized BVH types
+ *  store the node bounding boxes in a compressed form, which reduces the
+ *  memory traffic of queries, and return the same candidates.
  *
  * \pre The spin::BVH class requires RAJA and Umpire with CUDA_EXEC.
  *
@@ -222,6 +243,106 @@ public:
 
   bool isInitialized() const { return m_bvh != nullptr; }
 
+  /*!
+   * \brief Updates the BVH with new bounding boxes for its entities, keeping
+   *  the hierarchy computed by the last call to initialize().
+   *
+   * Refitting recomputes the bounding boxes of the BVH bins bottom-up in
+   * parallel, skipping the Morton code sort and the tree construction of
+   * initialize(). This is intended for entities that move by small amounts,
+   * e.g., the cells of a deforming surface mesh with fixed connectivity.
+   * As the entities move, the hierarchy may become a poor fit for the new
+   * bounding boxes; getSurfaceAreaCostRatio() can be used to decide when to
+   * call initialize() instead.
+   *
+   * \param [in] boxes buffer consisting of bounding boxes for each entity.
+   * \param [in] numItems the total number of items to store in the BVH.
+   *
+   * \return status set to BVH_BUILD_OK on success, or BVH_BUILD_FAILED if the
+   *  BVH was not initialized or numItems differs from its number of items.
+   *
+   * \warning The ith bounding box must be associated with the same entity
+   *  as the ith bounding box supplied to initialize().
+   *
+   * \pre boxes != nullptr
+   */
+  template <typename BoxIndexable>
+  int refit(const BoxIndexable boxes, IndexType numItems);
+
+  /*!
+   * \brief Returns the summed surface area of the BVH bins, relative to the
+   *  surface area of the bounds of the BVH.
+   *
+   * This is the surface area heuristic estimate of the number of bins that a
+   * query visits, and measures the quality of the BVH. For 2D BVHs,
+   * the perimeters of the bins are used.
+   *
+   * \pre isInitialized() is true
+   */
+  FloatType getSurfaceAreaCost() const
+  {
+    SLIC_ASSERT(m_bvh != nullptr);
+    return m_bvh->getSurfaceAreaCostImpl();
+  }
+
+  /*!
+   * \brief Returns the ratio of the current surface area cost of the BVH to its
+   *  cost after the last call to initialize().
+   *
+   * The ratio is 1 after initialize(), and generally grows with each call to
+   * refit() as the entities move. A full rebuild usually pays off once it
+   * exceeds a threshold such as 1.5.
+   *
+   * \pre isInitialized() is true
+   */
+  FloatType getSurfaceAreaCostRatio() const
+  {
+    SLIC_ASSERT(m_bvh != nullptr);
+    const FloatType buildCost = m_bvh->getBuildSurfaceAreaCostImpl();
+    return (buildCost > 0) ? getSurfaceAreaCost() / buildCost : FloatType {1};
+  }
+
+  /*!
+   * \brief Returns the surface area cost of the BVH after the last call to
+   *  initialize(), before the treelet restructuring.
+   *
+   * This equals the cost after initialize() if the treelet restructuring is
+   * disabled.
+   *
+   * \see setTreeletOptimizationRounds()
+   * \pre isInitialized() is true
+   */
+  FloatType getUnoptimizedSurfaceAreaCost() const
+  {
+    SLIC_ASSERT(m_bvh != nullptr);
+    return m_bvh->getUnoptimizedSurfaceAreaCostImpl();
+  }
+
+  /*!
+   * \brief Sets the number of rounds of treelet restructuring applied by
+   *  initialize() to reduce the surface area cost of the BVH.
+   *
+   * The BVH is built as a radix tree over the Morton codes of the bounding box
+   * centroids. Its bins can overlap heavily when the entities vary in size,
+   * e.g., for CAD meshes with small and large features. Each round
+   * restructures small subtrees, i.e. treelets, in parallel to minimize their
+   * surface area, at the cost of a slower initialize(). Queries on the
+   * restructured BVH visit fewer bins. A few rounds, e.g., 3, are usually
+   * enough.
+   *
+   * \param [in] rounds the number of rounds; 0 (the default) disables the
+   *  restructuring
+   */
+  void setTreeletOptimizationRounds(int rounds)
+  {
+    m_treeletRounds = (rounds > 0) ? rounds : 0;
+  }
+
+  /*!
+   * \brief Returns the number of rounds of treelet restructuring.
+   */
+  int getTreeletOptimizationRounds() const { return m_treeletRounds; }
+
   /*!
    * \brief Sets the ID of the allocator used by the BVH.
    * \param [in] allocatorID the ID of the allocator to use in BVH construction
@@ -379,6 +500,15 @@ public:
   void writeVtkFile(const std::string& fileName) const;
 
 private:
+  /*!
+   * \brief Invokes \a func with the given boxes, or with a copy of the boxes
+   *  that is padded with an empty box when there is only a single box.
+   */
+  template <typename BoxIndexable, typename Func>
+  void applyToPaddedBoxes(const BoxIndexable boxes,
+                          IndexType numBoxes,
+                          Func&& func);
+
   /// \name Private Members
   /// @{
   static constexpr FloatType DEFAULT_SCALE_FACTOR = 1.000123;
@@ -388,6 +518,7 @@ private:
   int m_AllocatorID;
   FloatType m_tolerance {DEFAULT_TOLERANCE};
   FloatType m_scaleFactor {DEFAULT_SCALE_FACTOR};
+  int m_treeletRounds {0};
   std::unique_ptr<ImplType> m_bvh {};
   /// @}
 };
@@ -409,9 +540,6 @@ int BVH<NDIMS, ExecSpace, FloatType, Impl>::initialize(const BoxIndexable boxes,
     std::is_convertible<IterBase, BoxType>::value,
     "Iterator must return objects convertible to primal::BoundingBox.");
 
-  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
-  using PointType = primal::Point<FloatType, NDIMS>;
-
   if(numBoxes == 0)
   {
     m_bvh.reset();
@@ -421,42 +549,82 @@ int BVH<NDIMS, ExecSpace, FloatType, Impl>::initialize(const BoxIndexable boxes,
   // STEP 1: Allocate a BVH, potentially deleting the existing BVH if it exists
   m_bvh.reset(new ImplType);
 
-  // STEP 1: Handle case when user supplied a single bounding box
-  BoxType* boxesptr = nullptr;
-  if(numBoxes == 1)
-  {
-    numBoxes = 2;
-    boxesptr = axom::allocate<BoxType>(numBoxes, m_AllocatorID);
-
-    // copy first box and add a fake 2nd box
-    for_all<ExecSpace>(
-      2,
-      AXOM_LAMBDA(IndexType i) {
-        if(i == 0)
-        {
-          boxesptr[i] = boxes[i];
-        }
-        else
-        {
-          BoxType empty_box;
-          empty_box.addPoint(PointType(0.));
-          boxesptr[i] = empty_box;
-        }
-      });
-    m_bvh->buildImpl(boxesptr, numBoxes, m_scaleFactor, m_AllocatorID);
-  }
-  else
+  // STEP 2: Build the BVH, handling the case of a single bounding box
+  applyToPaddedBoxes(boxes, numBoxes, [&](const auto& bvhBoxes, IndexType n) {
+    m_bvh->buildImpl(bvhBoxes,
+                     n,
+                     m_scaleFactor,
+                     m_treeletRounds,
+                     m_AllocatorID);
+  });
+
+  return BVH_BUILD_OK;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename BoxIndexable>
+int BVH<NDIMS, ExecSpace, FloatType, Impl>::refit(const BoxIndexable boxes,
+                                                  IndexType numBoxes)
+{
+  AXOM_PERF_MARK_FUNCTION("BVH::refit");
+
+  using IterBase = typename IteratorTraits<BoxIndexable>::BaseType;
+
+  // Ensure that the iterator returns objects convertible to primal::BoundingBox.
+  static_assert(
+    std::is_convertible<IterBase, BoxType>::value,
+    "Iterator must return objects convertible to primal::BoundingBox.");
+
+  // The BVH stores a padded box when initialized with a single box
+  const IndexType numLeaves = (numBoxes == 1) ? 2 : numBoxes;
+  if(m_bvh == nullptr || numBoxes == 0 ||
+     numLeaves != m_bvh->getNumLeavesImpl())
   {
-    m_bvh->buildImpl(boxes, numBoxes, m_scaleFactor, m_AllocatorID);
+    return BVH_BUILD_FAILED;
   }
 
-  // STEP 5: deallocate boxesptr if user supplied a single box
-  if(boxesptr)
+  applyToPaddedBoxes(boxes, numBoxes, [&](const auto& bvhBoxes, IndexType n) {
+    m_bvh->refitImpl(bvhBoxes, n, m_scaleFactor, m_AllocatorID);
+  });
+
+  return BVH_BUILD_OK;
+}
+
+//------------------------------------------------------------------------------
+template <int NDIMS, typename ExecSpace, typename FloatType, BVHType Impl>
+template <typename BoxIndexable, typename Func>
+void BVH<NDIMS, ExecSpace, FloatType, Impl>::applyToPaddedBoxes(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  Func&& func)
+{
+  if(numBoxes != 1)
   {
-    SLIC_ASSERT(boxesptr != nullptr);
-    axom::deallocate(boxesptr);
+    func(boxes, numBoxes);
+    return;
   }
-  return BVH_BUILD_OK;
+
+  // copy first box and add a fake 2nd box
+  BoxType* boxesptr = axom::allocate<BoxType>(2, m_AllocatorID);
+  for_all<ExecSpace>(
+    2,
+    AXOM_LAMBDA(IndexType i) {
+      if(i == 0)
+      {
+        boxesptr[i] = boxes[i];
+      }
+      else
+      {
+        BoxType empty_box;
+        empty_box.addPoint(PointType(0.));
+        boxesptr[i] = empty_box;
+      }
+    });
+
+  func(boxesptr, 2);
+
+  axom::deallocate(boxesptr);
 }
 
 //------------------------------------------------------------------------------
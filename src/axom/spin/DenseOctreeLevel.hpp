@@ -288,6 +288,20 @@ public:
     return count;
   }
 
+  /** \brief Returns the fraction of the level's blocks that are in the tree */
+  double loadFactor() const
+  {
+    return (m_broodCapacity > 0)
+      ? static_cast<double>(m_blockCount) / (m_broodCapacity * Base::BROOD_SIZE)
+      : 0.;
+  }
+
+  /** \brief Returns the number of bytes allocated by the level */
+  std::size_t numBytes() const
+  {
+    return sizeof(*this) + m_broodCapacity * sizeof(BroodData);
+  }
+
   /**
    * \brief Helper function to determine the status of
    * an octree block within this octree level
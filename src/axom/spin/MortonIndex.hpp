@@ -24,6 +24,21 @@
 
 #include <type_traits>
 #include <limits>  // for numeric_limits
+#include <array>
+
+// The host code can use the x86 BMI2 bit deposit/extract instructions
+// (pdep/pext) for Morton encoding. Scalar (de)mortonization uses them when
+// the compiler targets BMI2 (e.g. -mbmi2 or -march=haswell); the batched
+// mortonize() functions detect BMI2 support at runtime.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && \
+  !defined(__CUDACC__) && !defined(__HIPCC__)
+  #define AXOM_SPIN_MORTON_X86_INTRINSICS
+  #include <immintrin.h>
+
+  #if defined(__BMI2__)
+    #define AXOM_SPIN_MORTON_USE_BMI2
+  #endif
+#endif
 
 namespace
 {
@@ -115,6 +130,202 @@ namespace axom
 {
 namespace spin
 {
+namespace internal
+{
+/*!
+ * \brief The unsigned word used for the bitwise operations on a Morton index.
+ *
+ * Types narrower than 32 bits are promoted to 32 bits to match the BMI2
+ * instructions.
+ */
+template <typename MortonIndexType>
+using MortonWord = typename std::conditional<(sizeof(MortonIndexType) > 4),
+                                             axom::uint64,
+                                             axom::uint32>::type;
+
+#ifdef AXOM_SPIN_MORTON_X86_INTRINSICS
+
+/// Deposits the low-order bits of \a x at the set bits of \a mask
+__attribute__((target("bmi2"))) inline axom::uint32 depositBits(
+  axom::uint32 x,
+  axom::uint32 mask)
+{
+  return _pdep_u32(x, mask);
+}
+
+/// \overload
+__attribute__((target("bmi2"))) inline axom::uint64 depositBits(
+  axom::uint64 x,
+  axom::uint64 mask)
+{
+  return _pdep_u64(x, mask);
+}
+
+/// Extracts the bits of \a x at the set bits of \a mask to the low-order bits
+__attribute__((target("bmi2"))) inline axom::uint32 extractBits(
+  axom::uint32 x,
+  axom::uint32 mask)
+{
+  return _pext_u32(x, mask);
+}
+
+/// \overload
+__attribute__((target("bmi2"))) inline axom::uint64 extractBits(
+  axom::uint64 x,
+  axom::uint64 mask)
+{
+  return _pext_u64(x, mask);
+}
+
+#endif  // AXOM_SPIN_MORTON_X86_INTRINSICS
+
+/*!
+ * \brief Checks (once) whether the host CPU has fast BMI2 instructions
+ *
+ * \note AMD processors prior to Zen 3 implement pdep/pext in microcode,
+ *  which is slower than the lookup table, so they are treated as lacking BMI2.
+ */
+inline bool hasFastBMI2()
+{
+#if defined(AXOM_SPIN_MORTON_USE_BMI2)
+  return true;
+#elif defined(AXOM_SPIN_MORTON_X86_INTRINSICS)
+  static const bool hasBMI2 = []() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2") && !__builtin_cpu_is("znver1") &&
+      !__builtin_cpu_is("znver2");
+  }();
+  return hasBMI2;
+#else
+  return false;
+#endif
+}
+
+/*!
+ * \brief Returns a table with the Morton expansion of each byte value
+ *
+ * Entry \a v has bit \a i of \a v at bit \a DIM*i, for the bits that fit
+ * in the word.
+ */
+template <typename WordType, int DIM>
+const WordType* mortonExpandTable()
+{
+  static const std::array<WordType, 256> table = []() {
+    constexpr int WORD_BITS = std::numeric_limits<WordType>::digits;
+    std::array<WordType, 256> tbl;
+    for(int v = 0; v < 256; ++v)
+    {
+      WordType res = 0;
+      for(int i = 0; i < 8 && DIM * i < WORD_BITS; ++i)
+      {
+        res |= static_cast<WordType>((v >> i) & 1) << (DIM * i);
+      }
+      tbl[v] = res;
+    }
+    return tbl;
+  }();
+
+  return table.data();
+}
+
+/*!
+ * \brief Mortonizes an array of points with a byte-wise lookup table
+ *
+ * \see Mortonizer::mortonize(const PointType*, IndexType, MortonIndexType*)
+ */
+template <typename MortonizerType, typename CoordType, typename MortonIndexType, int DIM>
+void mortonizeLUT(const primal::Point<CoordType, DIM>* pts,
+                  IndexType n,
+                  MortonIndexType* out)
+{
+  using Word = MortonWord<MortonIndexType>;
+  constexpr int INDEX_BITS = std::numeric_limits<MortonIndexType>::digits +
+    std::numeric_limits<MortonIndexType>::is_signed;
+  constexpr int COORD_BITS = (INDEX_BITS + DIM - 1) / DIM;
+  constexpr int NUM_BYTES = (COORD_BITS + 7) / 8;
+
+  const Word* table = mortonExpandTable<Word, DIM>();
+
+  for(IndexType i = 0; i < n; ++i)
+  {
+    Word res = 0;
+    for(int d = 0; d < DIM; ++d)
+    {
+      const Word c = static_cast<Word>(static_cast<MortonIndexType>(pts[i][d]));
+      Word expanded = 0;
+      for(int b = 0; b < NUM_BYTES; ++b)
+      {
+        expanded |= table[(c >> (8 * b)) & 0xFF] << (DIM * 8 * b);
+      }
+      res |= expanded << d;
+    }
+    out[i] = static_cast<MortonIndexType>(res);
+  }
+}
+
+#ifdef AXOM_SPIN_MORTON_X86_INTRINSICS
+/*!
+ * \brief Mortonizes an array of points with the BMI2 pdep instruction
+ *
+ * \pre The host CPU supports BMI2, \see hasFastBMI2()
+ */
+template <typename MortonizerType, typename CoordType, typename MortonIndexType, int DIM>
+__attribute__((target("bmi2"))) void mortonizeBMI2(
+  const primal::Point<CoordType, DIM>* pts,
+  IndexType n,
+  MortonIndexType* out)
+{
+  using Word = MortonWord<MortonIndexType>;
+  const Word mask = static_cast<Word>(MortonizerType::GetB(0));
+
+  for(IndexType i = 0; i < n; ++i)
+  {
+    Word res = 0;
+    for(int d = 0; d < DIM; ++d)
+    {
+      const Word c = static_cast<Word>(static_cast<MortonIndexType>(pts[i][d]));
+      res |= depositBits(c, static_cast<Word>(mask << d));
+    }
+    out[i] = static_cast<MortonIndexType>(res);
+  }
+}
+#endif  // AXOM_SPIN_MORTON_X86_INTRINSICS
+
+/*!
+ * \brief Mortonizes an array of points on the host
+ *
+ * Uses BMI2 when the CPU supports it. Otherwise, 3D points use the lookup
+ * table, and 2D points use the magic-number expansion of the scalar
+ * mortonize(), which needs fewer operations than the table in 2D.
+ */
+template <typename MortonizerType, typename CoordType, typename MortonIndexType, int DIM>
+void mortonizeBatch(const primal::Point<CoordType, DIM>* pts,
+                    IndexType n,
+                    MortonIndexType* out)
+{
+#ifdef AXOM_SPIN_MORTON_X86_INTRINSICS
+  if(hasFastBMI2())
+  {
+    mortonizeBMI2<MortonizerType>(pts, n, out);
+    return;
+  }
+#endif
+
+  if(DIM == 3)
+  {
+    mortonizeLUT<MortonizerType>(pts, n, out);
+  }
+  else
+  {
+    for(IndexType i = 0; i < n; ++i)
+    {
+      out[i] = MortonizerType::mortonize(pts[i]);
+    }
+  }
+}
+
+}  // namespace internal
+
 /*!
  * \class
  * \brief Base class for Dimension independent Morton indexing
@@ -150,12 +361,19 @@ protected:
   AXOM_HOST_DEVICE
   static MortonIndexType expandBits(MortonIndexType x)
   {
+#ifdef AXOM_SPIN_MORTON_USE_BMI2
+    using Word = internal::MortonWord<MortonIndexType>;
+    return static_cast<MortonIndexType>(
+      internal::depositBits(static_cast<Word>(x),
+                            static_cast<Word>(Derived::GetB(0))));
+#else
     for(int i = Derived::EXPAND_MAX_ITER; i >= 0; --i)
     {
       x = (x | (x << Derived::GetS(i))) & Derived::GetB(i);
     }
 
     return x;
+#endif
   }
 
   /*!
@@ -170,12 +388,19 @@ protected:
   AXOM_HOST_DEVICE
   static MortonIndexType contractBits(MortonIndexType x)
   {
+#ifdef AXOM_SPIN_MORTON_USE_BMI2
+    using Word = internal::MortonWord<MortonIndexType>;
+    return static_cast<MortonIndexType>(
+      internal::extractBits(static_cast<Word>(x),
+                            static_cast<Word>(Derived::GetB(0))));
+#else
     for(int i = 0; i < Derived::CONTRACT_MAX_ITER; ++i)
     {
       x = (x | (x >> Derived::GetS(i))) & Derived::GetB(i + 1);
     }
 
     return x;
+#endif
   }
 
 public:
@@ -319,6 +544,24 @@ struct Mortonizer<CoordType, MortonIndexType, 2>
     return (Base::expandBits(pt[0]) | (Base::expandBits(pt[1]) << 1));
   }
 
+  /*!
+   * \brief Converts an array of 2D points to Morton indices on the host
+   *
+   * \param [in] pts The array of points
+   * \param [in] n The number of points
+   * \param [out] out The array of \a n Morton indices
+   * \note Uses the BMI2 pdep instruction when the CPU supports it and
+   *  the magic-number bit expansion of the scalar mortonize() otherwise
+   * \note The results match the scalar mortonize() when the coordinates are
+   *  in the range \f$ [0, 2^{maxBitsPerCoord()}) \f$
+   */
+  static void mortonize(const primal::Point<CoordType, NDIM>* pts,
+                        IndexType n,
+                        MortonIndexType* out)
+  {
+    internal::mortonizeBatch<self>(pts, n, out);
+  }
+
   /*!
    * \brief A function to convert a Morton index back to a 2D point
    *
@@ -466,6 +709,24 @@ struct Mortonizer<CoordType, MortonIndexType, 3>
             (Base::expandBits(pt[2] & b5) << 2));
   }
 
+  /*!
+   * \brief Converts an array of 3D points to Morton indices on the host
+   *
+   * \param [in] pts The array of points
+   * \param [in] n The number of points
+   * \param [out] out The array of \a n Morton indices
+   * \note Uses the BMI2 pdep instruction when the CPU supports it and
+   *  a byte-wise lookup table otherwise
+   * \note The results match the scalar mortonize() when the coordinates are
+   *  in the range \f$ [0, 2^{maxBitsPerCoord()}) \f$
+   */
+  static void mortonize(const primal::Point<CoordType, NDIM>* pts,
+                        IndexType n,
+                        MortonIndexType* out)
+  {
+    internal::mortonizeBatch<self>(pts, n, out);
+  }
+
   /*!
    * \brief A function to convert a Morton index back to a 3D point
    *
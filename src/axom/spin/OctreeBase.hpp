@@ -20,6 +20,7 @@
 #include "axom/spin/OctreeLevel.hpp"
 #include "axom/spin/SparseOctreeLevel.hpp"
 
+#include <cmath>
 #include <ostream>  // for ostream in print
 
 namespace axom
@@ -428,16 +429,33 @@ private:
     MAX_DENSE_LEV = 4,
     MAX_SPARSE16_LEV = 16 / DIM,
     MAX_SPARSE32_LEV = 32 / DIM,
-    MAX_SPARSE64_LEV = 64 / DIM
+    MAX_SPARSE64_LEV = 64 / DIM,
+    // Levels are only converted to dense storage when they have at most
+    // 2^MAX_DENSE_BROOD_BITS broods; this must fit in a 32-bit Morton index
+    MAX_DENSE_BROOD_BITS = 24
   };
 
+  /// Tags for the concrete storage type of each level
+  enum LevelStorage : char
+  {
+    DENSE16_LEVEL,
+    DENSE32_LEVEL,
+    SPARSE16_LEVEL,
+    SPARSE32_LEVEL,
+    SPARSE64_LEVEL,
+    SPARSE_PT_LEVEL
+  };
+  using LevelStorageMap = slam::Map<LevelStorage>;
+
   using DenseOctLevType = DenseOctreeLevel<DIM, BlockDataType, axom::uint16>;
+  using Dense32OctLevType = DenseOctreeLevel<DIM, BlockDataType, axom::uint32>;
   using Sparse16OctLevType = SparseOctreeLevel<DIM, BlockDataType, axom::uint16>;
   using Sparse32OctLevType = SparseOctreeLevel<DIM, BlockDataType, axom::uint32>;
   using Sparse64OctLevType = SparseOctreeLevel<DIM, BlockDataType, axom::uint64>;
   using SparsePtOctLevType = SparseOctreeLevel<DIM, BlockDataType, GridPt>;
 
   using DenseOctLevPtr = DenseOctLevType*;
+  using Dense32OctLevPtr = Dense32OctLevType*;
   using Sparse16OctLevPtr = Sparse16OctLevType*;
   using Sparse32OctLevPtr = Sparse32OctLevType*;
   using Sparse64OctLevPtr = Sparse64OctLevType*;
@@ -454,29 +472,113 @@ private:
     return dynamic_cast<DerivedPtrType>(base) != nullptr;
   }
 
+  /**
+   * \brief Applies \a func to a pointer to the concrete OctreeLevel
+   * instance at level \a lev
+   *
+   * \note This avoids virtual function calls in frequently used accessors.
+   * All invocations of \a func must have the same return type.
+   */
+  template <typename Func>
+  decltype(auto) applyToLevel(int lev, Func&& func) const
+  {
+    OctreeLevelType* level = m_leavesLevelMap[lev];
+    switch(m_levelStorage[lev])
+    {
+    case DENSE16_LEVEL:
+      SLIC_ASSERT(checkCast<DenseOctLevPtr>(level));
+      return func(static_cast<DenseOctLevPtr>(level));
+    case DENSE32_LEVEL:
+      SLIC_ASSERT(checkCast<Dense32OctLevPtr>(level));
+      return func(static_cast<Dense32OctLevPtr>(level));
+    case SPARSE16_LEVEL:
+      SLIC_ASSERT(checkCast<Sparse16OctLevPtr>(level));
+      return func(static_cast<Sparse16OctLevPtr>(level));
+    case SPARSE32_LEVEL:
+      SLIC_ASSERT(checkCast<Sparse32OctLevPtr>(level));
+      return func(static_cast<Sparse32OctLevPtr>(level));
+    case SPARSE64_LEVEL:
+      SLIC_ASSERT(checkCast<Sparse64OctLevPtr>(level));
+      return func(static_cast<Sparse64OctLevPtr>(level));
+    case SPARSE_PT_LEVEL:
+    default:
+      SLIC_ASSERT(checkCast<SparsePtOctLevPtr>(level));
+      return func(static_cast<SparsePtOctLevPtr>(level));
+    }
+  }
+
+  /// Returns the storage type that is used for level \a lev by default
+  static LevelStorage defaultLevelStorage(int lev)
+  {
+    // Use DenseOctreeLevel on first few levels to reduce allocations
+    // and fragmentation Use Morton-based SparseOctreeLevel
+    // (key is smallest possible integer) on next few levels.
+    // Use point bases SparseOctreeLevel (key is Point<int, DIM>,
+    // hashed using a MortonIndex)  when MortonIndex requires more than 64
+    if(lev <= MAX_DENSE_LEV)
+      return DENSE16_LEVEL;
+    else if(lev <= MAX_SPARSE16_LEV)
+      return SPARSE16_LEVEL;
+    else if(lev <= MAX_SPARSE32_LEV)
+      return SPARSE32_LEVEL;
+    else if(lev <= MAX_SPARSE64_LEV)
+      return SPARSE64_LEVEL;
+    else
+      return SPARSE_PT_LEVEL;
+  }
+
+  /// Allocates an empty level of the given \a storage type at level \a lev
+  static OctreeLevelType* createLevel(int lev, LevelStorage storage)
+  {
+    switch(storage)
+    {
+    case DENSE16_LEVEL:
+      return new DenseOctLevType(lev);
+    case DENSE32_LEVEL:
+      return new Dense32OctLevType(lev);
+    case SPARSE16_LEVEL:
+      return new Sparse16OctLevType(lev);
+    case SPARSE32_LEVEL:
+      return new Sparse32OctLevType(lev);
+    case SPARSE64_LEVEL:
+      return new Sparse64OctLevType(lev);
+    case SPARSE_PT_LEVEL:
+    default:
+      return new SparsePtOctLevType(lev);
+    }
+  }
+
+  /// Copies the blocks of level \a lev into new storage of type \a storage
+  void convertLevel(int lev, LevelStorage storage)
+  {
+    OctreeLevelType* oldLevel = m_leavesLevelMap[lev];
+    OctreeLevelType* newLevel = createLevel(lev, storage);
+
+    for(auto it = oldLevel->begin(), itEnd = oldLevel->end(); it != itEnd; ++it)
+    {
+      const GridPt pt = it.pt();
+      if(!newLevel->hasBlock(pt))
+      {
+        newLevel->addAllChildren(BlockIndex(pt, lev).parent().pt());
+      }
+      (*newLevel)[pt] = *it;
+    }
+
+    delete oldLevel;
+    m_leavesLevelMap[lev] = newLevel;
+    m_levelStorage[lev] = storage;
+  }
+
 public:
   /**
    * Sets up an octree containing only the root block
    */
-  OctreeBase() : m_leavesLevelMap(&m_levels)
+  OctreeBase() : m_leavesLevelMap(&m_levels), m_levelStorage(&m_levels)
   {
     for(int i = 0; i < maxLeafLevel(); ++i)
     {
-      // Use DenseOctreeLevel on first few levels to reduce allocations
-      // and fragmentation Use Morton-based SparseOctreeLevel
-      // (key is smallest possible integer) on next few levels.
-      // Use point bases SparseOctreeLevel (key is Point<int, DIM>,
-      // hashed using a MortonIndex)  when MortonIndex requires more than 64
-      if(i <= MAX_DENSE_LEV)
-        m_leavesLevelMap[i] = new DenseOctLevType(i);
-      else if(i <= MAX_SPARSE16_LEV)
-        m_leavesLevelMap[i] = new Sparse16OctLevType(i);
-      else if(i <= MAX_SPARSE32_LEV)
-        m_leavesLevelMap[i] = new Sparse32OctLevType(i);
-      else if(i <= MAX_SPARSE64_LEV)
-        m_leavesLevelMap[i] = new Sparse64OctLevType(i);
-      else
-        m_leavesLevelMap[i] = new SparsePtOctLevType(i);
+      m_levelStorage[i] = defaultLevelStorage(i);
+      m_leavesLevelMap[i] = createLevel(i, m_levelStorage[i]);
     }
 
     // Add the root block to the octree
@@ -612,6 +714,99 @@ public:
     return *m_leavesLevelMap[lev];
   }
 
+  /**
+   * \brief Returns a summary of the blocks and storage of level \a lev
+   *
+   * \note This function iterates through the blocks of the level
+   */
+  OctreeLevelStatistics levelStatistics(int lev) const
+  {
+    const OctreeLevelType& octLevel = getOctreeLevel(lev);
+
+    OctreeLevelStatistics stats;
+    stats.level = lev;
+    stats.numBlocks = octLevel.numBlocks();
+    stats.numLeafBlocks = octLevel.numLeafBlocks();
+    stats.loadFactor = octLevel.loadFactor();
+    stats.numBytes = octLevel.numBytes();
+    return stats;
+  }
+
+  /**
+   * \brief Predicate to check if level \a lev uses dense (array-based)
+   * storage rather than a hash map
+   */
+  bool isDenseLevel(int lev) const
+  {
+    return m_levelStorage[lev] == DENSE16_LEVEL ||
+      m_levelStorage[lev] == DENSE32_LEVEL;
+  }
+
+  /**
+   * \brief Converts the storage of the octree's levels between hash maps and
+   * dense arrays based on the fraction of each level's blocks that are present
+   *
+   * The fill ratio of a level is the number of its blocks divided by the
+   * number of possible blocks at that level. Sparse levels whose fill ratio is
+   * at least \a denseFillRatio are converted to dense Morton-ordered arrays,
+   * which are indexed directly instead of through a hash function.
+   * Levels that were converted and whose fill ratio has dropped below
+   * \a sparseFillRatio are converted back to sparse storage.
+   *
+   * \param [in] denseFillRatio Fill ratio for converting to dense storage
+   * \param [in] sparseFillRatio Fill ratio for converting back to sparse
+   * storage
+   * \return The number of levels whose storage was converted
+   *
+   * \pre sparseFillRatio <= denseFillRatio
+   * \note Levels are only converted to dense storage when they have at most
+   * 2^24 broods (e.g. levels up to 9 in 3D), which bounds the array's memory
+   * \warning Converting a level invalidates references and iterators to its
+   * block data, so this should be called once the octree has been built
+   */
+  int updateLevelStorage(double denseFillRatio = 0.5,
+                         double sparseFillRatio = 0.25)
+  {
+    SLIC_ASSERT(sparseFillRatio <= denseFillRatio);
+
+    int numConverted = 0;
+    for(int lev = MAX_DENSE_LEV + 1; lev < maxLeafLevel(); ++lev)
+    {
+      const double fillRatio =
+        getOctreeLevel(lev).numBlocks() / std::ldexp(1., DIM * lev);
+
+      if(m_levelStorage[lev] == DENSE32_LEVEL)
+      {
+        if(fillRatio < sparseFillRatio)
+        {
+          convertLevel(lev, defaultLevelStorage(lev));
+          ++numConverted;
+        }
+      }
+      else if(fillRatio >= denseFillRatio &&
+              DIM * (lev - 1) <= MAX_DENSE_BROOD_BITS)
+      {
+        convertLevel(lev, DENSE32_LEVEL);
+        ++numConverted;
+      }
+    }
+
+    return numConverted;
+  }
+
+  /**
+   * \brief Estimates the number of bytes allocated by the levels of the octree
+   */
+  std::size_t numBytes() const
+  {
+    std::size_t bytes = 0;
+    for(int lev = 0; lev < maxLeafLevel(); ++lev)
+    {
+      bytes += getOctreeLevel(lev).numBytes();
+    }
+    return bytes;
+  }
+
 public:
   /**
    * \brief Predicate to determine if level lev is in the range
@@ -686,37 +881,8 @@ public:
    */
   bool hasBlock(const GridPt& pt, int lev) const
   {
-    bool ret = false;
-    if(!isLevelValid(lev))
-    {
-      // No-op
-    }
-    else if(lev <= MAX_DENSE_LEV)
-    {
-      SLIC_ASSERT(checkCast<DenseOctLevPtr>(m_leavesLevelMap[lev]));
-      ret = static_cast<DenseOctLevPtr>(m_leavesLevelMap[lev])->hasBlock(pt);
-    }
-    else if(lev <= MAX_SPARSE16_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse16OctLevPtr>(m_leavesLevelMap[lev]));
-      ret = static_cast<Sparse16OctLevPtr>(m_leavesLevelMap[lev])->hasBlock(pt);
-    }
-    else if(lev <= MAX_SPARSE32_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse32OctLevPtr>(m_leavesLevelMap[lev]));
-      ret = static_cast<Sparse32OctLevPtr>(m_leavesLevelMap[lev])->hasBlock(pt);
-    }
-    else if(lev <= MAX_SPARSE64_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse64OctLevPtr>(m_leavesLevelMap[lev]));
-      ret = static_cast<Sparse64OctLevPtr>(m_leavesLevelMap[lev])->hasBlock(pt);
-    }
-    else
-    {
-      SLIC_ASSERT(checkCast<SparsePtOctLevPtr>(m_leavesLevelMap[lev]));
-      ret = static_cast<SparsePtOctLevPtr>(m_leavesLevelMap[lev])->hasBlock(pt);
-    }
-    return ret;
+    return isLevelValid(lev) &&
+      applyToLevel(lev, [&](auto* level) { return level->hasBlock(pt); });
   }
 
   /**
@@ -788,34 +954,10 @@ public:
     SLIC_ASSERT_MSG(hasBlock(block),
                     "Block " << block << " was not a block in the tree.");
 
-    const int& lev = block.level();
     const GridPt& pt = block.pt();
-
-    if(lev <= MAX_DENSE_LEV)
-    {
-      SLIC_ASSERT(checkCast<DenseOctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<DenseOctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else if(lev <= MAX_SPARSE16_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse16OctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<Sparse16OctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else if(lev <= MAX_SPARSE32_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse32OctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<Sparse32OctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else if(lev <= MAX_SPARSE64_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse64OctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<Sparse64OctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else
-    {
-      SLIC_ASSERT(checkCast<SparsePtOctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<SparsePtOctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
+    return applyToLevel(block.level(), [&](auto* level) -> BlockDataType& {
+      return (*level)[pt];
+    });
   }
 
   /**
@@ -829,34 +971,11 @@ public:
     SLIC_ASSERT_MSG(hasBlock(block),
                     "Block " << block << " was not a block in the tree.");
 
-    const int& lev = block.level();
     const GridPt& pt = block.pt();
-
-    if(lev <= MAX_DENSE_LEV)
-    {
-      SLIC_ASSERT(checkCast<DenseOctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<DenseOctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else if(lev <= MAX_SPARSE16_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse16OctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<Sparse16OctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else if(lev <= MAX_SPARSE32_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse32OctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<Sparse32OctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else if(lev <= MAX_SPARSE64_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse64OctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<Sparse64OctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
-    else
-    {
-      SLIC_ASSERT(checkCast<SparsePtOctLevPtr>(m_leavesLevelMap[lev]));
-      return (*static_cast<SparsePtOctLevPtr>(m_leavesLevelMap[lev]))[pt];
-    }
+    return applyToLevel(block.level(),
+                        [&](const auto* level) -> const BlockDataType& {
+                          return (*level)[pt];
+                        });
   }
 
   /**
@@ -916,41 +1035,9 @@ protected:
    */
   TreeBlockStatus blockStatus(const GridPt& pt, int lev) const
   {
-    TreeBlockStatus bStat = BlockNotInTree;
-    if(!isLevelValid(lev))
-    {
-      // No-op
-    }
-    else if(lev <= MAX_DENSE_LEV)
-    {
-      SLIC_ASSERT(checkCast<DenseOctLevPtr>(m_leavesLevelMap[lev]));
-      bStat = static_cast<DenseOctLevPtr>(m_leavesLevelMap[lev])->blockStatus(pt);
-    }
-    else if(lev <= MAX_SPARSE16_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse16OctLevPtr>(m_leavesLevelMap[lev]));
-      bStat =
-        static_cast<Sparse16OctLevPtr>(m_leavesLevelMap[lev])->blockStatus(pt);
-    }
-    else if(lev <= MAX_SPARSE32_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse32OctLevPtr>(m_leavesLevelMap[lev]));
-      bStat =
-        static_cast<Sparse32OctLevPtr>(m_leavesLevelMap[lev])->blockStatus(pt);
-    }
-    else if(lev <= MAX_SPARSE64_LEV)
-    {
-      SLIC_ASSERT(checkCast<Sparse64OctLevPtr>(m_leavesLevelMap[lev]));
-      bStat =
-        static_cast<Sparse64OctLevPtr>(m_leavesLevelMap[lev])->blockStatus(pt);
-    }
-    else
-    {
-      SLIC_ASSERT(checkCast<SparsePtOctLevPtr>(m_leavesLevelMap[lev]));
-      bStat =
-        static_cast<SparsePtOctLevPtr>(m_leavesLevelMap[lev])->blockStatus(pt);
-    }
-    return bStat;
+    return !isLevelValid(lev)
+      ? BlockNotInTree
+      : applyToLevel(lev, [&](auto* level) { return level->blockStatus(pt); });
   }
 
   /**
@@ -974,6 +1061,7 @@ private:
 protected:
   OctreeLevels m_levels;
   LeafIndicesLevelMap m_leavesLevelMap;
+  LevelStorageMap m_levelStorage;
 };
 
 }  // end namespace spin
@@ -27,6 +27,7 @@
 #include "axom/primal/geometry/NumericArray.hpp"
 #include "axom/spin/Brood.hpp"
 
+#include <cstddef>
 #include <iterator>
 
 namespace axom
@@ -44,6 +45,20 @@ enum TreeBlockStatus
   InternalBlock   /** Status of blocks that are internal to the tree */
 };
 
+/**
+ * \brief Summary of the blocks and storage of a single OctreeLevel
+ *
+ * \sa OctreeBase::levelStatistics()
+ */
+struct OctreeLevelStatistics
+{
+  int level {-1};          /** The level of resolution */
+  int numBlocks {0};       /** Number of blocks (internal and leaf) */
+  int numLeafBlocks {0};   /** Number of leaf blocks */
+  double loadFactor {0.};  /** Fraction of the level's storage in use */
+  std::size_t numBytes {0}; /** Estimated number of allocated bytes */
+};
+
 /**
  * \class
  * \brief An abstract base class to represent a sparse level of blocks within an
@@ -355,6 +370,16 @@ public:
    */
   virtual int numLeafBlocks() const = 0;
 
+  /** \brief Virtual function to compute the load factor of the level,
+   * i.e. the fraction of its (hash map or array) storage that is in use
+   */
+  virtual double loadFactor() const = 0;
+
+  /** \brief Virtual function to estimate the number of bytes
+   * allocated by the level, including its block data
+   */
+  virtual std::size_t numBytes() const = 0;
+
 protected:
   int m_level;
 };
@@ -379,6 +379,28 @@ public:
     return count;
   }
 
+  /** \brief Returns the load factor of the level's hash map */
+  double loadFactor() const { return static_cast<double>(m_map.load_factor()); }
+
+  /**
+   * \brief Estimates the number of bytes allocated by the level
+   *
+   * \note This is an estimate since it depends on the hash map implementation
+   */
+  std::size_t numBytes() const
+  {
+    using ValueType = typename MapType::value_type;
+#if defined(AXOM_USE_SPARSEHASH)
+    // dense_hash_map stores its values in a flat array of buckets
+    return sizeof(*this) + m_map.bucket_count() * sizeof(ValueType);
+#else
+    // unordered_map has an array of bucket pointers and allocates a node,
+    // with a 'next' pointer and a cached hash, for each value
+    return sizeof(*this) + m_map.bucket_count() * sizeof(void*) +
+      m_map.size() * (sizeof(ValueType) + 2 * sizeof(void*));
+#endif
+  }
+
   /**
    * \brief Helper function to determine the status of an
    * octree block within this octree level
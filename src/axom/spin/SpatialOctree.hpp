@@ -13,10 +13,32 @@
 
 #include "axom/spin/OctreeBase.hpp"
 
+#include <atomic>
+#include <cstdint>
+
 namespace axom
 {
 namespace spin
 {
+/**
+ * \brief Counters for the point location queries of a SpatialOctree
+ *
+ * \sa SpatialOctree::enableQueryStatistics(), SpatialOctree::findLeafBlock()
+ */
+struct OctreeQueryStatistics
+{
+  std::uint64_t numQueries {0};      /** Number of leaf block queries */
+  std::uint64_t numLevelsProbed {0}; /** Total number of levels probed */
+  int maxLevelsProbed {0};           /** Most levels probed by a query */
+
+  /** \brief The average number of levels probed per query */
+  double averageLevelsProbed() const
+  {
+    return numQueries > 0 ? static_cast<double>(numLevelsProbed) / numQueries
+                          : 0.;
+  }
+};
+
 /**
  * \class SpatialOctree
  * \brief Adds spatial extents to an OctreeBase, allowing point location
@@ -121,6 +143,7 @@ public:
    */
   BlockIndex findLeafBlock(const SpacePt& pt, int startingLevel = -1) const
   {
+    int numProbes = 0;
     SLIC_ASSERT_MSG(m_boundingBox.contains(pt),
                     "SpatialOctree::findLeafNode -- Did not find "
                       << pt << " in bounding box " << m_boundingBox);
@@ -133,6 +156,7 @@ public:
 
     while(minLev <= maxLev)
     {
+      ++numProbes;
       GridPt gridPt = findGridCellAtLevel(pt, lev);
       switch(this->blockStatus(gridPt, lev))
       {
@@ -147,6 +171,7 @@ public:
         lev = (maxLev + minLev) >> 1;
         break;
       case LeafBlock:
+        if(m_collectQueryStatistics) recordQuery(numProbes);
         return BlockIndex(gridPt, lev);
       }
     }
@@ -192,6 +217,54 @@ public:
     return quantizedPt;
   }
 
+  /**
+   * \brief Turns the collection of query statistics on or off
+   *
+   * When enabled, each call to findLeafBlock() updates the counters returned
+   * by queryStatistics(). The counters are updated atomically, so queries
+   * can be run concurrently. Collection is disabled by default.
+   */
+  void enableQueryStatistics(bool enable = true)
+  {
+    m_collectQueryStatistics = enable;
+  }
+
+  /** \brief Predicate to check if query statistics are being collected */
+  bool queryStatisticsEnabled() const { return m_collectQueryStatistics; }
+
+  /** \brief Returns the query statistics collected since the last reset */
+  OctreeQueryStatistics queryStatistics() const
+  {
+    OctreeQueryStatistics stats;
+    stats.numQueries = m_numQueries.load();
+    stats.numLevelsProbed = m_numLevelsProbed.load();
+    stats.maxLevelsProbed = m_maxLevelsProbed.load();
+    return stats;
+  }
+
+  /** \brief Resets the query statistics counters */
+  void resetQueryStatistics()
+  {
+    m_numQueries = 0;
+    m_numLevelsProbed = 0;
+    m_maxLevelsProbed = 0;
+  }
+
+private:
+  /// Updates the query statistics for a query that probed \a numProbes levels
+  void recordQuery(int numProbes) const
+  {
+    m_numQueries.fetch_add(1, std::memory_order_relaxed);
+    m_numLevelsProbed.fetch_add(numProbes, std::memory_order_relaxed);
+
+    int prevMax = m_maxLevelsProbed.load(std::memory_order_relaxed);
+    while(numProbes > prevMax &&
+          !m_maxLevelsProbed.compare_exchange_weak(prevMax,
+                                                   numProbes,
+                                                   std::memory_order_relaxed))
+    { }
+  }
+
 private:
   DISABLE_COPY_AND_ASSIGNMENT(SpatialOctree);
   DISABLE_MOVE_AND_ASSIGNMENT(SpatialOctree);
@@ -202,6 +275,11 @@ protected:
   SpaceVectorLevelMap m_invDeltaLevelMap;  // Its inverse is useful for
                                            // quantizing
   GeometricBoundingBox m_boundingBox;
+
+  bool m_collectQueryStatistics {false};
+  mutable std::atomic<std::uint64_t> m_numQueries {0};
+  mutable std::atomic<std::uint64_t> m_numLevelsProbed {0};
+  mutable std::atomic<int> m_maxLevelsProbed {0};
 };
 
 }  // end namespace spin
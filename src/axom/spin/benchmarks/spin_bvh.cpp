@@ -0,0 +1,139 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/core.hpp"
+#include "axom/slic.hpp"
+#include "axom/spin/BVH.hpp"
+
+//------------------------------------------------------------------------------
+namespace
+{
+constexpr int DIM = 3;
+using BoxType = axom::primal::BoundingBox<double, DIM>;
+using PointType = axom::primal::Point<double, DIM>;
+
+template <axom::spin::BVHType Impl>
+using BVHType = axom::spin::BVH<DIM, axom::SEQ_EXEC, double, Impl>;
+
+constexpr auto LINEAR = axom::spin::BVHType::LinearBVH;
+constexpr auto QUANTIZED8 = axom::spin::BVHType::QuantizedBVH8;
+constexpr auto QUANTIZED16 = axom::spin::BVHType::QuantizedBVH16;
+
+double randomCoord() { return 100. * std::rand() / RAND_MAX; }
+
+// Generate sz random boxes in [0,100]^3 whose sizes vary from 0.01 to 1
+std::vector<BoxType> generateRandomBoxes(int sz)
+{
+  std::vector<BoxType> boxes(sz);
+  for(int i = 0; i < sz; ++i)
+  {
+    BoxType box(PointType {randomCoord(), randomCoord(), randomCoord()});
+    box.expand(std::pow(10., (i % 3) - 2.));
+    boxes[i] = box;
+  }
+  return boxes;
+}
+
+std::vector<PointType> generateRandomPoints(int sz)
+{
+  std::vector<PointType> pts(sz);
+  for(auto& pt : pts)
+  {
+    pt = PointType {randomCoord(), randomCoord(), randomCoord()};
+  }
+  return pts;
+}
+
+void CustomArgs(benchmark::internal::Benchmark* b)
+{
+  b->Arg(1 << 12);
+  b->Arg(1 << 16);
+  b->Arg(1 << 20);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <axom::spin::BVHType Impl>
+void bvh_build(benchmark::State& state)
+{
+  const int sz = state.range(0);
+  const auto boxes = generateRandomBoxes(sz);
+
+  while(state.KeepRunning())
+  {
+    BVHType<Impl> bvh;
+    bvh.initialize(boxes.data(), sz);
+    benchmark::DoNotOptimize(bvh.getBounds());
+  }
+
+  state.SetItemsProcessed(state.iterations() * sz);
+}
+BENCHMARK_TEMPLATE(bvh_build, LINEAR)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(bvh_build, QUANTIZED8)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(bvh_build, QUANTIZED16)->Apply(CustomArgs);
+
+template <axom::spin::BVHType Impl>
+void bvh_find_points(benchmark::State& state)
+{
+  const int sz = state.range(0);
+  const auto boxes = generateRandomBoxes(sz);
+  const auto pts = generateRandomPoints(sz);
+
+  BVHType<Impl> bvh;
+  bvh.initialize(boxes.data(), sz);
+
+  axom::Array<axom::IndexType> offsets(sz), counts(sz), candidates;
+  while(state.KeepRunning())
+  {
+    bvh.findPoints(offsets, counts, candidates, sz, pts.data());
+    benchmark::DoNotOptimize(candidates.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * sz);
+}
+BENCHMARK_TEMPLATE(bvh_find_points, LINEAR)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(bvh_find_points, QUANTIZED8)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(bvh_find_points, QUANTIZED16)->Apply(CustomArgs);
+
+template <axom::spin::BVHType Impl>
+void bvh_find_bounding_boxes(benchmark::State& state)
+{
+  const int sz = state.range(0);
+  const auto boxes = generateRandomBoxes(sz);
+
+  BVHType<Impl> bvh;
+  bvh.initialize(boxes.data(), sz);
+
+  axom::Array<axom::IndexType> offsets(sz), counts(sz), candidates;
+  while(state.KeepRunning())
+  {
+    bvh.findBoundingBoxes(offsets, counts, candidates, sz, boxes.data());
+    benchmark::DoNotOptimize(candidates.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * sz);
+}
+BENCHMARK_TEMPLATE(bvh_find_bounding_boxes, LINEAR)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(bvh_find_bounding_boxes, QUANTIZED8)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(bvh_find_bounding_boxes, QUANTIZED16)->Apply(CustomArgs);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  std::srand(std::time(NULL));
+
+  ::benchmark::Initialize(&argc, argv);
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
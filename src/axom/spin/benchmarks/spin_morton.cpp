@@ -0,0 +1,144 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#include "benchmark/benchmark_api.h"
+#include "axom/slic.hpp"
+#include "axom/spin/MortonIndex.hpp"
+
+//------------------------------------------------------------------------------
+namespace
+{
+using CoordType = axom::int32;
+using MortonIndexType = axom::uint64;
+
+template <int DIM>
+using GridPoint = axom::primal::Point<CoordType, DIM>;
+
+template <int DIM>
+using MortonizerType = axom::spin::Mortonizer<CoordType, MortonIndexType, DIM>;
+
+// Generate sz random grid points within the valid range of the Mortonizer
+template <int DIM>
+std::vector<GridPoint<DIM>> generateRandomPoints(int sz)
+{
+  const int maxCoord = 1 << MortonizerType<DIM>::maxBitsPerCoord();
+
+  std::vector<GridPoint<DIM>> pts(sz);
+  for(auto& pt : pts)
+  {
+    for(int d = 0; d < DIM; ++d)
+    {
+      pt[d] = std::rand() % maxCoord;
+    }
+  }
+  return pts;
+}
+
+void CustomArgs(benchmark::internal::Benchmark* b)
+{
+  b->Arg(1 << 10);
+  b->Arg(1 << 16);
+  b->Arg(1 << 20);
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+template <int DIM>
+void morton_scalar(benchmark::State& state)
+{
+  const int sz = state.range(0);
+  const auto pts = generateRandomPoints<DIM>(sz);
+  std::vector<MortonIndexType> out(sz);
+
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i < sz; ++i)
+    {
+      out[i] = MortonizerType<DIM>::mortonize(pts[i]);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * sz);
+}
+BENCHMARK_TEMPLATE(morton_scalar, 2)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(morton_scalar, 3)->Apply(CustomArgs);
+
+template <int DIM>
+void morton_batched(benchmark::State& state)
+{
+  const int sz = state.range(0);
+  const auto pts = generateRandomPoints<DIM>(sz);
+  std::vector<MortonIndexType> out(sz);
+
+  while(state.KeepRunning())
+  {
+    MortonizerType<DIM>::mortonize(pts.data(), sz, out.data());
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * sz);
+}
+BENCHMARK_TEMPLATE(morton_batched, 2)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(morton_batched, 3)->Apply(CustomArgs);
+
+template <int DIM>
+void morton_batched_lut(benchmark::State& state)
+{
+  const int sz = state.range(0);
+  const auto pts = generateRandomPoints<DIM>(sz);
+  std::vector<MortonIndexType> out(sz);
+
+  while(state.KeepRunning())
+  {
+    axom::spin::internal::mortonizeLUT<MortonizerType<DIM>>(pts.data(),
+                                                            sz,
+                                                            out.data());
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * sz);
+}
+BENCHMARK_TEMPLATE(morton_batched_lut, 2)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(morton_batched_lut, 3)->Apply(CustomArgs);
+
+template <int DIM>
+void demorton_scalar(benchmark::State& state)
+{
+  const int sz = state.range(0);
+  const auto pts = generateRandomPoints<DIM>(sz);
+  std::vector<MortonIndexType> codes(sz);
+  MortonizerType<DIM>::mortonize(pts.data(), sz, codes.data());
+
+  while(state.KeepRunning())
+  {
+    for(int i = 0; i < sz; ++i)
+    {
+      benchmark::DoNotOptimize(MortonizerType<DIM>::demortonize(codes[i]));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * sz);
+}
+BENCHMARK_TEMPLATE(demorton_scalar, 2)->Apply(CustomArgs);
+BENCHMARK_TEMPLATE(demorton_scalar, 3)->Apply(CustomArgs);
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  std::srand(std::time(NULL));
+
+  ::benchmark::Initialize(&argc, argv);
+  axom::slic::SimpleLogger logger;  // create & initialize test logger,
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return 0;
+}
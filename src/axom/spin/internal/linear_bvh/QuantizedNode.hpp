@@ -0,0 +1,207 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_QUANTIZEDNODE_HPP_
+#define AXOM_SPIN_QUANTIZEDNODE_HPP_
+
+#include "axom/config.hpp"       // compile-time definitions
+#include "axom/core/Macros.hpp"  // for AXOM_HOST_DEVICE
+#include "axom/core/Types.hpp"   // for axom types
+#include "axom/core/utilities/Utilities.hpp"  // for floor(), ceil()
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+#include "axom/primal/geometry/Point.hpp"
+
+#include <cmath>        // for frexp()
+#include <cstring>      // for memcpy()
+#include <limits>       // for std::numeric_limits
+#include <type_traits>  // for std::conditional
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief QuantizedNode stores an inner node of a BVH with the bounding boxes
+ *  of its two children in a compressed form.
+ *
+ * The child bounding boxes are stored as unsigned integer offsets on a grid
+ * spanning the union of the two children. The grid has an origin, given by
+ * the lower corner of the union, and a power-of-two spacing for each axis.
+ * The offsets are rounded outward, so the decoded bounding boxes always
+ * contain the original ones. Since the spacing is a power of two, decoding
+ * is exact up to a single rounding in the addition to the origin, which is
+ * accounted for by the encoding. The spacing is at least the smallest normal
+ * FloatType, so it is cheap to compute from its exponent.
+ *
+ * \tparam FloatType the floating point type of the bounding boxes
+ * \tparam NDIMS the number of dimensions
+ * \tparam QuantType the unsigned integer type of the offsets, i.e. uint8 or
+ *  uint16
+ *
+ * \note A node holds the grid, the offsets and the indices of both children.
+ *  For QuantType=uint16, it fits in a 64-byte cache line for double precision
+ *  in 3D, compared to 104 bytes in the uncompressed layout.
+ */
+template <typename FloatType, int NDIMS, typename QuantType>
+struct QuantizedNode
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+
+  static constexpr int32 MAX_OFFSET = std::numeric_limits<QuantType>::max();
+  static constexpr int EXPONENT_BIAS =
+    std::numeric_limits<FloatType>::max_exponent - 1;
+
+  FloatType m_origin[NDIMS];
+  int32 m_children[2];
+  QuantType m_lower[2][NDIMS];
+  QuantType m_upper[2][NDIMS];
+  int16 m_exponent[NDIMS];
+
+  /*!
+   * \brief Stores the bounding boxes of the two children, rounded outward.
+   *
+   * \param [in] l_box the bounding box of the left child
+   * \param [in] r_box the bounding box of the right child
+   */
+  AXOM_HOST_DEVICE void encode(const BoxType& l_box, const BoxType& r_box)
+  {
+    BoxType bounds = l_box;
+    bounds.addBox(r_box);
+
+    const bool valid = bounds.isValid();
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      if(!valid)
+      {
+        m_origin[d] = FloatType {0};
+        m_exponent[d] = 0;
+        continue;
+      }
+
+      // find the smallest spacing whose grid covers the bounds
+      const FloatType lo = bounds.getMin()[d];
+      const FloatType hi = bounds.getMax()[d];
+      int exponent = 0;
+      std::frexp((hi - lo) / MAX_OFFSET, &exponent);
+      exponent = utilities::max(exponent, 1 - EXPONENT_BIAS);
+      while(lo + MAX_OFFSET * spacingOf(exponent) < hi)
+      {
+        ++exponent;
+      }
+
+      m_origin[d] = lo;
+      m_exponent[d] = static_cast<int16>(exponent);
+    }
+
+    encodeChild(0, l_box);
+    encodeChild(1, r_box);
+  }
+
+  /*!
+   * \brief Returns bounding boxes that contain the bounding boxes of the two
+   *  children.
+   *
+   * \param [out] l_box the bounding box of the left child
+   * \param [out] r_box the bounding box of the right child
+   */
+  AXOM_HOST_DEVICE void decode(BoxType& l_box, BoxType& r_box) const
+  {
+    PointType l_lo, l_hi, r_lo, r_hi;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType origin = m_origin[d];
+      const FloatType spacing = spacingOf(m_exponent[d]);
+      l_lo[d] = origin + m_lower[0][d] * spacing;
+      l_hi[d] = origin + m_upper[0][d] * spacing;
+      r_lo[d] = origin + m_lower[1][d] * spacing;
+      r_hi[d] = origin + m_upper[1][d] * spacing;
+    }
+    l_box = (m_lower[0][0] > m_upper[0][0]) ? BoxType {} : BoxType(l_lo, l_hi);
+    r_box = (m_lower[1][0] > m_upper[1][0]) ? BoxType {} : BoxType(r_lo, r_hi);
+  }
+
+  /// Sets the indices of the two children
+  AXOM_HOST_DEVICE void setChildren(int32 l_child, int32 r_child)
+  {
+    m_children[0] = l_child;
+    m_children[1] = r_child;
+  }
+
+  /// Returns the index of the given child, 0 for left and 1 for right
+  AXOM_HOST_DEVICE int32 child(int child) const { return m_children[child]; }
+
+private:
+  AXOM_HOST_DEVICE void encodeChild(int child, const BoxType& box)
+  {
+    // an empty range on the first axis marks an invalid bounding box
+    if(!box.isValid())
+    {
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        m_lower[child][d] = static_cast<QuantType>(MAX_OFFSET);
+        m_upper[child][d] = 0;
+      }
+      return;
+    }
+
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      const FloatType origin = m_origin[d];
+      const FloatType spacing = spacingOf(m_exponent[d]);
+      const FloatType lo = box.getMin()[d];
+      const FloatType hi = box.getMax()[d];
+
+      // round outward, then correct for rounding in the floating point ops
+      int32 lower = clampOffset(utilities::floor((lo - origin) / spacing));
+      while(lower > 0 && origin + lower * spacing > lo)
+      {
+        --lower;
+      }
+
+      int32 upper = clampOffset(utilities::ceil((hi - origin) / spacing));
+      while(upper < MAX_OFFSET && origin + upper * spacing < hi)
+      {
+        ++upper;
+      }
+
+      m_lower[child][d] = static_cast<QuantType>(lower);
+      m_upper[child][d] = static_cast<QuantType>(upper);
+    }
+  }
+
+  /// Returns the grid spacing 2^exponent, for an exponent of a normal number
+  AXOM_HOST_DEVICE static FloatType spacingOf(int exponent)
+  {
+    using BitsType = typename std::conditional<sizeof(FloatType) == 8,
+                                               std::uint64_t,
+                                               std::uint32_t>::type;
+
+    const BitsType bits = static_cast<BitsType>(exponent + EXPONENT_BIAS)
+      << (std::numeric_limits<FloatType>::digits - 1);
+    FloatType spacing;
+    memcpy(&spacing, &bits, sizeof(FloatType));
+    return spacing;
+  }
+
+  AXOM_HOST_DEVICE static int32 clampOffset(FloatType offset)
+  {
+    return (offset <= 0)
+      ? 0
+      : (offset >= MAX_OFFSET ? MAX_OFFSET : static_cast<int32>(offset));
+  }
+};
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_QUANTIZEDNODE_HPP_ */
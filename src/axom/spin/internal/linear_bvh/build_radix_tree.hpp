@@ -47,6 +47,8 @@ namespace linear_bvh
 //------------------------------------------------------------------------------
 //Returns 30 bit morton code for coordinates for
 // x, y, and z are expecting to be between [0,1]
+// The bit interleaving is done by spin::Mortonizer, which is shared with the
+// octrees and uses BMI2 on the host when it is available.
 template <typename FloatType, int Dims>
 static inline AXOM_HOST_DEVICE axom::int32 morton32_encode(
   const primal::Vector<FloatType, Dims>& point)
@@ -68,24 +70,6 @@ static inline AXOM_HOST_DEVICE axom::int32 morton32_encode(
   return convertPointToMorton<int32>(integer_pt);
 }
 
-//------------------------------------------------------------------------------
-//Returns 30 bit morton code for coordinates for
-//coordinates in the unit cude
-static inline AXOM_HOST_DEVICE axom::int64 morton64_encode(axom::float32 x,
-                                                           axom::float32 y,
-                                                           axom::float32 z = 0.0)
-{
-  //take the first 21 bits. Note, 2^21= 2097152.0f
-  x = fmin(fmax(x * 2097152.0f, 0.0f), 2097151.0f);
-  y = fmin(fmax(y * 2097152.0f, 0.0f), 2097151.0f);
-  z = fmin(fmax(z * 2097152.0f, 0.0f), 2097151.0f);
-
-  primal::Point<int64, 3> integer_pt =
-    primal::Point<int64, 3>::make_point((int64)x, (int64)y, (int64)z);
-
-  return convertPointToMorton<int64>(integer_pt);
-}
-
 template <typename ExecSpace, typename BoxIndexable, typename FloatType, int NDIMS>
 void transform_boxes(const BoxIndexable boxes,
                      ArrayView<primal::BoundingBox<FloatType, NDIMS>> aabbs,
@@ -259,12 +243,16 @@ void sort_mcodes(Array<uint32>& mcodes, int32 size, const ArrayView<int32> iter)
 
   array_counting<ExecSpace>(iter, size, 0, 1);
 
+  // compare through a view, since the comparator is copied by value
+  const auto mcodes_v = mcodes.view();
+
   AXOM_PERF_MARK_SECTION(
     "cpu_sort",
 
-    std::stable_sort(iter.begin(),
-                     iter.begin() + size,
-                     [=](int32 i1, int32 i2) { return mcodes[i1] < mcodes[i2]; });
+    std::stable_sort(
+      iter.begin(),
+      iter.begin() + size,
+      [=](int32 i1, int32 i2) { return mcodes_v[i1] < mcodes_v[i2]; });
 
   );
 
@@ -511,6 +499,107 @@ AXOM_HOST_DEVICE static inline int atomic_increment(int* addr)
 #endif  // AXOM_USE_RAJA
 }
 
+//------------------------------------------------------------------------------
+template <typename ExecSpace>
+AXOM_HOST_DEVICE static inline int atomic_add(int* addr, int value)
+{
+#ifdef AXOM_USE_RAJA
+  using atomic_policy = typename axom::execution_space<ExecSpace>::atomic_policy;
+
+  return RAJA::atomicAdd<atomic_policy>(addr, value);
+#else
+  static_assert(std::is_same<ExecSpace, SEQ_EXEC>::value,
+                "Only SEQ_EXEC supported without RAJA");
+
+  int old = *addr;
+  (*addr) += value;
+  return old;
+#endif  // AXOM_USE_RAJA
+}
+
+//------------------------------------------------------------------------------
+// Fetches a node index synchronized with another thread's store.
+// See sync_load() for bounding boxes.
+template <typename ExecSpace>
+AXOM_HOST_DEVICE static inline int32 sync_load_index(const int32& index)
+{
+#ifdef AXOM_DEVICE_CODE
+  return *reinterpret_cast<volatile const int32*>(&index);
+#else
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return index;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Writes a node index synchronized with another thread's read.
+// See sync_store() for bounding boxes.
+template <typename ExecSpace>
+AXOM_HOST_DEVICE static inline void sync_store_index(int32& index, int32 value)
+{
+#if defined(AXOM_DEVICE_CODE) && defined(AXOM_USE_RAJA)
+  using atomic_policy = typename axom::execution_space<ExecSpace>::atomic_policy;
+  RAJA::atomicExchange<atomic_policy>(&index, value);
+#else
+  index = value;
+  std::atomic_thread_fence(std::memory_order_release);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Returns a measure proportional to the surface area of a bounding box,
+// i.e., half its surface area in 3D and half its perimeter in 2D
+template <typename FloatType, int NDIMS>
+AXOM_HOST_DEVICE static inline FloatType surface_area(
+  const primal::BoundingBox<FloatType, NDIMS>& box)
+{
+  if(!box.isValid())
+  {
+    return FloatType {0};
+  }
+
+  const auto r = box.range();
+  return (NDIMS == 2)
+    ? r[0] + r[1]
+    : r[0] * r[1] + r[1] * r[NDIMS - 1] + r[NDIMS - 1] * r[0];
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Returns the summed surface area of the given bounding boxes of BVH
+ *  nodes, relative to the surface area of the bounds of the BVH.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+FloatType surface_area_cost(
+  ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  const primal::BoundingBox<FloatType, NDIMS>& bounds)
+{
+  AXOM_PERF_MARK_FUNCTION("surface_area_cost");
+
+  const IndexType num_nodes = inner_nodes.size();
+
+  FloatType total_area {0};
+#if defined(AXOM_USE_RAJA)
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_pol, FloatType> total_area_reduce(0);
+
+  for_all<ExecSpace>(
+    num_nodes,
+    AXOM_LAMBDA(IndexType i) {
+      total_area_reduce += surface_area(inner_nodes[i]);
+    });
+
+  total_area = total_area_reduce.get();
+#else
+  for_all<ExecSpace>(num_nodes, [&](IndexType i) {
+    total_area += surface_area(inner_nodes[i]);
+  });
+#endif
+
+  const FloatType root_area = surface_area(bounds);
+  return (root_area > 0) ? total_area / root_area : FloatType {0};
+}
+
 //------------------------------------------------------------------------------
 template <typename ExecSpace, typename FloatType, int NDIMS>
 void propagate_aabbs(RadixTree<FloatType, NDIMS>& data, int allocatorID)
@@ -585,6 +674,283 @@ void propagate_aabbs(RadixTree<FloatType, NDIMS>& data, int allocatorID)
     });
 }
 
+//------------------------------------------------------------------------------
+// Number of leaves of the treelets restructured by optimize_treelets()
+constexpr int TREELET_SIZE = 7;
+
+//------------------------------------------------------------------------------
+// Restructures the treelet rooted at inner node \a root to minimize the
+// summed surface area of its inner nodes, following Karras and Aila,
+// "Fast Parallel Construction of High-Quality Bounding Volume Hierarchies",
+// HPG 2013.
+//
+// The treelet is formed by repeatedly expanding its treelet-leaf with the
+// largest surface area, up to TREELET_SIZE leaves. The optimal binary tree over
+// the treelet-leaves is then found by dynamic programming over all subsets of
+// the leaves, and the treelet's inner nodes are reused for the new topology.
+//
+// The subtree of root must not be modified concurrently by other threads.
+template <typename ExecSpace, typename FloatType, int NDIMS>
+AXOM_HOST_DEVICE static inline void optimize_treelet(
+  int32 root,
+  int32 inner_size,
+  ArrayView<int32> lchildren_ptr,
+  ArrayView<int32> rchildren_ptr,
+  ArrayView<int32> parent_ptr,
+  ArrayView<primal::BoundingBox<FloatType, NDIMS>> inner_aabb_ptr,
+  ArrayView<const primal::BoundingBox<FloatType, NDIMS>> leaf_aabb_ptr)
+{
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  constexpr int NUM_SUBSETS = 1 << TREELET_SIZE;
+
+  auto node_aabb = [=](int32 node) -> BoxType {
+    return (node >= inner_size)
+      ? leaf_aabb_ptr[node - inner_size]
+      : sync_load<ExecSpace>(inner_aabb_ptr[node]);
+  };
+
+  // STEP 1: form the treelet
+  int32 internals[TREELET_SIZE - 1];
+  int32 leaves[TREELET_SIZE];
+  BoxType leaf_aabbs[TREELET_SIZE];
+  FloatType leaf_areas[TREELET_SIZE];
+
+  int num_internals = 1;
+  internals[0] = root;
+  leaves[0] = sync_load_index<ExecSpace>(lchildren_ptr[root]);
+  leaves[1] = sync_load_index<ExecSpace>(rchildren_ptr[root]);
+  int num_leaves = 2;
+  for(int i = 0; i < 2; ++i)
+  {
+    leaf_aabbs[i] = node_aabb(leaves[i]);
+    leaf_areas[i] = surface_area(leaf_aabbs[i]);
+  }
+
+  FloatType old_cost = surface_area(sync_load<ExecSpace>(inner_aabb_ptr[root]));
+  while(num_leaves < TREELET_SIZE)
+  {
+    int expand = -1;
+    for(int i = 0; i < num_leaves; ++i)
+    {
+      if(leaves[i] < inner_size &&
+         (expand == -1 || leaf_areas[i] > leaf_areas[expand]))
+      {
+        expand = i;
+      }
+    }
+    if(expand == -1)
+    {
+      break;
+    }
+
+    const int32 node = leaves[expand];
+    internals[num_internals++] = node;
+    old_cost += leaf_areas[expand];
+
+    leaves[expand] = sync_load_index<ExecSpace>(lchildren_ptr[node]);
+    leaves[num_leaves] = sync_load_index<ExecSpace>(rchildren_ptr[node]);
+    leaf_aabbs[expand] = node_aabb(leaves[expand]);
+    leaf_areas[expand] = surface_area(leaf_aabbs[expand]);
+    leaf_aabbs[num_leaves] = node_aabb(leaves[num_leaves]);
+    leaf_areas[num_leaves] = surface_area(leaf_aabbs[num_leaves]);
+    ++num_leaves;
+  }
+
+  if(num_leaves < 3)
+  {
+    return;
+  }
+
+  // STEP 2: find the optimal topology; the cost of a subset of the leaves
+  // is the summed area of the inner nodes of its optimal subtree
+  // the bounding box of each subset is the union of the bounding boxes of
+  // two smaller subsets, stored as raw coordinates to avoid initializing
+  // a BoundingBox for each subset
+  FloatType set_mins[NUM_SUBSETS][NDIMS];
+  FloatType set_maxs[NUM_SUBSETS][NDIMS];
+  FloatType costs[NUM_SUBSETS];
+  uint8 splits[NUM_SUBSETS];
+
+  const int full_set = (1 << num_leaves) - 1;
+  for(int set = 1; set <= full_set; ++set)
+  {
+    const int lowest = set & -set;
+    if(set == lowest)
+    {
+      int i = 0;
+      while((1 << i) != set)
+      {
+        ++i;
+      }
+      for(int d = 0; d < NDIMS; ++d)
+      {
+        set_mins[set][d] = leaf_aabbs[i].getMin()[d];
+        set_maxs[set][d] = leaf_aabbs[i].getMax()[d];
+      }
+      costs[set] = 0;
+      continue;
+    }
+
+    const int rest = set ^ lowest;
+    primal::Vector<FloatType, NDIMS> range;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      set_mins[set][d] = utilities::min(set_mins[rest][d], set_mins[lowest][d]);
+      set_maxs[set][d] = utilities::max(set_maxs[rest][d], set_maxs[lowest][d]);
+      range[d] =
+        utilities::max(set_maxs[set][d] - set_mins[set][d], FloatType {0});
+    }
+    const FloatType area = (NDIMS == 2)
+      ? range[0] + range[1]
+      : range[0] * range[1] + range[1] * range[NDIMS - 1] +
+        range[NDIMS - 1] * range[0];
+
+    // visit each partition once, with the lowest leaf in the first part
+    FloatType best_cost = costs[rest];
+    int best_split = lowest;
+    for(int sub = (rest - 1) & rest; sub != 0; sub = (sub - 1) & rest)
+    {
+      const int part = sub | lowest;
+      const FloatType cost = costs[part] + costs[set ^ part];
+      if(cost < best_cost)
+      {
+        best_cost = cost;
+        best_split = part;
+      }
+    }
+
+    costs[set] = area + best_cost;
+    splits[set] = static_cast<uint8>(best_split);
+  }
+
+  // keep the treelet unless the new topology is significantly better
+  if(!(costs[full_set] < old_cost * FloatType(0.999)))
+  {
+    return;
+  }
+
+  // STEP 3: rebuild the treelet, reusing its inner nodes
+  int32 stack_nodes[TREELET_SIZE];
+  int stack_sets[TREELET_SIZE];
+  int stack_size = 0;
+  int next_internal = 1;
+
+  stack_nodes[stack_size] = root;
+  stack_sets[stack_size] = full_set;
+  ++stack_size;
+
+  while(stack_size > 0)
+  {
+    --stack_size;
+    const int32 node = stack_nodes[stack_size];
+    const int set = stack_sets[stack_size];
+
+    const int child_sets[2] = {splits[set], set ^ splits[set]};
+    int32 children[2];
+    for(int c = 0; c < 2; ++c)
+    {
+      const int child_set = child_sets[c];
+      if((child_set & (child_set - 1)) == 0)
+      {
+        // a single treelet-leaf
+        int i = 0;
+        while((1 << i) != child_set)
+        {
+          ++i;
+        }
+        children[c] = leaves[i];
+      }
+      else
+      {
+        using PointType = typename BoxType::PointType;
+        const int32 child = internals[next_internal++];
+        sync_store<ExecSpace>(inner_aabb_ptr[child],
+                              BoxType(PointType(set_mins[child_set]),
+                                      PointType(set_maxs[child_set])));
+
+        stack_nodes[stack_size] = child;
+        stack_sets[stack_size] = child_set;
+        ++stack_size;
+        children[c] = child;
+      }
+      sync_store_index<ExecSpace>(parent_ptr[children[c]], node);
+    }
+
+    sync_store_index<ExecSpace>(lchildren_ptr[node], children[0]);
+    sync_store_index<ExecSpace>(rchildren_ptr[node], children[1]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Reduces the surface area cost of a radix tree by restructuring its treelets
+// in parallel, as proposed by Karras and Aila (HPG 2013).
+//
+// Each round processes the tree bottom-up with one thread per leaf, as in
+// propagate_aabbs(). The second thread to arrive at an inner node with at least
+// gamma leaves in its subtree restructures the treelet rooted at that node,
+// whose subtree is complete at this point. gamma starts at TREELET_SIZE and
+// doubles each round.
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void optimize_treelets(RadixTree<FloatType, NDIMS>& data,
+                       int num_rounds,
+                       int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("optimize_treelets");
+
+  const int inner_size = data.m_inner_size;
+  const int leaf_size = data.m_inner_size + 1;
+
+  const auto lchildren_ptr = data.m_left_children.view();
+  const auto rchildren_ptr = data.m_right_children.view();
+  const auto parent_ptr = data.m_parents.view();
+  const auto inner_aabb_ptr = data.m_inner_aabbs.view();
+  const ArrayView<const primal::BoundingBox<FloatType, NDIMS>> leaf_aabb_ptr =
+    data.m_leaf_aabbs.view();
+
+  Array<int32> counters(inner_size, inner_size, allocatorID);
+  const auto counters_ptr = counters.view();
+
+  for(int round = 0; round < num_rounds; ++round)
+  {
+    const int32 gamma = TREELET_SIZE << round;
+
+    counters.fill(0);
+
+    for_all<ExecSpace>(
+      leaf_size,
+      AXOM_LAMBDA(int32 i) {
+        int32 num_leaves = 1;
+        int32 current_node = parent_ptr[inner_size + i];
+
+        while(current_node != -1)
+        {
+          // The first thread to arrive stops. The second one gets the number
+          // of leaves under the first one's child as the old counter value.
+          int32 old =
+            atomic_add<ExecSpace>(&(counters_ptr[current_node]), num_leaves);
+          if(old == 0)
+          {
+            return;
+          }
+          num_leaves += old;
+
+          if(num_leaves >= gamma)
+          {
+            optimize_treelet<ExecSpace>(current_node,
+                                        inner_size,
+                                        lchildren_ptr,
+                                        rchildren_ptr,
+                                        parent_ptr,
+                                        inner_aabb_ptr,
+                                        leaf_aabb_ptr);
+          }
+
+          current_node = sync_load_index<ExecSpace>(parent_ptr[current_node]);
+        }
+      });
+  }
+}
+
 //------------------------------------------------------------------------------
 template <typename ExecSpace, typename BoxIndexable, typename FloatType, int NDIMS>
 void build_radix_tree(const BoxIndexable boxes,
@@ -626,6 +992,158 @@ void build_radix_tree(const BoxIndexable boxes,
   propagate_aabbs<ExecSpace>(radix_tree, allocatorID);
 }
 
+//------------------------------------------------------------------------------
+/*!
+ * \brief Emits the flat BVH layout from a radix tree.
+ *
+ * The ith inner node stores the bounding boxes and the indices of its two
+ * children at offsets 2i and 2i+1 of \a bvh_inner_nodes and
+ * \a bvh_inner_node_children. Inner children are stored as their offset 2j,
+ * leaf children as the ones-complement of their index in the sorted leafs.
+ * \a bvh_inner_node_parents and \a bvh_leaf_parents receive the offset of the
+ * bounding box of each inner node and leaf within its parent, -1 for the root.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void emit_bvh(const RadixTree<FloatType, NDIMS>& data,
+              ArrayView<primal::BoundingBox<FloatType, NDIMS>> bvh_inner_nodes,
+              ArrayView<int32> bvh_inner_node_children,
+              ArrayView<int32> bvh_inner_node_parents,
+              ArrayView<int32> bvh_leaf_parents)
+{
+  AXOM_PERF_MARK_FUNCTION("emit_bvh");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  const int32 inner_size = data.m_inner_size;
+  SLIC_ASSERT(inner_size == data.m_size - 1);
+
+  const auto lchildren_ptr = data.m_left_children.view();
+  const auto rchildren_ptr = data.m_right_children.view();
+
+  const auto leaf_aabb_ptr = data.m_leaf_aabbs.view();
+  const auto inner_aabb_ptr = data.m_inner_aabbs.view();
+
+  AXOM_PERF_MARK_SECTION("emit_bvh_parents",
+                         for_all<ExecSpace>(
+                           inner_size,
+                           AXOM_LAMBDA(int32 node) {
+                             BoxType l_aabb, r_aabb;
+                             const int32 out_offset = node * 2;
+
+                             if(node == 0)
+                             {
+                               bvh_inner_node_parents[node] = -1;
+                             }
+
+                             int32 lchild = lchildren_ptr[node];
+                             if(lchild >= inner_size)
+                             {
+                               l_aabb = leaf_aabb_ptr[lchild - inner_size];
+                               bvh_leaf_parents[lchild - inner_size] =
+                                 out_offset;
+                               lchild = -(lchild - inner_size + 1);
+                             }
+                             else
+                             {
+                               l_aabb = inner_aabb_ptr[lchild];
+                               bvh_inner_node_parents[lchild] = out_offset;
+                               // do the offset now
+                               lchild *= 2;
+                             }
+
+                             int32 rchild = rchildren_ptr[node];
+                             if(rchild >= inner_size)
+                             {
+                               r_aabb = leaf_aabb_ptr[rchild - inner_size];
+                               bvh_leaf_parents[rchild - inner_size] =
+                                 out_offset + 1;
+                               rchild = -(rchild - inner_size + 1);
+                             }
+                             else
+                             {
+                               r_aabb = inner_aabb_ptr[rchild];
+                               bvh_inner_node_parents[rchild] = out_offset + 1;
+                               // do the offset now
+                               rchild *= 2;
+                             }
+
+                             bvh_inner_nodes[out_offset + 0] = l_aabb;
+                             bvh_inner_nodes[out_offset + 1] = r_aabb;
+
+                             bvh_inner_node_children[out_offset + 0] = lchild;
+                             bvh_inner_node_children[out_offset + 1] = rchild;
+                           }););
+}
+
+//------------------------------------------------------------------------------
+/*!
+ * \brief Recomputes the bounding boxes of the flat BVH layout emitted by
+ *  emit_bvh() from new bounding boxes for its leafs.
+ *
+ * The boxes are propagated bottom-up in parallel. Each inner node is processed
+ * by the last of its two children to arrive, as determined by an atomic
+ * counter for each inner node.
+ */
+template <typename ExecSpace, typename BoxIndexable, typename FloatType, int NDIMS>
+void refit_bvh(const BoxIndexable boxes,
+               int32 size,
+               FloatType scale_factor,
+               ArrayView<const int32> leaf_nodes,
+               ArrayView<const int32> leaf_parents,
+               ArrayView<const int32> inner_node_parents,
+               ArrayView<primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+               int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("refit_bvh");
+
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  const int32 inner_size = inner_node_parents.size();
+
+  // STEP 1: reset the node bounding boxes; on the GPU, sync_load() polls
+  // for the stores of the other child
+  for_all<ExecSpace>(
+    inner_nodes.size(),
+    AXOM_LAMBDA(IndexType idx) { inner_nodes[idx] = BoxType {}; });
+
+  // STEP 2: propagate the leaf bounding boxes up to the root
+  Array<int32> counters(inner_size, inner_size, allocatorID);
+  const auto counters_ptr = counters.view();
+
+  AXOM_PERF_MARK_SECTION(
+    "refit_propagate_aabbs",
+    for_all<ExecSpace>(
+      size,
+      AXOM_LAMBDA(int32 i) {
+        BoxType aabb = boxes[leaf_nodes[i]];
+        aabb.scale(scale_factor);
+
+        int32 offset = leaf_parents[i];
+        sync_store<ExecSpace>(inner_nodes[offset], aabb);
+
+        while(offset != -1)
+        {
+          const int32 node = offset / 2;
+
+          // first child to get here leaves the node to its sibling
+          int32 old = atomic_increment<ExecSpace>(&(counters_ptr[node]));
+          if(old == 0)
+          {
+            return;
+          }
+
+          // the sibling's bounding box is stored next to this child's
+          aabb.addBox(sync_load<ExecSpace>(inner_nodes[offset ^ 1]));
+
+          offset = inner_node_parents[node];
+          if(offset != -1)
+          {
+            sync_store<ExecSpace>(inner_nodes[offset], aabb);
+          }
+        }
+      }););
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
@@ -28,10 +28,9 @@ AXOM_HOST_DEVICE
 inline bool leaf_node(const int32& nodeIdx) { return (nodeIdx < 0); }
 
 /*!
- * \brief Generic BVH traversal routine.
+ * \brief Generic BVH traversal routine over a user-supplied node layout.
  *
- * \param [in] inner_nodes pointer to the BVH bins.
- * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] load_children functor that loads the children of an inner node
  * \param [in] leaf_nodes pointer to the leaf node IDs.
  * \param [in] p the primitive in query, e.g., a point, ray, etc.
  * \param [in] B functor that defines the check for the bins
@@ -39,43 +38,26 @@ inline bool leaf_node(const int32& nodeIdx) { return (nodeIdx < 0); }
  * \param [in] Comp functor used for determining which child node to traverse
  *  down first if both bins are to be traversed
  *
- * \note The supplied functor `B` is expected to take the following two
- *  arguments:
- *    (1) The supplied primitive, p
- *    (2) a primal::BoundingBox< FloatType, NDIMS > of the BVH bin
- *
- * \note The supplied functor `Comp` is expected to take the following three
- *  arguments:
- *    (1) The left child bounding box
- *    (2) The right child bounding box
- *    (3) The primitive being queried
- *  It should return true if the primitive is closer to the right child bounding
- *  box (indicating a swap is necessary) and false if the primitive is closer to
- *  the left child bounding box.
- *
- * \see BVHData for the details on the internal data layout of the BVH.
- *
- * \note Moreover, the functor `B` returns a boolean status that indicates
- *  if the specified traversal predicate is satisfied.
+ * \note The supplied functor `load_children` is expected to take the index
+ *  of an inner node, followed by the bounding boxes and the indices of its
+ *  left and right children as output arguments. The root has index 0, and
+ *  leaf nodes have negative indices, i.e. the ones-complement of the leaf.
  *
+ * \see bvh_traverse() for the details on the functors `B`, `A` and `Comp`.
  */
-template <int NDIMS,
-          typename FloatType,
+template <typename BBoxType,
           typename PrimitiveType,
+          typename NodeLoader,
           typename InBinCheck,
           typename LeafAction,
           typename TraversePref>
-AXOM_HOST_DEVICE inline void bvh_traverse(
-  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
-  axom::ArrayView<const int32> inner_node_children,
-  axom::ArrayView<const int32> leaf_nodes,
-  const PrimitiveType& p,
-  InBinCheck&& B,
-  LeafAction&& A,
-  TraversePref&& Comp)
+AXOM_HOST_DEVICE inline void bvh_traverse_nodes(NodeLoader&& load_children,
+                                                const int32* leaf_nodes,
+                                                const PrimitiveType& p,
+                                                InBinCheck&& B,
+                                                LeafAction&& A,
+                                                TraversePref&& Comp)
 {
-  using BBoxType = primal::BoundingBox<FloatType, NDIMS>;
-
   // setup stack
   constexpr int32 STACK_SIZE = 64;
   constexpr int32 BARRIER = -2000000000;
@@ -91,12 +73,11 @@ AXOM_HOST_DEVICE inline void bvh_traverse(
     // Traverse until we hit a leaf node or the barrier.
     while(!leaf_node(current_node))
     {
-      BBoxType left_bin = inner_nodes[current_node + 0];
-      BBoxType right_bin = inner_nodes[current_node + 1];
+      BBoxType left_bin, right_bin;
+      int32 l_child, r_child;
+      load_children(current_node, left_bin, right_bin, l_child, r_child);
       const bool in_left = B(p, left_bin);
       const bool in_right = B(p, right_bin);
-      int32 l_child = inner_node_children[current_node + 0];
-      int32 r_child = inner_node_children[current_node + 1];
       bool swap = Comp(left_bin, right_bin, p);
 
       if(!in_left && !in_right)
@@ -141,7 +122,7 @@ AXOM_HOST_DEVICE inline void bvh_traverse(
     while(leaf_node(found_leaf) && found_leaf != BARRIER)
     {
       int leaf_idx = -found_leaf - 1;
-      A(leaf_idx, leaf_nodes.data());
+      A(leaf_idx, leaf_nodes);
       found_leaf = current_node;
       if(leaf_node(current_node) && current_node != BARRIER)
       {
@@ -154,6 +135,69 @@ AXOM_HOST_DEVICE inline void bvh_traverse(
   }  // END while
 }
 
+/*!
+ * \brief Generic BVH traversal routine.
+ *
+ * \param [in] inner_nodes pointer to the BVH bins.
+ * \param [in] inner_node_children pointer to pairs of child indices.
+ * \param [in] leaf_nodes pointer to the leaf node IDs.
+ * \param [in] p the primitive in query, e.g., a point, ray, etc.
+ * \param [in] B functor that defines the check for the bins
+ * \param [in] A functor that defines the leaf action
+ * \param [in] Comp functor used for determining which child node to traverse
+ *  down first if both bins are to be traversed
+ *
+ * \note The supplied functor `B` is expected to take the following two
+ *  arguments:
+ *    (1) The supplied primitive, p
+ *    (2) a primal::BoundingBox< FloatType, NDIMS > of the BVH bin
+ *
+ * \note The supplied functor `Comp` is expected to take the following three
+ *  arguments:
+ *    (1) The left child bounding box
+ *    (2) The right child bounding box
+ *    (3) The primitive being queried
+ *  It should return true if the primitive is closer to the right child bounding
+ *  box (indicating a swap is necessary) and false if the primitive is closer to
+ *  the left child bounding box.
+ *
+ * \see BVHData for the details on the internal data layout of the BVH.
+ *
+ * \note Moreover, the functor `B` returns a boolean status that indicates
+ *  if the specified traversal predicate is satisfied.
+ *
+ */
+template <int NDIMS,
+          typename FloatType,
+          typename PrimitiveType,
+          typename InBinCheck,
+          typename LeafAction,
+          typename TraversePref>
+AXOM_HOST_DEVICE inline void bvh_traverse(
+  axom::ArrayView<const primal::BoundingBox<FloatType, NDIMS>> inner_nodes,
+  axom::ArrayView<const int32> inner_node_children,
+  axom::ArrayView<const int32> leaf_nodes,
+  const PrimitiveType& p,
+  InBinCheck&& B,
+  LeafAction&& A,
+  TraversePref&& Comp)
+{
+  using BBoxType = primal::BoundingBox<FloatType, NDIMS>;
+
+  auto load_children = [&](int32 node,
+                           BBoxType& left_bin,
+                           BBoxType& right_bin,
+                           int32& l_child,
+                           int32& r_child) {
+    left_bin = inner_nodes[node + 0];
+    right_bin = inner_nodes[node + 1];
+    l_child = inner_node_children[node + 0];
+    r_child = inner_node_children[node + 1];
+  };
+
+  bvh_traverse_nodes<BBoxType>(load_children, leaf_nodes.data(), p, B, A, Comp);
+}
+
 } /* namespace linear_bvh */
 } /* namespace internal */
 } /* namespace spin */
@@ -0,0 +1,168 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_FIND_CANDIDATES_HPP_
+#define AXOM_SPIN_FIND_CANDIDATES_HPP_
+
+#include "axom/config.hpp"  // for axom compile-time definitions
+
+#include "axom/core/Array.hpp"
+#include "axom/core/execution/execution_space.hpp"
+#include "axom/core/execution/for_all.hpp"
+
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+
+#include "axom/slic/interface/slic.hpp"  // for slic
+
+#if defined(AXOM_USE_RAJA)
+  // RAJA includes
+  #include "RAJA/RAJA.hpp"
+#endif
+
+namespace axom
+{
+namespace spin
+{
+namespace internal
+{
+namespace linear_bvh
+{
+/*!
+ * \brief Performs a traversal of a BVH to find the candidates for each query
+ *  primitive.
+ *
+ * \param [in] traverser the device-copyable traverser of the BVH
+ * \param [in] predicate traversal predicate functor for bin check.
+ * \param [out] offsets array of offsets into the candidate array for each query primitive
+ * \param [out] counts array of candidate counts for each query primitive
+ * \param [in] numObjs the number of user-supplied query primitives
+ * \param [in] objs array of primitives to query against the BVH
+ * \param [in] allocatorID the allocator for the candidates array
+ *
+ * \return candidates array of the potential candidates for intersection with
+ *  the BVH
+ *
+ * \note The traverser must provide a traverse_tree() method taking the query
+ *  primitive, a leaf action, the predicate and a traversal preference functor.
+ */
+template <typename ExecSpace,
+          typename PrimitiveType,
+          typename TraverserType,
+          typename Predicate,
+          typename PrimitiveIndexable>
+axom::Array<IndexType> find_candidates(const TraverserType& traverser,
+                                       Predicate&& predicate,
+                                       const axom::ArrayView<IndexType> offsets,
+                                       const axom::ArrayView<IndexType> counts,
+                                       IndexType numObjs,
+                                       PrimitiveIndexable objs,
+                                       int allocatorID)
+{
+  using BoxType = typename TraverserType::BoxType;
+
+  auto noTraversePref =
+    [] AXOM_HOST_DEVICE(const BoxType&, const BoxType&, const PrimitiveType&) {
+      return false;
+    };
+
+#if defined(AXOM_USE_RAJA)
+  // STEP 1: count number of candidates for each query point
+  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
+  RAJA::ReduceSum<reduce_pol, IndexType> total_count_reduce(0);
+
+  AXOM_PERF_MARK_SECTION(
+    "PASS[1]:count_traversal",
+    for_all<ExecSpace>(
+      numObjs,
+      AXOM_LAMBDA(IndexType i) {
+        int32 count = 0;
+        PrimitiveType primitive {objs[i]};
+
+        auto leafAction = [&count](int32 AXOM_UNUSED_PARAM(current_node),
+                                   const int32* AXOM_UNUSED_PARAM(leaf_nodes)) {
+          count++;
+        };
+
+        traverser.traverse_tree(primitive, leafAction, predicate, noTraversePref);
+
+        counts[i] = count;
+        total_count_reduce += count;
+      }););
+
+  // STEP 2: exclusive scan to get offsets in candidate array for each query
+  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
+  AXOM_PERF_MARK_SECTION(
+    "exclusive_scan",
+    RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), numObjs),
+                                      RAJA::make_span(offsets.data(), numObjs),
+                                      RAJA::operators::plus<IndexType> {}););
+
+  IndexType total_candidates = total_count_reduce.get();
+
+  // STEP 3: allocate memory for all candidates
+  axom::Array<IndexType> candidates;
+  {
+    AXOM_PERF_MARK_FUNCTION("allocate_candidates");
+    candidates =
+      axom::Array<IndexType>(total_candidates, total_candidates, allocatorID);
+  }
+  const auto candidates_v = candidates.view();
+
+  // STEP 4: fill in candidates for each point
+  AXOM_PERF_MARK_SECTION("PASS[2]:fill_traversal",
+                         for_all<ExecSpace>(
+                           numObjs,
+                           AXOM_LAMBDA(IndexType i) {
+                             int32 offset = offsets[i];
+
+                             PrimitiveType obj {objs[i]};
+                             auto leafAction = [&offset, candidates_v](
+                                                 int32 current_node,
+                                                 const int32* leafs) {
+                               candidates_v[offset] = leafs[current_node];
+                               offset++;
+                             };
+
+                             traverser.traverse_tree(obj,
+                                                     leafAction,
+                                                     predicate,
+                                                     noTraversePref);
+                           }););
+  return candidates;
+#else  // CPU-only and no RAJA: do single traversal
+  AXOM_UNUSED_VAR(allocatorID);
+
+  axom::Array<IndexType> search_candidates;
+  int current_offset = 0;
+
+  // STEP 1: do single-pass traversal with std::vector for candidates
+  AXOM_PERF_MARK_SECTION(
+    "PASS[1]:fill_traversal", for_all<ExecSpace>(numObjs, [&](IndexType i) {
+      int matching_leaves = 0;
+      PrimitiveType obj {objs[i]};
+      offsets[i] = current_offset;
+
+      auto leafAction = [&](int32 current_node, const int32* leafs) {
+        search_candidates.emplace_back(leafs[current_node]);
+        matching_leaves++;
+        current_offset++;
+      };
+
+      traverser.traverse_tree(obj, leafAction, predicate, noTraversePref);
+      counts[i] = matching_leaves;
+    }););
+
+  SLIC_ASSERT(current_offset == static_cast<IndexType>(search_candidates.size()));
+
+  return search_candidates;
+#endif
+}
+
+} /* namespace linear_bvh */
+} /* namespace internal */
+} /* namespace spin */
+} /* namespace axom */
+
+#endif /* AXOM_SPIN_FIND_CANDIDATES_HPP_ */
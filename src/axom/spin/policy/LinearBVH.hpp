@@ -21,6 +21,7 @@
 #include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
 #include "axom/spin/internal/linear_bvh/bvh_vtkio.hpp"
+#include "axom/spin/internal/linear_bvh/find_candidates.hpp"
 
 // C/C++ includes
 #include <fstream>  // for std::ofstream
@@ -62,13 +63,7 @@ public:
       return sqDistL > sqDistR;
     };
 
-    lbvh::bvh_traverse(m_inner_nodes,
-                       m_inner_node_children,
-                       m_leaf_nodes,
-                       p,
-                       predicate,
-                       lf,
-                       traversePref);
+    traverse_tree(p, lf, predicate, traversePref);
   }
 
   template <typename Primitive, typename LeafAction, typename Predicate>
@@ -84,13 +79,25 @@ public:
         return false;
       };
 
+    traverse_tree(p, lf, predicate, noTraversePref);
+  }
+
+  template <typename Primitive,
+            typename LeafAction,
+            typename Predicate,
+            typename TraversePref>
+  AXOM_HOST_DEVICE void traverse_tree(const Primitive& p,
+                                      LeafAction&& lf,
+                                      Predicate&& predicate,
+                                      TraversePref&& traversePref) const
+  {
     lbvh::bvh_traverse(m_inner_nodes,
                        m_inner_node_children,
                        m_leaf_nodes,
                        p,
                        predicate,
                        lf,
-                       noTraversePref);
+                       traversePref);
   }
 
 private:
@@ -124,9 +131,34 @@ public:
    * \param [in] boxes the bounding boxes for each leaf node
    * \param [in] numBoxes the number of bounding boxes
    * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   * \param [in] treeletRounds the number of rounds of treelet restructuring
+   *  applied to the radix tree to reduce its surface area cost, 0 to disable
+   * \param [in] allocatorID the allocator for the BVH and temporary storage
    */
   template <typename BoxIndexable>
   void buildImpl(const BoxIndexable boxes,
+                 IndexType numBoxes,
+                 FloatType scaleFactor,
+                 int treeletRounds,
+                 int allocatorID);
+
+  /*!
+   * \brief Updates the bounding boxes of the nodes of the linear BVH with new
+   *  bounding boxes for its leaf nodes, keeping the current tree topology.
+   *
+   * \param [in] boxes the updated bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box
+   * \param [in] allocatorID the allocator for temporary storage
+   *
+   * \note The inner node bounding boxes are computed bottom-up in parallel.
+   *  Each inner node is processed by the last of its two children to arrive,
+   *  as determined by an atomic counter for each inner node.
+   *
+   * \pre numBoxes is the number of bounding boxes the BVH was built with
+   */
+  template <typename BoxIndexable>
+  void refitImpl(const BoxIndexable boxes,
                  IndexType numBoxes,
                  FloatType scaleFactor,
                  int allocatorID);
@@ -156,6 +188,32 @@ public:
 
   BoundingBoxType getBoundsImpl() const { return m_bounds; }
 
+  IndexType getNumLeavesImpl() const { return m_leaf_nodes.size(); }
+
+  /*!
+   * \brief Returns the summed surface area of the bounding boxes of all
+   *  non-root nodes in the BVH, relative to the surface area of the root.
+   *
+   * \note This is the surface area heuristic (SAH) estimate of the expected
+   *  number of nodes visited by a query; lower values indicate a tighter tree.
+   */
+  FloatType getSurfaceAreaCostImpl() const;
+
+  /*!
+   * \brief Returns the surface area cost of the BVH when it was built, i.e.
+   *  prior to any calls to refitImpl().
+   */
+  FloatType getBuildSurfaceAreaCostImpl() const { return m_build_sa_cost; }
+
+  /*!
+   * \brief Returns the surface area cost of the radix tree built from the
+   *  Morton codes, i.e. prior to the treelet restructuring in buildImpl().
+   */
+  FloatType getUnoptimizedSurfaceAreaCostImpl() const
+  {
+    return m_radix_tree_sa_cost;
+  }
+
   TraverserType getTraverserImpl() const
   {
     return TraverserType(m_inner_nodes.view(),
@@ -164,6 +222,16 @@ public:
   }
 
 private:
+  /// Emits the BVH nodes and the parent offsets from the radix tree
+  void emitBVH(const lbvh::RadixTree<FloatType, NDIMS>& radix_tree)
+  {
+    lbvh::emit_bvh<ExecSpace>(radix_tree,
+                              m_inner_nodes.view(),
+                              m_inner_node_children.view(),
+                              m_inner_node_parents.view(),
+                              m_leaf_parents.view());
+  }
+
   void allocate(int32 size, int allocID)
   {
     AXOM_PERF_MARK_FUNCTION("LinearBVH::allocate");
@@ -178,6 +246,8 @@ private:
     m_inner_node_children =
       axom::Array<int32>(numInnerNodes, numInnerNodes, allocID);
     m_leaf_nodes = axom::Array<int32>(size, size, allocID);
+    m_inner_node_parents = axom::Array<int32>(size - 1, size - 1, allocID);
+    m_leaf_parents = axom::Array<int32>(size, size, allocID);
   }
 
   bool m_initialized {false};
@@ -185,6 +255,14 @@ private:
   axom::Array<int32> m_inner_node_children;
   axom::Array<int32> m_leaf_nodes;  // leaf data
   primal::BoundingBox<FloatType, NDIMS> m_bounds;
+
+  // Offset in m_inner_nodes of the bounding box of each inner node and
+  // each (sorted) leaf node, within its parent; -1 for the root
+  axom::Array<int32> m_inner_node_parents;
+  axom::Array<int32> m_leaf_parents;
+
+  FloatType m_build_sa_cost {0};
+  FloatType m_radix_tree_sa_cost {0};
 };
 
 template <typename FloatType, int NDIMS, typename ExecSpace>
@@ -192,6 +270,7 @@ template <typename BoxIndexable>
 void LinearBVH<FloatType, NDIMS, ExecSpace>::buildImpl(const BoxIndexable boxes,
                                                        IndexType numBoxes,
                                                        FloatType scaleFactor,
+                                                       int treeletRounds,
                                                        int allocatorID)
 {
   AXOM_PERF_MARK_FUNCTION("LinearBVH::buildImpl");
@@ -211,64 +290,67 @@ void LinearBVH<FloatType, NDIMS, ExecSpace>::buildImpl(const BoxIndexable boxes,
   m_bounds = global_bounds;
   allocate(numBoxes, allocatorID);
 
-  // STEP 3: emit the BVH
-  const int32 size = radix_tree.m_size;
-  AXOM_UNUSED_VAR(size);
-  const int32 inner_size = radix_tree.m_inner_size;
-  SLIC_ASSERT(inner_size == size - 1);
-
-  const auto lchildren_ptr = radix_tree.m_left_children.view();
-  const auto rchildren_ptr = radix_tree.m_right_children.view();
-
-  const auto leaf_aabb_ptr = radix_tree.m_leaf_aabbs.view();
-  const auto inner_aabb_ptr = radix_tree.m_inner_aabbs.view();
-
-  const auto bvh_inner_nodes = m_inner_nodes.view();
-  const auto bvh_inner_node_children = m_inner_node_children.view();
-
-  AXOM_PERF_MARK_SECTION("emit_bvh_parents",
-                         for_all<ExecSpace>(
-                           inner_size,
-                           AXOM_LAMBDA(int32 node) {
-                             BoundingBoxType l_aabb, r_aabb;
-
-                             int32 lchild = lchildren_ptr[node];
-                             if(lchild >= inner_size)
-                             {
-                               l_aabb = leaf_aabb_ptr[lchild - inner_size];
-                               lchild = -(lchild - inner_size + 1);
-                             }
-                             else
-                             {
-                               l_aabb = inner_aabb_ptr[lchild];
-                               // do the offset now
-                               lchild *= 2;
-                             }
-
-                             int32 rchild = rchildren_ptr[node];
-                             if(rchild >= inner_size)
-                             {
-                               r_aabb = leaf_aabb_ptr[rchild - inner_size];
-                               rchild = -(rchild - inner_size + 1);
-                             }
-                             else
-                             {
-                               r_aabb = inner_aabb_ptr[rchild];
-                               // do the offset now
-                               rchild *= 2;
-                             }
-
-                             const int32 out_offset = node * 2;
-                             bvh_inner_nodes[out_offset + 0] = l_aabb;
-                             bvh_inner_nodes[out_offset + 1] = r_aabb;
-
-                             bvh_inner_node_children[out_offset + 0] = lchild;
-                             bvh_inner_node_children[out_offset + 1] = rchild;
-                           }););
+  emitBVH(radix_tree);
+  m_radix_tree_sa_cost = getSurfaceAreaCostImpl();
+
+  // STEP 3: optionally restructure the treelets of the radix tree and
+  // emit the BVH again
+  if(treeletRounds > 0)
+  {
+    lbvh::optimize_treelets<ExecSpace>(radix_tree, treeletRounds, allocatorID);
+    emitBVH(radix_tree);
+  }
 
   m_leaf_nodes = std::move(radix_tree.m_leafs);
 
   m_initialized = true;
+  m_build_sa_cost = getSurfaceAreaCostImpl();
+
+  SLIC_DEBUG("LinearBVH: surface area cost "
+             << m_build_sa_cost << " after " << treeletRounds
+             << " round(s) of treelet restructuring, radix tree cost "
+             << m_radix_tree_sa_cost);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+template <typename BoxIndexable>
+void LinearBVH<FloatType, NDIMS, ExecSpace>::refitImpl(const BoxIndexable boxes,
+                                                       IndexType numBoxes,
+                                                       FloatType scaleFactor,
+                                                       int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("LinearBVH::refitImpl");
+
+  SLIC_ASSERT(m_initialized);
+  SLIC_ERROR_IF(numBoxes != m_leaf_nodes.size(),
+                "refit requires the number of boxes the BVH was built with");
+
+  const auto inner_nodes = m_inner_nodes.view();
+
+  // STEP 1 & 2: propagate the leaf bounding boxes up to the root
+  lbvh::refit_bvh<ExecSpace>(boxes,
+                             numBoxes,
+                             scaleFactor,
+                             m_leaf_nodes.view(),
+                             m_leaf_parents.view(),
+                             m_inner_node_parents.view(),
+                             inner_nodes,
+                             allocatorID);
+
+  // STEP 3: the bounds are given by the two children of the root
+  BoundingBoxType root_children[2];
+  axom::copy(root_children, inner_nodes.data(), 2 * sizeof(BoundingBoxType));
+  m_bounds = root_children[0];
+  m_bounds.addBox(root_children[1]);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace>
+FloatType LinearBVH<FloatType, NDIMS, ExecSpace>::getSurfaceAreaCostImpl() const
+{
+  AXOM_PERF_MARK_FUNCTION("LinearBVH::getSurfaceAreaCostImpl");
+
+  return lbvh::surface_area_cost<ExecSpace, FloatType, NDIMS>(m_inner_nodes,
+                                                              m_bounds);
 }
 
 template <typename FloatType, int NDIMS, typename ExecSpace>
@@ -289,122 +371,13 @@ axom::Array<IndexType> LinearBVH<FloatType, NDIMS, ExecSpace>::findCandidatesImp
   SLIC_ERROR_IF(counts.size() != numObjs, "counts length not equal to numObjs");
   SLIC_ASSERT(m_initialized);
 
-  const auto inner_nodes = m_inner_nodes.view();
-  const auto inner_node_children = m_inner_node_children.view();
-  const auto leaf_nodes = m_leaf_nodes.view();
-
-  auto noTraversePref = [] AXOM_HOST_DEVICE(const BoundingBoxType&,
-                                            const BoundingBoxType&,
-                                            const PrimitiveType&) {
-    return false;
-  };
-
-#if defined(AXOM_USE_RAJA)
-  // STEP 1: count number of candidates for each query point
-  using reduce_pol = typename axom::execution_space<ExecSpace>::reduce_policy;
-  RAJA::ReduceSum<reduce_pol, IndexType> total_count_reduce(0);
-
-  AXOM_PERF_MARK_SECTION(
-    "PASS[1]:count_traversal",
-    for_all<ExecSpace>(
-      numObjs,
-      AXOM_LAMBDA(IndexType i) {
-        int32 count = 0;
-        PrimitiveType primitive {objs[i]};
-
-        auto leafAction = [&count](int32 AXOM_UNUSED_PARAM(current_node),
-                                   const int32* AXOM_UNUSED_PARAM(leaf_nodes)) {
-          count++;
-        };
-
-        lbvh::bvh_traverse(inner_nodes,
-                           inner_node_children,
-                           leaf_nodes,
-                           primitive,
-                           predicate,
-                           leafAction,
-                           noTraversePref);
-
-        counts[i] = count;
-        total_count_reduce += count;
-      }););
-
-  // STEP 2: exclusive scan to get offsets in candidate array for each query
-  using exec_policy = typename axom::execution_space<ExecSpace>::loop_policy;
-  AXOM_PERF_MARK_SECTION(
-    "exclusive_scan",
-    RAJA::exclusive_scan<exec_policy>(RAJA::make_span(counts.data(), numObjs),
-                                      RAJA::make_span(offsets.data(), numObjs),
-                                      RAJA::operators::plus<IndexType> {}););
-
-  IndexType total_candidates = total_count_reduce.get();
-
-  // STEP 3: allocate memory for all candidates
-  axom::Array<IndexType> candidates;
-  {
-    AXOM_PERF_MARK_FUNCTION("allocate_candidates");
-    candidates =
-      axom::Array<IndexType>(total_candidates, total_candidates, allocatorID);
-  }
-  const auto candidates_v = candidates.view();
-
-  // STEP 4: fill in candidates for each point
-  AXOM_PERF_MARK_SECTION("PASS[2]:fill_traversal",
-                         for_all<ExecSpace>(
-                           numObjs,
-                           AXOM_LAMBDA(IndexType i) {
-                             int32 offset = offsets[i];
-
-                             PrimitiveType obj {objs[i]};
-                             auto leafAction = [&offset, candidates_v](
-                                                 int32 current_node,
-                                                 const int32* leafs) {
-                               candidates_v[offset] = leafs[current_node];
-                               offset++;
-                             };
-
-                             lbvh::bvh_traverse(inner_nodes,
-                                                inner_node_children,
-                                                leaf_nodes,
-                                                obj,
-                                                predicate,
-                                                leafAction,
-                                                noTraversePref);
-                           }););
-  return candidates;
-#else  // CPU-only and no RAJA: do single traversal
-  AXOM_UNUSED_VAR(allocatorID);
-
-  axom::Array<IndexType> search_candidates;
-  int current_offset = 0;
-
-  // STEP 1: do single-pass traversal with std::vector for candidates
-  AXOM_PERF_MARK_SECTION(
-    "PASS[1]:fill_traversal", for_all<ExecSpace>(numObjs, [&](IndexType i) {
-      int matching_leaves = 0;
-      PrimitiveType obj {objs[i]};
-      offsets[i] = current_offset;
-
-      auto leafAction = [&](int32 current_node, const int32* leafs) {
-        search_candidates.emplace_back(leafs[current_node]);
-        matching_leaves++;
-        current_offset++;
-      };
-
-      lbvh::bvh_traverse(inner_nodes,
-                         inner_node_children,
-                         leaf_nodes,
-                         obj,
-                         predicate,
-                         leafAction,
-                         noTraversePref);
-      counts[i] = matching_leaves;
-    }););
-
-  SLIC_ASSERT(current_offset == static_cast<IndexType>(search_candidates.size()));
-
-  return search_candidates;
-#endif
+  return lbvh::find_candidates<ExecSpace, PrimitiveType>(getTraverserImpl(),
+                                                        predicate,
+                                                        offsets,
+                                                        counts,
+                                                        numObjs,
+                                                        objs,
+                                                        allocatorID);
 }
 
 template <typename FloatType, int NDIMS, typename ExecSpace>
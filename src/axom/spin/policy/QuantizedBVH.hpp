@@ -0,0 +1,555 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and
+// other Axom Project Developers. See the top-level LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#ifndef AXOM_SPIN_POLICY_QUANTIZEDBVH_HPP_
+#define AXOM_SPIN_POLICY_QUANTIZEDBVH_HPP_
+
+// axom core includes
+#include "axom/core/Types.hpp"              // for fixed bitwidth types
+#include "axom/core/execution/for_all.hpp"  // for generic for_all()
+#include "axom/core/memory_management.hpp"  // for alloc()/free()
+
+#include "axom/core/utilities/AnnotationMacros.hpp"  // for annotations
+
+#include "axom/primal/geometry/BoundingBox.hpp"
+
+// linear bvh includes
+#include "axom/spin/internal/linear_bvh/QuantizedNode.hpp"
+#include "axom/spin/internal/linear_bvh/RadixTree.hpp"
+#include "axom/spin/internal/linear_bvh/build_radix_tree.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_traverse.hpp"
+#include "axom/spin/internal/linear_bvh/bvh_vtkio.hpp"
+#include "axom/spin/internal/linear_bvh/find_candidates.hpp"
+
+// C/C++ includes
+#include <fstream>  // for std::ofstream
+#include <sstream>  // for std::ostringstream
+#include <string>   // for std::string
+
+namespace axom
+{
+namespace spin
+{
+namespace policy
+{
+namespace lbvh = internal::linear_bvh;
+
+template <typename FloatType, int NDIMS, typename QuantType>
+class QuantizedBVHTraverser
+{
+public:
+  using BoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = primal::Point<FloatType, NDIMS>;
+  using NodeType = lbvh::QuantizedNode<FloatType, NDIMS, QuantType>;
+
+  QuantizedBVHTraverser(axom::ArrayView<const NodeType> nodes,
+                        axom::ArrayView<const BoxType> leaf_aabbs,
+                        axom::ArrayView<const int32> leaf_nodes)
+    : m_nodes(nodes)
+    , m_leaf_aabbs(leaf_aabbs)
+    , m_leaf_nodes(leaf_nodes)
+  { }
+
+  template <typename LeafAction, typename Predicate>
+  AXOM_HOST_DEVICE void traverse_tree(const PointType& p,
+                                      LeafAction&& lf,
+                                      Predicate&& predicate) const
+  {
+    auto traversePref = [](const BoxType& l, const BoxType& r, const PointType& p) {
+      double sqDistL = primal::squared_distance(p, l.getCentroid());
+      double sqDistR = primal::squared_distance(p, r.getCentroid());
+      return sqDistL > sqDistR;
+    };
+
+    traverse_tree(p, lf, predicate, traversePref);
+  }
+
+  template <typename Primitive, typename LeafAction, typename Predicate>
+  AXOM_HOST_DEVICE void traverse_tree(const Primitive& p,
+                                      LeafAction&& lf,
+                                      Predicate&& predicate) const
+  {
+    auto noTraversePref =
+      [](const BoxType& l, const BoxType& r, const Primitive& p) {
+        AXOM_UNUSED_VAR(l);
+        AXOM_UNUSED_VAR(r);
+        AXOM_UNUSED_VAR(p);
+        return false;
+      };
+
+    traverse_tree(p, lf, predicate, noTraversePref);
+  }
+
+  template <typename Primitive,
+            typename LeafAction,
+            typename Predicate,
+            typename TraversePref>
+  AXOM_HOST_DEVICE void traverse_tree(const Primitive& p,
+                                      LeafAction&& lf,
+                                      Predicate&& predicate,
+                                      TraversePref&& traversePref) const
+  {
+    auto loadChildren = [&](int32 node,
+                            BoxType& l_box,
+                            BoxType& r_box,
+                            int32& l_child,
+                            int32& r_child) {
+      const NodeType& n = m_nodes[node];
+      n.decode(l_box, r_box);
+      l_child = n.child(0);
+      r_child = n.child(1);
+    };
+
+    // the quantized bounding boxes of the leafs are padded, so check the
+    // exact bounding box before invoking the leaf action
+    auto leafAction = [&](int32 current_node, const int32* leafs) {
+      if(predicate(p, m_leaf_aabbs[current_node]))
+      {
+        lf(current_node, leafs);
+      }
+    };
+
+    lbvh::bvh_traverse_nodes<BoxType>(loadChildren,
+                                      m_leaf_nodes.data(),
+                                      p,
+                                      predicate,
+                                      leafAction,
+                                      traversePref);
+  }
+
+private:
+  axom::ArrayView<const NodeType> m_nodes;
+  axom::ArrayView<const BoxType> m_leaf_aabbs;  // exact (sorted) leaf bins
+  axom::ArrayView<const int32> m_leaf_nodes;    // leaf data
+};
+
+/*!
+ * \brief QuantizedBVH provides a policy for a BVH implementation with the
+ *  same parallel linear construction as LinearBVH, but a compressed layout
+ *  of the internal nodes.
+ *
+ * \note Each internal node stores the bounding boxes of its two children as
+ *  QuantType offsets on a grid spanning the node, rounded outward, together
+ *  with the indices of the children (the index of the node if inner node,
+ *  ones-complement if leaf node). This roughly halves the memory traffic of a
+ *  traversal at the cost of decoding the bounding boxes. The padded bounding
+ *  boxes of leaf nodes are checked against their exact bounding boxes, so
+ *  queries return the same candidates as for LinearBVH.
+ *
+ * \tparam QuantType the unsigned integer type of the offsets, i.e. uint8 or
+ *  uint16
+ */
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+class QuantizedBVH
+{
+public:
+  using TraverserType = QuantizedBVHTraverser<FloatType, NDIMS, QuantType>;
+  using BoundingBoxType = primal::BoundingBox<FloatType, NDIMS>;
+  using NodeType = lbvh::QuantizedNode<FloatType, NDIMS, QuantType>;
+
+  QuantizedBVH() = default;
+
+  /*!
+   * \brief Builds a quantized BVH with the given bounding boxes as leaf nodes.
+   *
+   * \param [in] boxes the bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box before insertion into the BVH
+   * \param [in] treeletRounds the number of rounds of treelet restructuring
+   *  applied to the radix tree to reduce its surface area cost, 0 to disable
+   * \param [in] allocatorID the allocator for the BVH and temporary storage
+   */
+  template <typename BoxIndexable>
+  void buildImpl(const BoxIndexable boxes,
+                 IndexType numBoxes,
+                 FloatType scaleFactor,
+                 int treeletRounds,
+                 int allocatorID);
+
+  /*!
+   * \brief Updates the bounding boxes of the nodes of the quantized BVH with
+   *  new bounding boxes for its leaf nodes, keeping the current tree topology.
+   *
+   * \param [in] boxes the updated bounding boxes for each leaf node
+   * \param [in] numBoxes the number of bounding boxes
+   * \param [in] scaleFactor scale factor applied to each bounding box
+   * \param [in] allocatorID the allocator for temporary storage
+   *
+   * \pre numBoxes is the number of bounding boxes the BVH was built with
+   */
+  template <typename BoxIndexable>
+  void refitImpl(const BoxIndexable boxes,
+                 IndexType numBoxes,
+                 FloatType scaleFactor,
+                 int allocatorID);
+
+  /*!
+   * \brief Performs a traversal to find the candidates for each query primitive.
+   *
+   * \param [in] predicate traversal predicate functor for bin check.
+   * \param [out] offsets array of offsets into the candidate array for each query primitive
+   * \param [out] counts array of candidate counts for each query primitive
+   * \param [in] numObjs the number of user-supplied query primitives
+   * \param [in] objs array of primitives to query against the BVH
+   * \param [in] allocatorID the allocator for the candidates array
+   *
+   * \return candidates the potential candidates for intersection with the BVH
+   */
+  template <typename PrimitiveType, typename Predicate, typename PrimitiveIndexable>
+  axom::Array<IndexType> findCandidatesImpl(
+    Predicate&& predicate,
+    const axom::ArrayView<IndexType> offsets,
+    const axom::ArrayView<IndexType> counts,
+    IndexType numObjs,
+    PrimitiveIndexable objs,
+    int allocatorID) const;
+
+  void writeVtkFileImpl(const std::string& fileName) const;
+
+  BoundingBoxType getBoundsImpl() const { return m_bounds; }
+
+  IndexType getNumLeavesImpl() const { return m_leaf_nodes.size(); }
+
+  /*!
+   * \brief Returns the summed surface area of the quantized bounding boxes of
+   *  all non-root nodes in the BVH, relative to the surface area of the root.
+   */
+  FloatType getSurfaceAreaCostImpl() const;
+
+  /*!
+   * \brief Returns the surface area cost of the BVH when it was built, i.e.
+   *  prior to any calls to refitImpl().
+   */
+  FloatType getBuildSurfaceAreaCostImpl() const { return m_build_sa_cost; }
+
+  /*!
+   * \brief Returns the surface area cost of the radix tree built from the
+   *  Morton codes, i.e. prior to the treelet restructuring in buildImpl().
+   */
+  FloatType getUnoptimizedSurfaceAreaCostImpl() const
+  {
+    return m_radix_tree_sa_cost;
+  }
+
+  TraverserType getTraverserImpl() const
+  {
+    return TraverserType(m_nodes.view(),
+                         m_leaf_aabbs.view(),
+                         m_leaf_nodes.view());
+  }
+
+private:
+  /// Emits and quantizes the BVH nodes and the parent offsets from the radix
+  /// tree, using the given arrays for the flat layout of emit_bvh()
+  void emitNodes(const lbvh::RadixTree<FloatType, NDIMS>& radix_tree,
+                 axom::ArrayView<BoundingBoxType> child_boxes,
+                 axom::ArrayView<int32> children);
+
+  /// Quantizes the child bounding boxes in the flat layout of emit_bvh()
+  void encodeNodes(axom::ArrayView<const BoundingBoxType> child_boxes);
+
+  /// Decodes the child bounding boxes to the flat layout of emit_bvh()
+  void decodeNodes(axom::ArrayView<BoundingBoxType> child_boxes) const;
+
+  bool m_initialized {false};
+  axom::Array<NodeType> m_nodes;
+  axom::Array<BoundingBoxType> m_leaf_aabbs;  // exact (sorted) leaf bins
+  axom::Array<int32> m_leaf_nodes;            // leaf data
+  primal::BoundingBox<FloatType, NDIMS> m_bounds;
+
+  // Offset of the bounding box of each inner node and each (sorted) leaf node
+  // in the flat layout of emit_bvh(), within its parent; -1 for the root
+  axom::Array<int32> m_inner_node_parents;
+  axom::Array<int32> m_leaf_parents;
+
+  FloatType m_build_sa_cost {0};
+  FloatType m_radix_tree_sa_cost {0};
+};
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+template <typename BoxIndexable>
+void QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::buildImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  int treeletRounds,
+  int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("QuantizedBVH::buildImpl");
+
+  // STEP 1: Build a RadixTree consisting of the bounding boxes, sorted
+  // by their corresponding morton code.
+  lbvh::RadixTree<FloatType, NDIMS> radix_tree;
+  primal::BoundingBox<FloatType, NDIMS> global_bounds;
+  lbvh::build_radix_tree<ExecSpace>(boxes,
+                                    numBoxes,
+                                    global_bounds,
+                                    radix_tree,
+                                    scaleFactor,
+                                    allocatorID);
+
+  // STEP 2: emit the flat BVH layout from the radix tree and quantize it
+  m_bounds = global_bounds;
+
+  const int32 inner_size = numBoxes - 1;
+  const IndexType numChildren = inner_size * 2;
+  axom::Array<BoundingBoxType> child_boxes(axom::ArrayOptions::Uninitialized {},
+                                           numChildren,
+                                           numChildren,
+                                           allocatorID);
+  axom::Array<int32> children(numChildren, numChildren, allocatorID);
+  m_nodes = axom::Array<NodeType>(inner_size, inner_size, allocatorID);
+  m_inner_node_parents =
+    axom::Array<int32>(inner_size, inner_size, allocatorID);
+  m_leaf_parents = axom::Array<int32>(numBoxes, numBoxes, allocatorID);
+
+  emitNodes(radix_tree, child_boxes, children);
+  m_radix_tree_sa_cost = getSurfaceAreaCostImpl();
+
+  // STEP 3: optionally restructure the treelets of the radix tree and
+  // emit the BVH again
+  if(treeletRounds > 0)
+  {
+    lbvh::optimize_treelets<ExecSpace>(radix_tree, treeletRounds, allocatorID);
+    emitNodes(radix_tree, child_boxes, children);
+  }
+
+  m_leaf_aabbs = std::move(radix_tree.m_leaf_aabbs);
+  m_leaf_nodes = std::move(radix_tree.m_leafs);
+
+  m_initialized = true;
+  m_build_sa_cost = getSurfaceAreaCostImpl();
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+void QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::emitNodes(
+  const lbvh::RadixTree<FloatType, NDIMS>& radix_tree,
+  axom::ArrayView<BoundingBoxType> child_boxes,
+  axom::ArrayView<int32> children)
+{
+  AXOM_PERF_MARK_FUNCTION("QuantizedBVH::emitNodes");
+
+  lbvh::emit_bvh<ExecSpace>(radix_tree,
+                            child_boxes,
+                            children,
+                            m_inner_node_parents.view(),
+                            m_leaf_parents.view());
+
+  // inner children are stored as node indices instead of offsets
+  const auto nodes = m_nodes.view();
+  for_all<ExecSpace>(
+    nodes.size(),
+    AXOM_LAMBDA(IndexType node) {
+      const int32 l_child = children[2 * node + 0];
+      const int32 r_child = children[2 * node + 1];
+      nodes[node].setChildren((l_child < 0) ? l_child : l_child / 2,
+                              (r_child < 0) ? r_child : r_child / 2);
+    });
+
+  encodeNodes(child_boxes);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+template <typename BoxIndexable>
+void QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::refitImpl(
+  const BoxIndexable boxes,
+  IndexType numBoxes,
+  FloatType scaleFactor,
+  int allocatorID)
+{
+  AXOM_PERF_MARK_FUNCTION("QuantizedBVH::refitImpl");
+
+  SLIC_ASSERT(m_initialized);
+  SLIC_ERROR_IF(numBoxes != m_leaf_nodes.size(),
+                "refit requires the number of boxes the BVH was built with");
+
+  // STEP 1: update the exact bounding boxes of the leafs
+  const auto leaf_nodes = m_leaf_nodes.view();
+  const auto leaf_aabbs = m_leaf_aabbs.view();
+  for_all<ExecSpace>(
+    numBoxes,
+    AXOM_LAMBDA(IndexType i) {
+      BoundingBoxType aabb = boxes[leaf_nodes[i]];
+      aabb.scale(scaleFactor);
+      leaf_aabbs[i] = aabb;
+    });
+
+  // STEP 2: propagate the leaf bounding boxes up to the root in the flat
+  // layout, then quantize it
+  const IndexType numChildren = m_nodes.size() * 2;
+  axom::Array<BoundingBoxType> child_boxes(axom::ArrayOptions::Uninitialized {},
+                                           numChildren,
+                                           numChildren,
+                                           allocatorID);
+  lbvh::refit_bvh<ExecSpace>(boxes,
+                             numBoxes,
+                             scaleFactor,
+                             m_leaf_nodes.view(),
+                             m_leaf_parents.view(),
+                             m_inner_node_parents.view(),
+                             child_boxes.view(),
+                             allocatorID);
+  encodeNodes(child_boxes);
+
+  // STEP 3: the bounds are given by the two children of the root
+  BoundingBoxType root_children[2];
+  axom::copy(root_children, child_boxes.data(), 2 * sizeof(BoundingBoxType));
+  m_bounds = root_children[0];
+  m_bounds.addBox(root_children[1]);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+void QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::encodeNodes(
+  axom::ArrayView<const BoundingBoxType> child_boxes)
+{
+  AXOM_PERF_MARK_FUNCTION("QuantizedBVH::encodeNodes");
+
+  const auto nodes = m_nodes.view();
+  for_all<ExecSpace>(
+    nodes.size(),
+    AXOM_LAMBDA(IndexType node) {
+      nodes[node].encode(child_boxes[2 * node + 0], child_boxes[2 * node + 1]);
+    });
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+void QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::decodeNodes(
+  axom::ArrayView<BoundingBoxType> child_boxes) const
+{
+  const auto nodes = m_nodes.view();
+  for_all<ExecSpace>(
+    nodes.size(),
+    AXOM_LAMBDA(IndexType node) {
+      nodes[node].decode(child_boxes[2 * node + 0], child_boxes[2 * node + 1]);
+    });
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+FloatType
+QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::getSurfaceAreaCostImpl() const
+{
+  AXOM_PERF_MARK_FUNCTION("QuantizedBVH::getSurfaceAreaCostImpl");
+
+  const IndexType numChildren = m_nodes.size() * 2;
+  axom::Array<BoundingBoxType> child_boxes(axom::ArrayOptions::Uninitialized {},
+                                           numChildren,
+                                           numChildren,
+                                           m_nodes.getAllocatorID());
+  decodeNodes(child_boxes);
+
+  return lbvh::surface_area_cost<ExecSpace, FloatType, NDIMS>(child_boxes,
+                                                              m_bounds);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+template <typename PrimitiveType, typename Predicate, typename PrimitiveIndexable>
+axom::Array<IndexType>
+QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::findCandidatesImpl(
+  Predicate&& predicate,
+  const axom::ArrayView<IndexType> offsets,
+  const axom::ArrayView<IndexType> counts,
+  IndexType numObjs,
+  PrimitiveIndexable objs,
+  int allocatorID) const
+{
+  AXOM_PERF_MARK_FUNCTION("QuantizedBVH::findCandidatesImpl");
+
+  SLIC_ERROR_IF(offsets.size() != numObjs,
+                "offsets length not equal to numObjs");
+  SLIC_ERROR_IF(counts.size() != numObjs, "counts length not equal to numObjs");
+  SLIC_ASSERT(m_initialized);
+
+  return lbvh::find_candidates<ExecSpace, PrimitiveType>(getTraverserImpl(),
+                                                        predicate,
+                                                        offsets,
+                                                        counts,
+                                                        numObjs,
+                                                        objs,
+                                                        allocatorID);
+}
+
+template <typename FloatType, int NDIMS, typename ExecSpace, typename QuantType>
+void QuantizedBVH<FloatType, NDIMS, ExecSpace, QuantType>::writeVtkFileImpl(
+  const std::string& fileName) const
+{
+  std::ostringstream nodes;
+  std::ostringstream cells;
+  std::ostringstream levels;
+
+  // STEP 0: decode the BVH bins to the flat layout of emit_bvh()
+  const IndexType numChildren = m_nodes.size() * 2;
+  axom::Array<BoundingBoxType> child_boxes(axom::ArrayOptions::Uninitialized {},
+                                           numChildren,
+                                           numChildren,
+                                           m_nodes.getAllocatorID());
+  decodeNodes(child_boxes);
+
+  axom::Array<int32> children(numChildren);
+  for(IndexType node = 0; node < m_nodes.size(); ++node)
+  {
+    for(int c = 0; c < 2; ++c)
+    {
+      const int32 child = m_nodes[node].child(c);
+      children[2 * node + c] = (child < 0) ? child : child * 2;
+    }
+  }
+
+  // STEP 1: Write VTK header
+  std::ofstream ofs;
+  ofs.open(fileName.c_str());
+  ofs << "# vtk DataFile Version 3.0\n";
+  ofs << " BVHTree \n";
+  ofs << "ASCII\n";
+  ofs << "DATASET UNSTRUCTURED_GRID\n";
+
+  // STEP 2: write root
+  int32 numPoints = 0;
+  int32 numBins = 0;
+  lbvh::write_root(m_bounds, numPoints, numBins, nodes, cells, levels);
+
+  // STEP 3: traverse the BVH and dump each bin
+  constexpr int32 ROOT = 0;
+  lbvh::write_recursive<FloatType, NDIMS>(child_boxes,
+                                          children,
+                                          ROOT,
+                                          1,
+                                          numPoints,
+                                          numBins,
+                                          nodes,
+                                          cells,
+                                          levels);
+
+  // STEP 4: write nodes
+  ofs << "POINTS " << numPoints << " double\n";
+  ofs << nodes.str() << std::endl;
+
+  // STEP 5: write cells
+  const int32 nnodes = (NDIMS == 2) ? 4 : 8;
+  ofs << "CELLS " << numBins << " " << numBins * (nnodes + 1) << std::endl;
+  ofs << cells.str() << std::endl;
+
+  // STEP 6: write cell types
+  ofs << "CELL_TYPES " << numBins << std::endl;
+  const int32 cellType = (NDIMS == 2) ? 9 : 12;
+  for(int32 i = 0; i < numBins; ++i)
+  {
+    ofs << cellType << std::endl;
+  }
+
+  // STEP 7: dump level information
+  ofs << "CELL_DATA " << numBins << std::endl;
+  ofs << "SCALARS level int\n";
+  ofs << "LOOKUP_TABLE default\n";
+  ofs << levels.str() << std::endl;
+  ofs << std::endl;
+
+  // STEP 8: close file
+  ofs.close();
+}
+
+}  // namespace policy
+}  // namespace spin
+}  // namespace axom
+#endif /* AXOM_SPIN_POLICY_QUANTIZEDBVH_HPP_ */
@@ -15,6 +15,11 @@
 // gtest includes
 #include "gtest/gtest.h"
 
+// C/C++ includes
+#include <algorithm>  // for std::sort
+#include <cmath>      // for std::sin
+#include <vector>
+
 using namespace axom;
 namespace xargs = mint::xargs;
 
@@ -1308,6 +1313,320 @@ void check_find_points_zip2d()
 
 } /* end unnamed namespace */
 
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Tests refitting a BVH to the bounding boxes of a deformed mesh.
+ *
+ *  The candidates found by the refitted BVH for each bounding box must match
+ *  the candidates found by a BVH that is rebuilt on the deformed boxes.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_refit()
+{
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using VectorType = typename primal::Vector<FloatType, NDIMS>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  // setup a test mesh (8 x 8 (x 8))
+  double lo[3] = {0.0, 0.0, 0.0};
+  double hi[3] = {8.0, 8.0, 8.0};
+  mint::UniformMesh mesh(lo, hi, 9, 9, (NDIMS == 3) ? 9 : -1);
+  const IndexType ncells = mesh.getNumberOfCells();
+  BoxType* aabbs = nullptr;
+  generate_aabbs(&mesh, aabbs);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  EXPECT_EQ(spin::BVH_BUILD_FAILED, bvh.refit(aabbs, ncells));
+
+  bvh.initialize(aabbs, ncells);
+  const BoxType initialBounds = bvh.getBounds();
+  EXPECT_NEAR(1., bvh.getSurfaceAreaCostRatio(), 1e-5);
+  EXPECT_GT(bvh.getSurfaceAreaCost(), 1.);
+
+  // refit requires the same number of boxes
+  EXPECT_EQ(spin::BVH_BUILD_FAILED, bvh.refit(aabbs, ncells - 1));
+
+  // refitting to the same boxes does not change the BVH
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.refit(aabbs, ncells));
+  EXPECT_EQ(initialBounds, bvh.getBounds());
+  EXPECT_NEAR(1., bvh.getSurfaceAreaCostRatio(), 1e-5);
+
+  // deform the boxes with a smooth displacement
+  for(IndexType i = 0; i < ncells; ++i)
+  {
+    const auto centroid = aabbs[i].getCentroid();
+    VectorType disp;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      disp[d] = 0.4 * std::sin(centroid[(d + 1) % NDIMS]);
+    }
+    aabbs[i].shift(disp);
+    aabbs[i].scale(1. + 0.1 * (i % 3));
+  }
+
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.refit(aabbs, ncells));
+  EXPECT_GT(bvh.getSurfaceAreaCostRatio(), 1.);
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> rebuilt;
+  rebuilt.initialize(aabbs, ncells);
+  EXPECT_EQ(rebuilt.getBounds(), bvh.getBounds());
+
+  axom::Array<IndexType> offsets(ncells), rebuiltOffsets(ncells);
+  axom::Array<IndexType> counts(ncells), rebuiltCounts(ncells);
+  axom::Array<IndexType> candidates, rebuiltCandidates;
+  bvh.findBoundingBoxes(offsets, counts, candidates, ncells, aabbs);
+  rebuilt.findBoundingBoxes(rebuiltOffsets,
+                            rebuiltCounts,
+                            rebuiltCandidates,
+                            ncells,
+                            aabbs);
+
+  for(IndexType i = 0; i < ncells; ++i)
+  {
+    ASSERT_EQ(rebuiltCounts[i], counts[i]);
+
+    std::vector<IndexType> found(candidates.data() + offsets[i],
+                                 candidates.data() + offsets[i] + counts[i]);
+    std::vector<IndexType> expected(
+      rebuiltCandidates.data() + rebuiltOffsets[i],
+      rebuiltCandidates.data() + rebuiltOffsets[i] + rebuiltCounts[i]);
+    std::sort(found.begin(), found.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, found);
+  }
+
+  // refit a BVH with a single box
+  spin::BVH<NDIMS, ExecSpace, FloatType> single;
+  single.initialize(aabbs, 1);
+  EXPECT_EQ(spin::BVH_BUILD_OK, single.refit(aabbs + 1, 1));
+  EXPECT_TRUE(single.getBounds().contains(aabbs[1]));
+
+  axom::deallocate(aabbs);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+template <typename ExecSpace, typename FloatType, int NDIMS>
+void check_treelet_optimization()
+{
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  // generate boxes whose sizes span several orders of magnitude
+  constexpr IndexType NUM_BOXES = 2000;
+  BoxType* aabbs = axom::allocate<BoxType>(NUM_BOXES);
+  unsigned int seed = 42;
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType center;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      center[d] = axom::utilities::random_real(0., 10., seed++);
+    }
+    const double size = std::pow(10., (i % 4) - 2.);
+
+    BoxType box(center);
+    box.expand(size * axom::utilities::random_real(0.5, 1., seed++));
+    aabbs[i] = box;
+  }
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> bvh;
+  bvh.initialize(aabbs, NUM_BOXES);
+  EXPECT_EQ(0, bvh.getTreeletOptimizationRounds());
+  EXPECT_EQ(bvh.getUnoptimizedSurfaceAreaCost(), bvh.getSurfaceAreaCost());
+
+  spin::BVH<NDIMS, ExecSpace, FloatType> optimized;
+  optimized.setTreeletOptimizationRounds(3);
+  optimized.initialize(aabbs, NUM_BOXES);
+  EXPECT_EQ(3, optimized.getTreeletOptimizationRounds());
+  EXPECT_EQ(bvh.getBounds(), optimized.getBounds());
+  EXPECT_NEAR(bvh.getSurfaceAreaCost(),
+              optimized.getUnoptimizedSurfaceAreaCost(),
+              1e-3 * bvh.getSurfaceAreaCost());
+  EXPECT_LT(optimized.getSurfaceAreaCost(),
+            0.95 * optimized.getUnoptimizedSurfaceAreaCost());
+
+  // the restructured BVH finds the same candidates
+  axom::Array<IndexType> offsets(NUM_BOXES), optOffsets(NUM_BOXES);
+  axom::Array<IndexType> counts(NUM_BOXES), optCounts(NUM_BOXES);
+  axom::Array<IndexType> candidates, optCandidates;
+  bvh.findBoundingBoxes(offsets, counts, candidates, NUM_BOXES, aabbs);
+  optimized.findBoundingBoxes(optOffsets,
+                              optCounts,
+                              optCandidates,
+                              NUM_BOXES,
+                              aabbs);
+
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    ASSERT_EQ(counts[i], optCounts[i]);
+
+    std::vector<IndexType> found(optCandidates.data() + optOffsets[i],
+                                 optCandidates.data() + optOffsets[i] +
+                                   optCounts[i]);
+    std::vector<IndexType> expected(candidates.data() + offsets[i],
+                                    candidates.data() + offsets[i] + counts[i]);
+    std::sort(found.begin(), found.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, found);
+  }
+
+  // refitting keeps the restructured hierarchy
+  EXPECT_EQ(spin::BVH_BUILD_OK, optimized.refit(aabbs, NUM_BOXES));
+  EXPECT_NEAR(1., optimized.getSurfaceAreaCostRatio(), 1e-5);
+
+  axom::deallocate(aabbs);
+  axom::setDefaultAllocator(current_allocator);
+}
+
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Checks that the candidates found by a BVH match those found by a
+ *  reference BVH, up to their order.
+ */
+template <typename BVHType, typename ReferenceBVHType, typename QueryFunc>
+void check_same_candidates(const BVHType& bvh,
+                           const ReferenceBVHType& reference,
+                           IndexType numQueries,
+                           QueryFunc&& query)
+{
+  axom::Array<IndexType> offsets(numQueries), refOffsets(numQueries);
+  axom::Array<IndexType> counts(numQueries), refCounts(numQueries);
+  axom::Array<IndexType> candidates, refCandidates;
+  query(bvh, offsets, counts, candidates);
+  query(reference, refOffsets, refCounts, refCandidates);
+
+  for(IndexType i = 0; i < numQueries; ++i)
+  {
+    ASSERT_EQ(refCounts[i], counts[i]);
+
+    std::vector<IndexType> found(candidates.data() + offsets[i],
+                                 candidates.data() + offsets[i] + counts[i]);
+    std::vector<IndexType> expected(
+      refCandidates.data() + refOffsets[i],
+      refCandidates.data() + refOffsets[i] + refCounts[i]);
+    std::sort(found.begin(), found.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(expected, found);
+  }
+}
+
+/*!
+ * \brief Tests that a BVH with quantized node bounding boxes finds the same
+ *  candidates as a LinearBVH, before and after a refit.
+ */
+template <typename ExecSpace, typename FloatType, int NDIMS, spin::BVHType Impl>
+void check_quantized_bvh()
+{
+  using BoxType = typename primal::BoundingBox<FloatType, NDIMS>;
+  using PointType = typename primal::Point<FloatType, NDIMS>;
+  using VectorType = typename primal::Vector<FloatType, NDIMS>;
+  using RayType = typename primal::Ray<FloatType, NDIMS>;
+  using LinearBVHType = spin::BVH<NDIMS, ExecSpace, FloatType>;
+  using QuantizedBVHType = spin::BVH<NDIMS, ExecSpace, FloatType, Impl>;
+
+  const int current_allocator = axom::getDefaultAllocatorID();
+  axom::setDefaultAllocator(axom::execution_space<ExecSpace>::allocatorID());
+
+  // generate boxes whose sizes span several orders of magnitude, offset from
+  // the origin so that the quantization grids are not aligned with it
+  constexpr IndexType NUM_BOXES = 2000;
+  BoxType* aabbs = axom::allocate<BoxType>(NUM_BOXES);
+  PointType* points = axom::allocate<PointType>(NUM_BOXES);
+  RayType* rays = axom::allocate<RayType>(NUM_BOXES);
+  unsigned int seed = 7;
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    PointType center;
+    VectorType direction;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      center[d] = axom::utilities::random_real(100., 110., seed++);
+      points[i][d] = axom::utilities::random_real(100., 110., seed++);
+      direction[d] = axom::utilities::random_real(-1., 1., seed++);
+    }
+    const double size = std::pow(10., (i % 3) - 3.);
+
+    BoxType box(center);
+    box.expand(size * axom::utilities::random_real(0.5, 1., seed++));
+    aabbs[i] = box;
+    rays[i] = RayType(points[i], direction);
+  }
+
+  auto check_queries = [&](const QuantizedBVHType& bvh,
+                           const LinearBVHType& reference) {
+    check_same_candidates(
+      bvh,
+      reference,
+      NUM_BOXES,
+      [&](const auto& tree, auto& offsets, auto& counts, auto& candidates) {
+        tree.findBoundingBoxes(offsets, counts, candidates, NUM_BOXES, aabbs);
+      });
+    check_same_candidates(
+      bvh,
+      reference,
+      NUM_BOXES,
+      [&](const auto& tree, auto& offsets, auto& counts, auto& candidates) {
+        tree.findPoints(offsets, counts, candidates, NUM_BOXES, points);
+      });
+    check_same_candidates(
+      bvh,
+      reference,
+      NUM_BOXES,
+      [&](const auto& tree, auto& offsets, auto& counts, auto& candidates) {
+        tree.findRays(offsets, counts, candidates, NUM_BOXES, rays);
+      });
+  };
+
+  LinearBVHType reference;
+  reference.initialize(aabbs, NUM_BOXES);
+
+  QuantizedBVHType bvh;
+  bvh.initialize(aabbs, NUM_BOXES);
+  EXPECT_EQ(reference.getBounds(), bvh.getBounds());
+
+  // the quantized bounding boxes contain the exact ones
+  EXPECT_GE(bvh.getSurfaceAreaCost(), reference.getSurfaceAreaCost());
+  EXPECT_LT(bvh.getSurfaceAreaCost(), 2. * reference.getSurfaceAreaCost());
+  check_queries(bvh, reference);
+
+  // refit both BVHs to shifted boxes
+  for(IndexType i = 0; i < NUM_BOXES; ++i)
+  {
+    VectorType disp;
+    for(int d = 0; d < NDIMS; ++d)
+    {
+      disp[d] = 0.05 * std::sin(aabbs[i].getCentroid()[(d + 1) % NDIMS]);
+    }
+    aabbs[i].shift(disp);
+  }
+
+  EXPECT_EQ(spin::BVH_BUILD_OK, reference.refit(aabbs, NUM_BOXES));
+  EXPECT_EQ(spin::BVH_BUILD_OK, bvh.refit(aabbs, NUM_BOXES));
+  EXPECT_EQ(reference.getBounds(), bvh.getBounds());
+  check_queries(bvh, reference);
+
+  // a BVH with treelet restructuring also matches
+  QuantizedBVHType optimized;
+  optimized.setTreeletOptimizationRounds(2);
+  optimized.initialize(aabbs, NUM_BOXES);
+  EXPECT_LT(optimized.getSurfaceAreaCost(),
+            optimized.getUnoptimizedSurfaceAreaCost());
+  check_queries(optimized, reference);
+
+  axom::deallocate(rays);
+  axom::deallocate(points);
+  axom::deallocate(aabbs);
+  axom::setDefaultAllocator(current_allocator);
+}
+
 //------------------------------------------------------------------------------
 // UNIT TESTS
 //------------------------------------------------------------------------------
@@ -1401,6 +1720,34 @@ TEST(spin_bvh, find_points_3d_sequential_zip)
   check_find_points_zip3d<axom::SEQ_EXEC, float>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_sequential)
+{
+  check_refit<axom::SEQ_EXEC, double, 2>();
+  check_refit<axom::SEQ_EXEC, double, 3>();
+  check_refit<axom::SEQ_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, treelet_optimization_sequential)
+{
+  check_treelet_optimization<axom::SEQ_EXEC, double, 2>();
+  check_treelet_optimization<axom::SEQ_EXEC, double, 3>();
+  check_treelet_optimization<axom::SEQ_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, quantized_bvh_sequential)
+{
+  constexpr auto QUANTIZED8 = spin::BVHType::QuantizedBVH8;
+  constexpr auto QUANTIZED16 = spin::BVHType::QuantizedBVH16;
+
+  check_quantized_bvh<axom::SEQ_EXEC, double, 2, QUANTIZED8>();
+  check_quantized_bvh<axom::SEQ_EXEC, double, 3, QUANTIZED8>();
+  check_quantized_bvh<axom::SEQ_EXEC, double, 3, QUANTIZED16>();
+  check_quantized_bvh<axom::SEQ_EXEC, float, 3, QUANTIZED16>();
+}
+
 //------------------------------------------------------------------------------
 #if defined(AXOM_USE_OPENMP) && defined(AXOM_USE_RAJA)
 
@@ -1472,6 +1819,34 @@ TEST(spin_bvh, single_box3d_omp)
   check_single_box3d<axom::OMP_EXEC, double>();
 }
 
+//------------------------------------------------------------------------------
+TEST(spin_bvh, refit_omp)
+{
+  check_refit<axom::OMP_EXEC, double, 2>();
+  check_refit<axom::OMP_EXEC, double, 3>();
+  check_refit<axom::OMP_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, treelet_optimization_omp)
+{
+  check_treelet_optimization<axom::OMP_EXEC, double, 2>();
+  check_treelet_optimization<axom::OMP_EXEC, double, 3>();
+  check_treelet_optimization<axom::OMP_EXEC, float, 3>();
+}
+
+//------------------------------------------------------------------------------
+TEST(spin_bvh, quantized_bvh_omp)
+{
+  constexpr auto QUANTIZED8 = spin::BVHType::QuantizedBVH8;
+  constexpr auto QUANTIZED16 = spin::BVHType::QuantizedBVH16;
+
+  check_quantized_bvh<axom::OMP_EXEC, double, 2, QUANTIZED8>();
+  check_quantized_bvh<axom::OMP_EXEC, double, 3, QUANTIZED8>();
+  check_quantized_bvh<axom::OMP_EXEC, double, 3, QUANTIZED16>();
+  check_quantized_bvh<axom::OMP_EXEC, float, 3, QUANTIZED16>();
+}
+
 #endif
 
 //------------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 
 #include <cstdlib>
 #include <limits>
+#include <vector>
 
 // Uncomment the line below for true randomized points
 #ifndef MORTON_TESTER_SHOULD_SEED
@@ -235,6 +236,56 @@ TEST(spin_morton, test_integral_types_3D)
   testIntegralTypes<DIM>();
 }
 
+template <typename CoordType, typename MortonIndexType, int DIM>
+void testBatchedMortonizer()
+{
+  using MortonizerType =
+    axom::spin::Mortonizer<CoordType, MortonIndexType, DIM>;
+  using GridPoint = Point<CoordType, DIM>;
+
+  const int maxBits = MortonizerType::maxBitsPerCoord();
+  const CoordType maxCoord =
+    static_cast<CoordType>((maxBits < std::numeric_limits<CoordType>::digits)
+                             ? (CoordType(1) << maxBits)
+                             : 0);
+
+  std::vector<GridPoint> pts(MAX_ITER);
+  for(auto& pt : pts)
+  {
+    pt = randomPoint<CoordType, DIM>(0, maxCoord);
+  }
+
+  std::vector<MortonIndexType> batched(MAX_ITER);
+  std::vector<MortonIndexType> table(MAX_ITER);
+  MortonizerType::mortonize(pts.data(), MAX_ITER, batched.data());
+  axom::spin::internal::mortonizeLUT<MortonizerType>(pts.data(),
+                                                     MAX_ITER,
+                                                     table.data());
+
+  for(int i = 0; i < MAX_ITER; ++i)
+  {
+    const MortonIndexType expected = MortonizerType::mortonize(pts[i]);
+    EXPECT_EQ(expected, batched[i]);
+    EXPECT_EQ(expected, table[i]);
+  }
+}
+
+TEST(spin_morton, test_batched_mortonizer)
+{
+  SLIC_INFO("Testing batched Morton conversion, BMI2 supported: "
+            << (axom::spin::internal::hasFastBMI2() ? "yes" : "no"));
+
+  testBatchedMortonizer<axom::int8, axom::uint8, 2>();
+  testBatchedMortonizer<axom::int16, axom::uint32, 2>();
+  testBatchedMortonizer<axom::int32, axom::uint64, 2>();
+  testBatchedMortonizer<axom::uint32, axom::int32, 2>();
+
+  testBatchedMortonizer<axom::int8, axom::uint8, 3>();
+  testBatchedMortonizer<axom::int16, axom::uint32, 3>();
+  testBatchedMortonizer<axom::int32, axom::uint64, 3>();
+  testBatchedMortonizer<axom::uint32, axom::int32, 3>();
+}
+
 TEST(spin_morton, test_point_hasher)
 {
   using namespace axom::spin;
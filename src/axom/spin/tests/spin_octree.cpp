@@ -336,6 +336,120 @@ TEST(spin_octree, count_octree_blocks)
   EXPECT_EQ(4, octree.getOctreeLevel(3).numLeafBlocks());
 }
 
+TEST(spin_octree, octree_level_statistics)
+{
+  static const int DIM = 2;
+  using LeafNodeType = axom::spin::BlockData;
+  using OctreeType = axom::spin::OctreeBase<DIM, LeafNodeType>;
+
+  OctreeType octree;
+
+  // Refine blocks in the dense levels and in the sparse levels
+  OctreeType::BlockIndex blk = octree.root();
+  const int NUM_REFINEMENTS = 12;
+  for(int i = 0; i < NUM_REFINEMENTS; ++i)
+  {
+    octree.refineLeaf(blk);
+    blk = blk.child(i % (1 << DIM));
+  }
+
+  std::size_t totalBytes = 0;
+  for(int lev = 0; lev < octree.maxLeafLevel(); ++lev)
+  {
+    axom::spin::OctreeLevelStatistics stats = octree.levelStatistics(lev);
+    EXPECT_EQ(lev, stats.level);
+    EXPECT_EQ(octree.getOctreeLevel(lev).numBlocks(), stats.numBlocks);
+    EXPECT_EQ(octree.getOctreeLevel(lev).numLeafBlocks(), stats.numLeafBlocks);
+
+    // Levels with blocks have some storage in use
+    if(lev <= NUM_REFINEMENTS)
+    {
+      EXPECT_GT(stats.loadFactor, 0.);
+      EXPECT_GT(stats.numBytes, 0u);
+    }
+    EXPECT_GE(stats.loadFactor, 0.);
+    EXPECT_LE(stats.loadFactor, 1.);
+
+    totalBytes += stats.numBytes;
+  }
+  EXPECT_EQ(totalBytes, octree.numBytes());
+}
+
+TEST(spin_octree, octree_level_storage)
+{
+  static const int DIM = 2;
+  using LeafNodeType = axom::spin::BlockData;
+  using OctreeType = axom::spin::OctreeBase<DIM, LeafNodeType>;
+  using BlockIndex = OctreeType::BlockIndex;
+
+  OctreeType octree;
+
+  // Fully refine the octree through FULL_LEV; the levels past the
+  // dense levels are then full and stored in hash maps
+  const int FULL_LEV = 7;
+  for(int lev = 0; lev < FULL_LEV; ++lev)
+  {
+    std::vector<BlockIndex> leaves;
+    const auto& levelBlocks = octree.getOctreeLevel(lev);
+    for(auto it = levelBlocks.begin(); it != levelBlocks.end(); ++it)
+    {
+      leaves.emplace_back(it.pt(), lev);
+    }
+    for(const auto& blk : leaves)
+    {
+      octree.refineLeaf(blk);
+    }
+  }
+
+  // Assign unique ids to the leaves
+  int numLeaves = 0;
+  auto& leafLevel = octree.getOctreeLevel(FULL_LEV);
+  for(auto it = leafLevel.begin(); it != leafLevel.end(); ++it)
+  {
+    it->setData(numLeaves++);
+  }
+  EXPECT_EQ(1 << (DIM * FULL_LEV), numLeaves);
+
+  auto checkBlocks = [&]() {
+    for(int lev = 0; lev <= FULL_LEV; ++lev)
+    {
+      EXPECT_EQ(1 << (DIM * lev), octree.getOctreeLevel(lev).numBlocks());
+    }
+
+    int id = 0;
+    const auto& leaves = octree.getOctreeLevel(FULL_LEV);
+    for(auto it = leaves.begin(); it != leaves.end(); ++it)
+    {
+      const BlockIndex blk(it.pt(), FULL_LEV);
+      EXPECT_TRUE(octree.hasBlock(blk));
+      EXPECT_TRUE(octree.isLeaf(blk));
+      EXPECT_TRUE(octree.isInternal(blk.parent()));
+      EXPECT_FALSE(octree.hasBlock(blk.child(0)));
+      EXPECT_EQ(id++, octree[blk].getID());
+    }
+  };
+
+  // Promote the full levels to dense storage
+  const int numFullSparse = FULL_LEV - 4;
+  EXPECT_EQ(numFullSparse, octree.updateLevelStorage());
+  for(int lev = 0; lev < octree.maxLeafLevel(); ++lev)
+  {
+    EXPECT_EQ(lev <= FULL_LEV, octree.isDenseLevel(lev));
+  }
+  checkBlocks();
+
+  // Calling again is a no-op
+  EXPECT_EQ(0, octree.updateLevelStorage());
+
+  // Converting back to sparse storage preserves the blocks
+  EXPECT_EQ(numFullSparse, octree.updateLevelStorage(2., 1.5));
+  for(int lev = 0; lev < octree.maxLeafLevel(); ++lev)
+  {
+    EXPECT_EQ(lev <= 4, octree.isDenseLevel(lev));
+  }
+  checkBlocks();
+}
+
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
 int main(int argc, char* argv[])
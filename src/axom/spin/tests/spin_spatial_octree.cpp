@@ -66,6 +66,63 @@ TEST(spin_spatial_octree, spatial_octree_point_location)
   }
 }
 
+TEST(spin_spatial_octree, query_statistics)
+{
+  SLIC_INFO("*** This test checks the leaf block query counters.");
+
+  static const int DIM = 3;
+  using LeafNodeType = axom::spin::BlockData;
+
+  using OctreeType = axom::spin::SpatialOctree<DIM, LeafNodeType>;
+  using BlockIndex = OctreeType::BlockIndex;
+  using SpacePt = OctreeType::SpacePt;
+  using GeometricBoundingBox = OctreeType::GeometricBoundingBox;
+
+  GeometricBoundingBox bb(SpacePt(0.), SpacePt(1.));
+  SpacePt queryPt(0.3);
+
+  OctreeType octree(bb);
+
+  // Refine the octree a few times around the query point
+  const int NUM_REFINEMENTS = 4;
+  for(int i = 0; i < NUM_REFINEMENTS; ++i)
+  {
+    octree.refineLeaf(octree.findLeafBlock(queryPt));
+  }
+
+  // Statistics are not collected by default
+  EXPECT_FALSE(octree.queryStatisticsEnabled());
+  octree.findLeafBlock(queryPt);
+  EXPECT_EQ(0u, octree.queryStatistics().numQueries);
+
+  octree.enableQueryStatistics();
+  EXPECT_TRUE(octree.queryStatisticsEnabled());
+
+  const int NUM_QUERIES = 10;
+  for(int i = 0; i < NUM_QUERIES; ++i)
+  {
+    BlockIndex leafBlock = octree.findLeafBlock(queryPt);
+    EXPECT_EQ(NUM_REFINEMENTS, leafBlock.level());
+  }
+
+  axom::spin::OctreeQueryStatistics stats = octree.queryStatistics();
+  EXPECT_EQ(static_cast<std::uint64_t>(NUM_QUERIES), stats.numQueries);
+  EXPECT_GE(stats.maxLevelsProbed, 1);
+  EXPECT_LE(stats.maxLevelsProbed, octree.maxLeafLevel());
+  EXPECT_EQ(stats.numLevelsProbed, stats.numQueries * stats.maxLevelsProbed);
+  EXPECT_DOUBLE_EQ(stats.maxLevelsProbed, stats.averageLevelsProbed());
+
+  octree.resetQueryStatistics();
+  EXPECT_EQ(0u, octree.queryStatistics().numQueries);
+  EXPECT_EQ(0u, octree.queryStatistics().numLevelsProbed);
+  EXPECT_EQ(0, octree.queryStatistics().maxLevelsProbed);
+  EXPECT_EQ(0., octree.queryStatistics().averageLevelsProbed());
+
+  octree.enableQueryStatistics(false);
+  octree.findLeafBlock(queryPt);
+  EXPECT_EQ(0u, octree.queryStatistics().numQueries);
+}
+
 //----------------------------------------------------------------------
 //----------------------------------------------------------------------
 int main(int argc, char* argv[])
@@ -16,14 +16,30 @@
  * size and a filler entry of 0 for integer arrays or nan for floating point
  * arrays. E.g. if the array had 6 entries [1.01. 2.02, 3.03, 4.04, 5.05, 6.06]
  * and the user passed in --strip 3, the array would be converted to
- * [6, 3, nan, 1.01, 2.02, 3.03].
+ * [6, 3, nan, 1.01, 2.02, 3.03]. The arrays are truncated after they are
+ * loaded, so the strip option does not reduce the amount of data read.
  *
  * \note The strip option is intended as a temporary solution to truncating
  * a dataset to allow easier debugging.  In the future, we intend to separate
  * the conversion and truncation/display functionality into separate utilities.
+ *
+ * The '--stream' option converts the datastore one input file at a time
+ * rather than loading it all at once. The input files are distributed
+ * among the MPI ranks, largest first (dynamically when Axom is configured
+ * with MPI-3), and each rank loads, converts and writes one tree (the data
+ * of one rank of the original run) at a time, so the memory footprint is
+ * bounded by the largest tree. In this mode, the '--select' option
+ * restricts the output to the views whose paths (relative to the root of
+ * each tree) match one of the given patterns, where '*' matches any sequence
+ * of characters and '?' matches a single character, e.g.
+ * '--select "fields/*" --select "state/*"'. Unselected views are
+ * discarded before their external data is allocated and read. The size of
+ * the data that was actually loaded and its throughput are reported at the
+ * end of the conversion.
  */
 
 #include "axom/config.hpp"
+#include "axom/core.hpp"
 #include "axom/slic.hpp"
 #include "axom/sidre.hpp"
 #include "axom/slam.hpp"
@@ -32,9 +48,17 @@
 #include "axom/fmt.hpp"
 #include "axom/CLI11.hpp"
 
-#include <limits>   // for numeric_limits<int>
-#include <cstdlib>  // for atoi
-#include <sstream>  // for stringstream
+#include "conduit_relay.hpp"
+#include "conduit_relay_mpi.hpp"
+#include "conduit_relay_io_hdf5.hpp"
+#include "hdf5.h"
+
+#include <algorithm>   // for sort
+#include <fstream>     // for ifstream
+#include <functional>  // for greater
+#include <limits>      // for numeric_limits<int>
+#include <cstdlib>     // for atoi
+#include <sstream>     // for stringstream
 
 namespace sidre = axom::sidre;
 namespace slam = axom::slam;
@@ -60,18 +84,23 @@ struct CommandLineArguments
   std::string m_outputName;
   std::string m_protocol;
   int m_numStripElts;
+  bool m_streaming;
+  std::vector<std::string> m_selectPatterns;
 
   CommandLineArguments()
     : m_inputName("")
     , m_outputName("")
     , m_protocol("json")
     , m_numStripElts(-1)
+    , m_streaming(false)
   { }
 
   void parse(int argc, char** argv, axom::CLI::App& app);
 
   bool shouldStripData() const { return m_numStripElts >= 0; }
 
+  bool shouldSelectData() const { return !m_selectPatterns.empty(); }
+
   /**  Returns the maximum allowed elements in a view of the output datastore */
   int maxEltsPerView() const
   {
@@ -123,9 +152,22 @@ void CommandLineArguments::parse(int argc, char** argv, axom::CLI::App& app)
     .add_option(
       "-s,--strip",
       m_numStripElts,
-      "If provided, output arrays will be stripped to first N entries")
+      "If provided, output arrays will be stripped to first N entries. "
+      "The full arrays are still loaded from the input files")
     ->check(axom::CLI::PositiveNumber);
 
+  auto* streamOpt = app.add_flag(
+    "--stream",
+    m_streaming,
+    "Convert one input file at a time, distributing the files among ranks");
+
+  app
+    .add_option("--select",
+                m_selectPatterns,
+                "With '--stream', only convert views whose path matches one "
+                "of the given patterns ('*' and '?' are wildcards)")
+    ->needs(streamOpt);
+
   bool verboseOutput = false;
   app.add_flag("-v,--verbose", verboseOutput, "Sets output to verbose")
     ->capture_default_str();
@@ -150,11 +192,14 @@ void CommandLineArguments::parse(int argc, char** argv, axom::CLI::App& app)
  *
  * \param grp  The group to traverse
  * \param extPtrs [out] A vector to hold pointers to the allocated data
+ * \return The number of bytes allocated
  *
  * \note Also initializes the data in each allocated array to zeros
  */
-void allocateExternalData(sidre::Group* grp, std::vector<void*>& extPtrs)
+axom::int64 allocateExternalData(sidre::Group* grp, std::vector<void*>& extPtrs)
 {
+  axom::int64 numBytes = 0;
+
   // for each view
   for(auto idx = grp->getFirstValidViewIndex(); sidre::indexIsValid(idx);
       idx = grp->getNextValidViewIndex(idx))
@@ -171,6 +216,7 @@ void allocateExternalData(sidre::Group* grp, std::vector<void*>& extPtrs)
       extPtrs.push_back(new char[sz]);
       std::memset(extPtrs[idx], 0, sz);
       view->setExternalDataPtr(extPtrs[idx]);
+      numBytes += sz;
     }
   }
 
@@ -178,8 +224,10 @@ void allocateExternalData(sidre::Group* grp, std::vector<void*>& extPtrs)
   for(auto idx = grp->getFirstValidGroupIndex(); sidre::indexIsValid(idx);
       idx = grp->getNextValidGroupIndex(idx))
   {
-    allocateExternalData(grp->getGroup(idx), extPtrs);
+    numBytes += allocateExternalData(grp->getGroup(idx), extPtrs);
   }
+
+  return numBytes;
 }
 
 /**
@@ -344,6 +392,518 @@ void truncateBulkData(sidre::Group* grp, int maxSize)
   }
 }
 
+/**
+ * \brief Checks whether \a str matches the wildcard \a pattern
+ *
+ * A '*' in the pattern matches any (possibly empty) sequence of characters,
+ * including path delimiters, and a '?' matches any single character.
+ */
+bool matchesPattern(const std::string& str, const std::string& pattern)
+{
+  std::size_t s = 0, p = 0;
+  std::size_t starPos = std::string::npos, matchPos = 0;
+
+  while(s < str.size())
+  {
+    if(p < pattern.size() && (pattern[p] == '?' || pattern[p] == str[s]))
+    {
+      ++s;
+      ++p;
+    }
+    else if(p < pattern.size() && pattern[p] == '*')
+    {
+      // Remember the star and initially match an empty sequence
+      starPos = p++;
+      matchPos = s;
+    }
+    else if(starPos != std::string::npos)
+    {
+      // Backtrack: let the last star match one more character
+      p = starPos + 1;
+      s = ++matchPos;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  while(p < pattern.size() && pattern[p] == '*')
+  {
+    ++p;
+  }
+  return p == pattern.size();
+}
+
+bool matchesAnyPattern(const std::string& str,
+                       const std::vector<std::string>& patterns)
+{
+  return std::any_of(patterns.begin(),
+                     patterns.end(),
+                     [&str](const std::string& pattern) {
+                       return matchesPattern(str, pattern);
+                     });
+}
+
+/**
+ * \brief Recursively removes the views of \a grp that are not selected
+ *
+ * A view is selected when its path relative to the root of the traversal,
+ * or the path of one of its ancestor groups, matches one of the patterns.
+ * Groups that are left without any views or child groups are removed.
+ *
+ * \param grp The group to traverse
+ * \param patterns The patterns for the selected paths
+ * \param grpPath The path of \a grp relative to the root of the traversal
+ *
+ * \return True if \a grp still has some selected data
+ */
+bool pruneUnselectedData(sidre::Group* grp,
+                         const std::vector<std::string>& patterns,
+                         const std::string& grpPath = "")
+{
+  auto childPath = [&grpPath](const std::string& name) {
+    return grpPath.empty() ? name : grpPath + "/" + name;
+  };
+
+  // for each view
+  for(auto idx = grp->getFirstValidViewIndex(); sidre::indexIsValid(idx);)
+  {
+    const auto nextIdx = grp->getNextValidViewIndex(idx);
+    if(!matchesAnyPattern(childPath(grp->getView(idx)->getName()), patterns))
+    {
+      grp->destroyViewAndData(idx);
+    }
+    idx = nextIdx;
+  }
+
+  // for each group
+  for(auto idx = grp->getFirstValidGroupIndex(); sidre::indexIsValid(idx);)
+  {
+    const auto nextIdx = grp->getNextValidGroupIndex(idx);
+    sidre::Group* child = grp->getGroup(idx);
+    const std::string path = childPath(child->getName());
+    if(!matchesAnyPattern(path, patterns) &&
+       !pruneUnselectedData(child, patterns, path))
+    {
+      grp->destroyGroup(idx);
+    }
+    idx = nextIdx;
+  }
+
+  return grp->getNumViews() > 0 || grp->getNumGroups() > 0;
+}
+
+/** Returns the size of the given file in bytes, or 0 if it cannot be read */
+axom::int64 getFileSize(const std::string& fileName)
+{
+  std::ifstream ifs(fileName, std::ios::binary | std::ios::ate);
+  return ifs ? static_cast<axom::int64>(ifs.tellg()) : 0;
+}
+
+/** Returns the names of the tree groups in the given hdf5 file */
+std::vector<std::string> getTreeGroupNames(hid_t h5_file_id)
+{
+  std::vector<std::string> names;
+
+  H5G_info_t info;
+  herr_t errv = H5Gget_info(h5_file_id, &info);
+  SLIC_ERROR_IF(errv < 0, "Could not read the groups of an input file");
+
+  for(hsize_t i = 0; i < info.nlinks; ++i)
+  {
+    const ssize_t len = H5Lget_name_by_idx(h5_file_id,
+                                           ".",
+                                           H5_INDEX_NAME,
+                                           H5_ITER_INC,
+                                           i,
+                                           nullptr,
+                                           0,
+                                           H5P_DEFAULT);
+    std::vector<char> name(len + 1);
+    H5Lget_name_by_idx(h5_file_id,
+                       ".",
+                       H5_INDEX_NAME,
+                       H5_ITER_INC,
+                       i,
+                       name.data(),
+                       name.size(),
+                       H5P_DEFAULT);
+    names.emplace_back(name.data());
+  }
+
+  return names;
+}
+
+/**
+ * \brief Returns the id of the tree stored in the hdf5 group \a groupName
+ * of file \a fileId, i.e. the rank that wrote it
+ *
+ * IOManager names the tree group 'datagroup' when each rank writes its own
+ * file, and 'datagroup_<rank>' otherwise.
+ */
+int getTreeId(const std::string& groupName, int fileId)
+{
+  const std::string prefix = "datagroup_";
+  return axom::utilities::string::startsWith(groupName, prefix)
+    ? std::stoi(groupName.substr(prefix.size()))
+    : fileId;
+}
+
+/**
+ * \brief A work queue over the indices [0, n) shared by the ranks
+ * of a communicator
+ *
+ * With MPI-3, each call to next() atomically claims the next unprocessed
+ * index using an MPI one-sided fetch-and-add on a counter hosted by rank 0.
+ * Otherwise, the indices are distributed statically, in a round-robin
+ * fashion, among the ranks.
+ */
+class WorkQueue
+{
+public:
+#ifdef AXOM_USE_MPI3
+  WorkQueue(MPI_Comm comm, int numItems) : m_numItems(numItems)
+  {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    const MPI_Aint sz = (rank == 0) ? sizeof(int) : 0;
+    MPI_Win_allocate(sz, sizeof(int), MPI_INFO_NULL, comm, &m_counter, &m_win);
+    if(rank == 0)
+    {
+      MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, m_win);
+      *m_counter = 0;
+      MPI_Win_unlock(0, m_win);
+    }
+    MPI_Barrier(comm);
+  }
+
+  ~WorkQueue() { MPI_Win_free(&m_win); }
+#else
+  WorkQueue(MPI_Comm comm, int numItems) : m_numItems(numItems)
+  {
+    MPI_Comm_rank(comm, &m_next);
+    MPI_Comm_size(comm, &m_numRanks);
+  }
+#endif
+
+  WorkQueue(const WorkQueue&) = delete;
+  WorkQueue& operator=(const WorkQueue&) = delete;
+
+  /** Returns the next index to process, or -1 when all have been claimed */
+  int next()
+  {
+#ifdef AXOM_USE_MPI3
+    const int one = 1;
+    int idx = 0;
+    MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, m_win);
+    MPI_Fetch_and_op(&one, &idx, MPI_INT, 0, 0, MPI_SUM, m_win);
+    MPI_Win_unlock(0, m_win);
+#else
+    const int idx = m_next;
+    m_next += m_numRanks;
+#endif
+    return idx < m_numItems ? idx : -1;
+  }
+
+private:
+  int m_numItems;
+#ifdef AXOM_USE_MPI3
+  int* m_counter {nullptr};
+  MPI_Win m_win;
+#else
+  int m_next {0};
+  int m_numRanks {1};
+#endif
+};
+
+/** Returns the note that is added to datastores with truncated data */
+std::string getStripNote(int numElts)
+{
+  std::stringstream sstr;
+  sstr << "This datastore was created by axom's 'convert_sidre_protocol' "
+       << "utility with option '--strip " << numElts << "'. "
+       << "To simplify debugging, the bulk data in this datastore has been "
+       << "truncated to have at most " << numElts << " original values "
+       << "per array. Three values have been prepended to each array: "
+       << "the size of the original array, the number of retained elements "
+       << "and a zero/Nan.";
+  return sstr.str();
+}
+
+/**
+ * \brief Converts the datastore one input file at a time
+ *
+ * The input files are sorted by decreasing size and claimed dynamically by
+ * the ranks through a WorkQueue. Each tree of a claimed file is loaded into
+ * its own DataStore, pruned and truncated, and written out before the next
+ * tree is loaded.
+ *
+ * With the 'sidre_hdf5' protocol, the output has the same files and trees as
+ * the input; with the other protocols, each tree is written to its own file.
+ */
+void convertStreaming(const CommandLineArguments& args)
+{
+  int my_rank, num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  const bool outputHDF5 = (args.m_protocol == "sidre_hdf5");
+  const std::string inputDir = axom::Path(args.m_inputName).dirName();
+  const std::string outputBase =
+    axom::utilities::string::removeSuffix(args.m_outputName, ".root");
+
+  // Rank 0 reads the root file and orders the files by decreasing size
+  conduit::Node root;
+  if(my_rank == 0)
+  {
+    conduit::Node inputRoot;
+    conduit::relay::io::load(args.m_inputName, "hdf5", inputRoot);
+
+    const int numFiles = inputRoot["number_of_files"].to_int();
+    const std::string filePattern = inputRoot["file_pattern"].as_string();
+
+    std::vector<std::pair<conduit::int64, int>> sizes(numFiles);
+    for(int f = 0; f < numFiles; ++f)
+    {
+      const std::string fileName = axom::utilities::string::appendPrefix(
+        inputDir,
+        axom::fmt::sprintf(filePattern.c_str(), f),
+        '/');
+      sizes[f] = {getFileSize(fileName), f};
+    }
+    std::sort(sizes.begin(), sizes.end(), std::greater<>());
+
+    std::vector<int> order(numFiles);
+    std::vector<conduit::int64> orderedSizes(numFiles);
+    for(int i = 0; i < numFiles; ++i)
+    {
+      orderedSizes[i] = sizes[i].first;
+      order[i] = sizes[i].second;
+    }
+
+    root["number_of_files"] = numFiles;
+    root["number_of_trees"] = inputRoot["number_of_trees"].to_int();
+    root["file_pattern"] = filePattern;
+    root["tree_pattern"] = inputRoot.has_path("tree_pattern")
+      ? inputRoot["tree_pattern"].as_string()
+      : std::string("datagroup");
+    root["file_order"].set(order);
+    root["file_sizes"].set(orderedSizes);
+  }
+  conduit::relay::mpi::broadcast_using_schema(root, 0, MPI_COMM_WORLD);
+
+  const int numFiles = root["number_of_files"].to_int();
+  const int numTrees = root["number_of_trees"].to_int();
+  const std::string filePattern = root["file_pattern"].as_string();
+  const std::string treePattern = root["tree_pattern"].as_string();
+  const int* fileOrder = root["file_order"].as_int_ptr();
+  const conduit::int64* fileSizes = root["file_sizes"].as_int64_ptr();
+
+  // Rank 0 writes the output root file
+  std::string outputPattern;
+  if(outputHDF5)
+  {
+    const std::string localBase = axom::Path(outputBase).baseName();
+    outputPattern = localBase + "/" + localBase + "_%07d.hdf5";
+  }
+  else
+  {
+    outputPattern = outputBase + "_%07d." + args.m_protocol;
+  }
+
+  if(my_rank == 0)
+  {
+    conduit::Node outputRoot;
+    outputRoot["number_of_files"] = outputHDF5 ? numFiles : numTrees;
+    outputRoot["file_pattern"] = outputPattern;
+    outputRoot["number_of_trees"] = numTrees;
+    outputRoot["tree_pattern"] = treePattern;
+    outputRoot["protocol/name"] = args.m_protocol;
+    outputRoot["protocol/version"] = "0.0";
+
+    std::string outputDir;
+    axom::utilities::filesystem::getDirName(outputDir, outputBase);
+    if(!outputDir.empty())
+    {
+      axom::utilities::filesystem::makeDirsForPath(outputDir);
+    }
+    conduit::relay::io::save(
+      outputRoot,
+      outputBase + ".root",
+      sidre::IOManager::correspondingRelayProtocol(args.m_protocol));
+  }
+
+  // Process the files, counting the sizes of the input files and the bytes
+  // of data loaded from them, which excludes pruned external data
+  axom::int64 inputBytes = 0;
+  axom::int64 bytesLoaded = 0;
+  int numFilesConverted = 0;
+  int numTreesConverted = 0;
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  axom::utilities::Timer timer(true);
+
+  WorkQueue queue(MPI_COMM_WORLD, numFiles);
+  for(int item = queue.next(); item >= 0; item = queue.next())
+  {
+    const int fileId = fileOrder[item];
+    const std::string inputFile = axom::utilities::string::appendPrefix(
+      inputDir,
+      axom::fmt::sprintf(filePattern.c_str(), fileId),
+      '/');
+    SLIC_DEBUG("Converting file " << inputFile);
+
+    hid_t h5_in_id = conduit::relay::io::hdf5_open_file_for_read(inputFile);
+    SLIC_ERROR_IF(h5_in_id < 0, "Could not open input file " << inputFile);
+
+    hid_t h5_out_id = -1;
+    std::string outputFile;
+    if(outputHDF5)
+    {
+      outputFile = axom::utilities::string::appendPrefix(
+        axom::Path(outputBase).dirName(),
+        axom::fmt::sprintf(outputPattern.c_str(), fileId),
+        '/');
+      std::string outputDir;
+      axom::utilities::filesystem::getDirName(outputDir, outputFile);
+      if(!outputDir.empty())
+      {
+        axom::utilities::filesystem::makeDirsForPath(outputDir);
+      }
+      h5_out_id = conduit::relay::io::hdf5_create_file(outputFile);
+      SLIC_ERROR_IF(h5_out_id < 0,
+                    "Could not create output file " << outputFile);
+    }
+
+    for(const auto& groupName : getTreeGroupNames(h5_in_id))
+    {
+      herr_t errv;
+      AXOM_UNUSED_VAR(errv);
+
+      // Load the tree and discard the unselected data
+      sidre::DataStore ds;
+      hid_t h5_group_id = H5Gopen(h5_in_id, groupName.c_str(), H5P_DEFAULT);
+      SLIC_ERROR_IF(h5_group_id < 0,
+                    "Could not open group " << groupName << " of input file "
+                                            << inputFile);
+      ds.getRoot()->load(h5_group_id, "sidre_hdf5");
+
+      // Loading reads the data of all the Buffers, selected or not
+      for(const auto& buff : ds.buffers())
+      {
+        if(buff.isAllocated())
+        {
+          bytesLoaded += buff.getTotalBytes();
+        }
+      }
+
+      if(args.shouldSelectData())
+      {
+        pruneUnselectedData(ds.getRoot(), args.m_selectPatterns);
+      }
+
+      // Restore the external data that is still needed
+      std::vector<void*> externalDataPointers;
+      const axom::int64 externalBytes =
+        allocateExternalData(ds.getRoot(), externalDataPointers);
+      if(!externalDataPointers.empty())
+      {
+        ds.getRoot()->loadExternalData(h5_group_id);
+        bytesLoaded += externalBytes;
+      }
+      errv = H5Gclose(h5_group_id);
+      SLIC_ASSERT(errv >= 0);
+
+      if(args.shouldStripData())
+      {
+        truncateBulkData(ds.getRoot(), args.maxEltsPerView());
+        ds.getRoot()->createViewString("Note",
+                                       getStripNote(args.maxEltsPerView()));
+      }
+
+      // Write out the tree
+      if(outputHDF5)
+      {
+        h5_group_id = H5Gcreate(h5_out_id,
+                                groupName.c_str(),
+                                H5P_DEFAULT,
+                                H5P_DEFAULT,
+                                H5P_DEFAULT);
+        SLIC_ERROR_IF(h5_group_id < 0,
+                      "Could not create group " << groupName
+                                                << " of output file "
+                                                << outputFile);
+        ds.getRoot()->save(h5_group_id);
+        errv = H5Gclose(h5_group_id);
+        SLIC_ASSERT(errv >= 0);
+      }
+      else
+      {
+        const int treeId = getTreeId(groupName, fileId);
+        const std::string treeFile =
+          axom::fmt::sprintf("%s_%07d", outputBase, treeId) + "." +
+          args.m_protocol;
+        ds.getRoot()->save(treeFile, args.m_protocol);
+      }
+
+      for(void* ptr : externalDataPointers)
+      {
+        delete[] static_cast<char*>(ptr);
+      }
+      ++numTreesConverted;
+    }
+
+    if(outputHDF5)
+    {
+      herr_t errv = H5Fclose(h5_out_id);
+      SLIC_ASSERT(errv >= 0);
+      AXOM_UNUSED_VAR(errv);
+    }
+    herr_t errv = H5Fclose(h5_in_id);
+    SLIC_ASSERT(errv >= 0);
+    AXOM_UNUSED_VAR(errv);
+
+    inputBytes += fileSizes[item];
+    ++numFilesConverted;
+  }
+  timer.stop();
+
+  SLIC_DEBUG("Converted " << numFilesConverted << " files with "
+                          << numTreesConverted << " trees in "
+                          << timer.elapsed() << " s.");
+
+  // Report the throughput
+  const double localTime = timer.elapsed();
+  double maxTime = 0.;
+  axom::int64 localBytes[2] = {inputBytes, bytesLoaded};
+  axom::int64 totalBytes[2] = {0, 0};
+  MPI_Reduce(&localTime, &maxTime, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  MPI_Reduce(localBytes,
+             totalBytes,
+             2,
+             MPI_INT64_T,
+             MPI_SUM,
+             0,
+             MPI_COMM_WORLD);
+
+  // The data that is loaded excludes the metadata and the pruned external
+  // data, hence the throughput is that of the data actually read
+  constexpr double MiB = 1024. * 1024.;
+  const double throughput = maxTime > 0. ? totalBytes[1] / MiB / maxTime : 0.;
+  SLIC_INFO_IF(my_rank == 0,
+               axom::fmt::format("Converted {} files ({:.1f} MiB) on {} ranks "
+                                 "in {:.2f} s: loaded {:.1f} MiB of data "
+                                 "at {:.1f} MiB/s",
+                                 numFiles,
+                                 totalBytes[0] / MiB,
+                                 num_ranks,
+                                 maxTime,
+                                 totalBytes[1] / MiB,
+                                 throughput));
+}
+
 /** Sets up the logging using lumberjack */
 void setupLogging()
 {
@@ -423,6 +983,18 @@ int main(int argc, char* argv[])
     quitProgram(retval);
   }
 
+  if(args.m_streaming)
+  {
+    SLIC_INFO("Streaming datastore from "
+              << args.m_inputName << " to '" << args.m_protocol
+              << "' protocol file(s) with base name " << args.m_outputName);
+    convertStreaming(args);
+
+    teardownLogging();
+    MPI_Finalize();
+    return 0;
+  }
+
   // Load the original datastore
   SLIC_INFO("Loading datastore from " << args.m_inputName);
   sidre::DataStore ds;
@@ -447,16 +1019,7 @@ int main(int argc, char* argv[])
     truncateBulkData(ds.getRoot(), numElts);
 
     // Add a string view to the datastore to indicate that we modified the data
-    std::stringstream sstr;
-    sstr << "This datastore was created by axom's 'convert_sidre_protocol' "
-         << "utility with option '--strip " << numElts << "'. "
-         << "To simplify debugging, the bulk data in this datastore has been "
-         << "truncated to have at most " << numElts << " original values "
-         << "per array. Three values have been prepended to each array: "
-         << "the size of the original array, the number of retained elements "
-         << "and a zero/Nan.";
-
-    ds.getRoot()->createViewString("Note", sstr.str());
+    ds.getRoot()->createViewString("Note", getStripNote(numElts));
   }
 
   // Write out datastore to the output file in the specified protocol
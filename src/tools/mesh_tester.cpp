@@ -159,7 +159,7 @@ void Input::parse(int argc, char** argv, axom::CLI::App& app)
     ->capture_default_str();
 
   std::stringstream pol_sstr;
-  pol_sstr << "With \'-m bvh\' or \'-m naive\', set runtime policy. \n"
+  pol_sstr << "Set runtime policy for the intersection method. \n"
            << "Set to \'seq\' or 0 to use the sequential algorithm "
            << "(w/o RAJA).";
 #ifdef AXOM_USE_RAJA
@@ -224,20 +224,11 @@ void Input::parse(int argc, char** argv, axom::CLI::App& app)
     << (method == "naive" ? " (use naive algorithm)" : "")
     << (method == "bvh" ? " (use bounding volume hierarchy)" : "")
     << (method == "uniform" ? "\n  resolution = " + std::to_string(resolution) : "")
-    << (method == "naive" || method == "bvh" ? "\n  policy = " : "")
-    << (method == "naive" || method == "bvh" ? std::to_string(policy) : "")
-    << ((method == "naive" || method == "bvh") && policy == seq
-          ? " (use sequential policy)"
-          : "")
-    << ((method == "naive" || method == "bvh") && policy == raja_seq
-          ? " (use RAJA sequential policy)"
-          : "")
-    << ((method == "naive" || method == "bvh") && policy == raja_omp
-          ? " (use RAJA OpenMP policy)"
-          : "")
-    << ((method == "naive" || method == "bvh") && policy == raja_cuda
-          ? " (use RAJA CUDA policy)"
-          : "")
+    << "\n  policy = " << std::to_string(policy)
+    << (policy == seq ? " (use sequential policy)" : "")
+    << (policy == raja_seq ? " (use RAJA sequential policy)" : "")
+    << (policy == raja_omp ? " (use RAJA OpenMP policy)" : "")
+    << (policy == raja_cuda ? " (use RAJA CUDA policy)" : "")
     << "\n  weld threshold = " << weldThreshold << "\n  "
     << (skipWeld ? "" : "not ") << "skipping weld"
     << "\n  intersection tolerance = " << intersectionThreshold